@@ -0,0 +1,74 @@
+# Checks that reproducible arithmetic compiles to register-only code.
+#
+# Usage:
+#   cmake -DCOMPILER=<c++> -DSOURCE=<barrier_codegen.cpp> -DINCLUDE=<dir>
+#         [-DOPTIONS=<flags;...>] -P barrier_codegen.cmake
+#
+# The source is compiled to assembly, and the test fails if any instruction
+# addresses the stack, which is what a barrier that spills its operand to
+# memory produces. It's compiled again with FMA instructions available,
+# contraction forced on and loops vectorized, and fails if any multiply and
+# add were fused. Finally it's compiled with -ffast-math, and fails if a
+# division was replaced by a multiplication by the reciprocal.
+
+foreach(variable COMPILER SOURCE INCLUDE)
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} must be defined")
+    endif()
+endforeach()
+
+function(compile_to_assembly output)
+    execute_process(
+        COMMAND ${COMPILER} -std=c++17 -O2 ${OPTIONS} ${ARGN} -I${INCLUDE}
+                -S -o - ${SOURCE}
+        OUTPUT_VARIABLE assembly
+        ERROR_VARIABLE errors
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Compiling ${SOURCE} failed:\n${errors}")
+    endif()
+    string(REPLACE "\n" ";" lines "${assembly}")
+    set(${output} "${lines}" PARENT_SCOPE)
+endfunction()
+
+# Sets output to "function: instruction" for every instruction in lines that
+# matches pattern
+function(find_instructions lines pattern output)
+    set(function "")
+    set(found "")
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^([A-Za-z_][A-Za-z0-9_]*):")
+            set(function "${CMAKE_MATCH_1}")
+        elseif(line MATCHES "^[ \t]+[a-z]" AND line MATCHES "${pattern}")
+            string(STRIP "${line}" instruction)
+            list(APPEND found "${function}: ${instruction}")
+        endif()
+    endforeach()
+    set(${output} "${found}" PARENT_SCOPE)
+endfunction()
+
+compile_to_assembly(lines)
+find_instructions("${lines}" "\\(%[re]?[sb]p\\)|\\[[re]?[sb]p[^]]*\\]" failures)
+if(failures)
+    list(JOIN failures "\n  " report)
+    message(FATAL_ERROR "Stack accesses in reproducible arithmetic:\n  ${report}")
+endif()
+message(STATUS "No stack accesses found")
+
+compile_to_assembly(lines -mfma -ffp-contract=fast -ftree-vectorize)
+find_instructions("${lines}" "^[ \t]+vfn?m(add|sub)" failures)
+if(failures)
+    list(JOIN failures "\n  " report)
+    message(FATAL_ERROR "Contracted reproducible arithmetic:\n  ${report}")
+endif()
+message(STATUS "No contracted operations found")
+
+compile_to_assembly(lines -ffast-math -ftree-vectorize)
+find_instructions("${lines}" "^[ \t]+v?mul[ps][sd]" failures)
+list(FILTER failures INCLUDE REGEX "^[a-z_]+_divide:")
+if(failures)
+    list(JOIN failures "\n  " report)
+    message(FATAL_ERROR "Division by a reciprocal:\n  ${report}")
+endif()
+message(STATUS "No divisions by a reciprocal found")
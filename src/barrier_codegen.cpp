@@ -0,0 +1,86 @@
+// Compiled to assembly by barrier_codegen.cmake, which fails if any of these
+// functions touch the stack. Every value lives in a register from argument
+// to return, so an optimization barrier that forces a spill shows up as a
+// store here.
+#include <cstddef>
+#include <rexpr>
+#include <rfloat>
+#include <rfma>
+#include <rsimd>
+#include <rtranscendental>
+
+extern "C" {
+
+double rdouble_sum(double a, double b, double c) {
+    return (rdouble(a) + b + c).underlying_value();
+}
+
+double rdouble_mul_add(double a, double b, double c) {
+    return (rdouble(a) * b + c).underlying_value();
+}
+
+float rfloat_mul_add(float a, float b, float c) {
+    return (rfloat(a) * b + c).underlying_value();
+}
+
+float rfloat_chain(float a, float b, float c, float d) {
+    rfloat x = a;
+    x += b;
+    x *= c;
+    x -= d;
+    x /= a;
+    return x.underlying_value();
+}
+
+double rdouble_polynomial(double x) {
+    rdouble result = 1.0;
+    result = result * x + 0.5;
+    result = result * x + 0.25;
+    result = result * x + 0.125;
+    result = result * x + 0.0625;
+    return result.underlying_value();
+}
+
+// A loop the vectorizer can work on, which must not be contracted either
+void rdouble_axpy(std::size_t n, double a, const rdouble *x, rdouble *y) {
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = y[i] - a * x[i];
+    }
+}
+
+// With reciprocal math, a divisor shared by the whole loop must not be
+// turned into a multiplication by its reciprocal
+void rdouble_divide(std::size_t n, double d, rdouble *x) {
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = x[i] / d;
+    }
+}
+
+void rdouble_fma_divide(std::size_t n, double d, rdouble_fma *x) {
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = x[i] / d;
+    }
+}
+
+void rexpr_divide(std::size_t n, double d, rdouble *x) {
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = rstd::lazy(x[i]) / d;
+    }
+}
+
+// The division kernel of <rtranscendental> and <rdd>, whose long division
+// divides by the same b.hi three times
+void crmath_divide(std::size_t n, double d, double *x) {
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = rstd::detail::crmath::div(x[i], d);
+    }
+}
+
+rfloat4 rfloat4_mul_add(rfloat4 a, rfloat4 b, rfloat4 c) {
+    return a * b + c;
+}
+
+rdouble2 rdouble2_mul_add(rdouble2 a, rdouble2 b, rdouble2 c) {
+    return a * b + c;
+}
+}
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Builds and runs the linpack and whetstone benchmarks over a matrix of
+compilers, COMPILE_OPTIONS, barrier strategies and problem sizes, and writes
+summary statistics as CSV and JSON.
+
+Every combination of --compiler, --options and --barrier is configured in its
+own build directory with RFLOAT_BENCHMARKS enabled. The double and rdouble
+versions of each benchmark are run --repetitions times per size, alternating
+between the two so that drift on the machine affects both equally. With
+--cpu, every run is pinned to that CPU.
+
+Example, regenerating benchmarking_rfloat.csv:
+
+    benchmark_matrix.py --compiler g++ --compiler clang++ \\
+        --options=-O2 --options=-O3 --barrier default --barrier asm \\
+        --csv benchmarking_rfloat.csv --json benchmarking_rfloat.json
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+
+SOURCE_DIR = os.path.dirname(
+    os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+# The benchmarks, and how to read their score. Higher is better for both.
+BENCHMARKS = {
+    "linpack": {
+        "targets": {"double": "linpack_bench_double",
+                    "rdouble": "linpack_bench_rdouble"},
+        # The last row of the table is the run that took long enough
+        "pattern": re.compile(r"^\s*\d+\s+[\d.]+\s+.*?([\d.]+)\s*$",
+                              re.MULTILINE),
+        "unit": "KFLOPS",
+    },
+    "whetstone": {
+        "targets": {"double": "whetstone_bench_double",
+                    "rdouble": "whetstone_bench_rdouble"},
+        "pattern": re.compile(r"Whetstones:\s*([\d.]+)\s*(MWIPS|KWIPS)"),
+        "unit": "MWIPS",
+    },
+}
+
+BARRIERS = {
+    "default": [],
+    "asm": ["-DBARRIER_IMPL_ASM"],
+}
+
+CSV_COLUMNS = ["compiler", "compiler_version", "options", "barrier",
+               "benchmark", "size", "type", "unit", "runs", "mean", "median",
+               "stdev", "min", "max", "overhead_percent"]
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n\n")[0],
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", action="append",
+                        help="C++ compiler to build with (repeatable, "
+                             "default: c++)")
+    parser.add_argument("--options", action="append",
+                        help="COMPILE_OPTIONS, separated by spaces "
+                             "(repeatable, default: -O2 and -O3)")
+    parser.add_argument("--barrier", action="append", choices=BARRIERS,
+                        help="barrier strategy (repeatable, default: both)")
+    parser.add_argument("--benchmark", action="append", choices=BENCHMARKS,
+                        help="benchmark to run (repeatable, default: all)")
+    parser.add_argument("--linpack-size", action="append", type=int,
+                        help="linpack array size (repeatable, default: 200)")
+    parser.add_argument("--whetstone-loops", action="append", type=int,
+                        help="whetstone loop count (repeatable, "
+                             "default: 1000000)")
+    parser.add_argument("--repetitions", type=int, default=5,
+                        help="runs of each benchmark (default: 5)")
+    parser.add_argument("--cpu", type=int,
+                        help="pin every benchmark run to this CPU")
+    parser.add_argument("--build-dir",
+                        default=os.path.join(SOURCE_DIR, "_benchmark_matrix"),
+                        help="where the builds go")
+    parser.add_argument("--cmake-arg", action="append", default=[],
+                        help="extra argument for every CMake configure")
+    parser.add_argument("--csv", default="benchmark_matrix.csv",
+                        help="summary CSV (default: benchmark_matrix.csv)")
+    parser.add_argument("--json", default="benchmark_matrix.json",
+                        help="summary and raw scores as JSON "
+                             "(default: benchmark_matrix.json)")
+    args = parser.parse_args()
+    args.compiler = args.compiler or ["c++"]
+    args.options = args.options or ["-O2", "-O3"]
+    args.barrier = args.barrier or list(BARRIERS)
+    args.benchmark = args.benchmark or list(BENCHMARKS)
+    args.linpack_size = args.linpack_size or [200]
+    args.whetstone_loops = args.whetstone_loops or [1000000]
+    if args.repetitions < 1:
+        parser.error("--repetitions must be at least 1")
+    if args.cpu is not None and hasattr(os, "sched_getaffinity") and \
+            args.cpu not in os.sched_getaffinity(0):
+        parser.error("CPU %d isn't available to this process" % args.cpu)
+    return args
+
+
+def log(message):
+    print(message, file=sys.stderr, flush=True)
+
+
+def compiler_version(compiler):
+    try:
+        output = subprocess.run([compiler, "--version"], capture_output=True,
+                                text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+    return output.splitlines()[0].strip() if output else "unknown"
+
+
+def build(args, compiler, options, barrier):
+    name = re.sub(r"[^A-Za-z0-9.+-]+", "_",
+                  "-".join([os.path.basename(compiler), options, barrier]))
+    build_dir = os.path.join(args.build_dir, name)
+    compile_options = options.split() + BARRIERS[barrier]
+    targets = [target for benchmark in args.benchmark
+               for target in BENCHMARKS[benchmark]["targets"].values()]
+    configure = ["cmake", "-S", SOURCE_DIR, "-B", build_dir,
+                 "-DCMAKE_BUILD_TYPE=Release",
+                 "-DCMAKE_CXX_COMPILER=" + compiler,
+                 "-DCOMPILE_OPTIONS=" + ";".join(compile_options),
+                 "-DRFLOAT_BENCHMARKS=ON"] + args.cmake_arg
+    log("Building %s" % name)
+    subprocess.run(configure, check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(["cmake", "--build", build_dir, "-j", str(os.cpu_count()),
+                    "--target"] + targets, check=True,
+                   stdout=subprocess.DEVNULL)
+    return os.path.join(build_dir, "src", "benchmarks")
+
+
+def pin(cpu):
+    if cpu is None:
+        return None
+    if hasattr(os, "sched_setaffinity"):
+        return lambda: os.sched_setaffinity(0, {cpu})
+    log("warning: CPU pinning isn't supported on this platform")
+    return None
+
+
+def run_once(args, executable, benchmark, size):
+    spec = BENCHMARKS[benchmark]
+    result = subprocess.run([executable, str(size)], capture_output=True,
+                            text=True, stdin=subprocess.DEVNULL,
+                            preexec_fn=pin(args.cpu), check=True)
+    matches = spec["pattern"].findall(result.stdout)
+    if not matches:
+        raise RuntimeError("no score in the output of %s:\n%s" %
+                           (executable, result.stdout))
+    match = matches[-1]
+    if isinstance(match, tuple):
+        value, unit = match
+        return float(value) / (1000.0 if unit == "KWIPS" else 1.0)
+    return float(match)
+
+
+def summarize(scores):
+    return {
+        "runs": len(scores),
+        "mean": statistics.mean(scores),
+        "median": statistics.median(scores),
+        "stdev": statistics.stdev(scores) if len(scores) > 1 else 0.0,
+        "min": min(scores),
+        "max": max(scores),
+    }
+
+
+def sizes_for(args, benchmark):
+    return args.linpack_size if benchmark == "linpack" else \
+        args.whetstone_loops
+
+
+def main():
+    args = parse_arguments()
+    if shutil.which("cmake") is None:
+        sys.exit("cmake isn't on the PATH")
+
+    rows = []
+    for compiler in args.compiler:
+        version = compiler_version(compiler)
+        for options in args.options:
+            for barrier in args.barrier:
+                directory = build(args, compiler, options, barrier)
+                for benchmark in args.benchmark:
+                    spec = BENCHMARKS[benchmark]
+                    for size in sizes_for(args, benchmark):
+                        scores = {kind: [] for kind in spec["targets"]}
+                        for repetition in range(args.repetitions):
+                            for kind, target in spec["targets"].items():
+                                executable = os.path.join(directory, target)
+                                scores[kind].append(
+                                    run_once(args, executable, benchmark,
+                                             size))
+                            log("%s %s %s %s %d: run %d/%d" %
+                                (compiler, options, barrier, benchmark, size,
+                                 repetition + 1, args.repetitions))
+                        plain = statistics.median(scores["double"])
+                        for kind, values in scores.items():
+                            row = {"compiler": compiler,
+                                   "compiler_version": version,
+                                   "options": options, "barrier": barrier,
+                                   "benchmark": benchmark, "size": size,
+                                   "type": kind, "unit": spec["unit"]}
+                            row.update(summarize(values))
+                            # How much slower rdouble is than double, from
+                            # the medians
+                            row["overhead_percent"] = \
+                                100.0 * (plain - row["median"]) / plain
+                            row["scores"] = values
+                            rows.append(row)
+
+    with open(args.csv, "w") as csv:
+        csv.write(",".join(CSV_COLUMNS) + "\n")
+        for row in rows:
+            fields = []
+            for column in CSV_COLUMNS:
+                value = row[column]
+                if isinstance(value, float):
+                    value = "%.6g" % value
+                value = str(value)
+                if "," in value or '"' in value:
+                    value = '"%s"' % value.replace('"', '""')
+                fields.append(value)
+            csv.write(",".join(fields) + "\n")
+
+    context = {
+        "date": datetime.datetime.now().isoformat(timespec="seconds"),
+        "host": platform.node(),
+        "machine": platform.machine(),
+        "system": platform.platform(),
+        "cpu": args.cpu,
+        "repetitions": args.repetitions,
+    }
+    with open(args.json, "w") as out:
+        json.dump({"context": context, "results": rows}, out, indent=2)
+    log("Wrote %s and %s" % (args.csv, args.json))
+
+
+if __name__ == "__main__":
+    main()
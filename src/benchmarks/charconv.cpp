@@ -0,0 +1,144 @@
+// Compares writing rdouble values as text through an iostream with
+// setprecision(17), through the rstd::shortest manipulator, and with
+// rstd::to_chars into a buffer, then reading them back through an iostream,
+// through the rstd::parse manipulator, and with rstd::parse_values.
+//
+// Usage: charconv_bench [count]
+//
+// count random values (default 1000000) are written one after the other,
+// separated by spaces, the way a checkpoint file would be. Each method is
+// timed over the whole array, best of 5.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <rcharconv>
+#include <rfloat>
+
+namespace {
+
+constexpr int repetitions = 5;
+
+template <typename F> double best_ns_per_value(F run, std::size_t count) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(count));
+    }
+    return best;
+}
+
+std::size_t sink = 0;
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t count =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    // Values spread over many magnitudes, as simulation state usually is
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::vector<rdouble> values(count);
+    for (auto &v : values) {
+        v = mantissa(gen) * std::pow(10.0, exponent(gen));
+    }
+
+    const double stream = best_ns_per_value(
+        [&] {
+            std::ostringstream out;
+            out << std::setprecision(17);
+            for (const auto &v : values) {
+                out << v << ' ';
+            }
+            sink += out.str().size();
+        },
+        count);
+    const double manipulator = best_ns_per_value(
+        [&] {
+            std::ostringstream out;
+            for (const auto &v : values) {
+                out << rstd::shortest(v) << ' ';
+            }
+            sink += out.str().size();
+        },
+        count);
+    std::string text(count * (rstd::shortest_chars_max<double> + 1), '\0');
+    const double buffer = best_ns_per_value(
+        [&] {
+            char *next = &text[0];
+            char *const last = next + text.size();
+            for (const auto &v : values) {
+                next = rstd::to_chars(next, last, v).ptr;
+                *next++ = ' ';
+            }
+            sink += std::size_t(next - text.data());
+        },
+        count);
+
+    text.resize(std::size_t(std::find(text.begin(), text.end(), '\0') -
+                            text.begin()));
+    const double stream_in = best_ns_per_value(
+        [&] {
+            std::istringstream in(text);
+            rdouble value;
+            while (in >> value) {
+                sink += value == 0.0;
+            }
+        },
+        count);
+    const double manipulator_in = best_ns_per_value(
+        [&] {
+            std::istringstream in(text);
+            rdouble value;
+            while (in >> rstd::parse(value)) {
+                sink += value == 0.0;
+            }
+        },
+        count);
+    std::vector<rdouble> parsed;
+    parsed.reserve(count);
+    const double bulk = best_ns_per_value(
+        [&] {
+            parsed.clear();
+            rstd::parse_values(text.data(), text.data() + text.size(), parsed);
+            sink += parsed.size();
+        },
+        count);
+    if (parsed != values) {
+        std::printf("rstd::parse_values didn't round-trip\n");
+        return 1;
+    }
+    // Bytes of text per nanosecond is GB/s
+    const double bytes = double(text.size()) / double(count);
+
+    std::printf("Formatting %zu rdouble values (nanoseconds per value)\n",
+                count);
+    std::printf("%-32s %8.1f\n", "ostream, setprecision(17)", stream);
+    std::printf("%-32s %8.1f %6.1fx\n", "ostream, rstd::shortest", manipulator,
+                stream / manipulator);
+    std::printf("%-32s %8.1f %6.1fx\n", "rstd::to_chars", buffer,
+                stream / buffer);
+    std::printf("\nParsing %.1f MB of text (nanoseconds per value, GB/s)\n",
+                double(text.size()) * 1e-6);
+    std::printf("%-32s %8.1f %6.2f\n", "istream", stream_in,
+                bytes / stream_in);
+    std::printf("%-32s %8.1f %6.2f %6.1fx\n", "istream, rstd::parse",
+                manipulator_in, bytes / manipulator_in,
+                stream_in / manipulator_in);
+    std::printf("%-32s %8.1f %6.2f %6.1fx\n", "rstd::parse_values", bulk,
+                bytes / bulk, stream_in / bulk);
+    return sink == 0 ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+// Times complex multiplication, division and abs over arrays of rdouble
+// values against std::complex<double>: one element at a time with
+// rstd::complex<rdouble>, and with the split real and imaginary arrays of
+// rstd::batch.
+//
+// Usage: complex_bench [count]
+//
+// Each operation runs over count elements (default 4096) 1000 times, best
+// of 5.
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <rcomplex>
+#include <rfloat>
+
+namespace {
+
+constexpr int repetitions = 5;
+constexpr int passes = 1000;
+
+template <typename F> double best_ns_per_element(F run, std::size_t count) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; ++pass) {
+            run();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(count) / passes);
+    }
+    return best;
+}
+
+volatile double sink;
+
+struct Operands {
+    std::vector<std::complex<double>> std_lhs;
+    std::vector<std::complex<double>> std_rhs;
+    std::vector<rstd::complex<rdouble>> lhs;
+    std::vector<rstd::complex<rdouble>> rhs;
+    std::vector<rdouble> lhs_real;
+    std::vector<rdouble> lhs_imag;
+    std::vector<rdouble> rhs_real;
+    std::vector<rdouble> rhs_imag;
+
+    explicit Operands(std::size_t count) {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> dist(-4, 4);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::complex<double> a(dist(gen), dist(gen));
+            const std::complex<double> b(dist(gen), dist(gen));
+            std_lhs.push_back(a);
+            std_rhs.push_back(b);
+            lhs.push_back(a);
+            rhs.push_back(b);
+            lhs_real.push_back(a.real());
+            lhs_imag.push_back(a.imag());
+            rhs_real.push_back(b.real());
+            rhs_imag.push_back(b.imag());
+        }
+    }
+};
+
+void report(const char *name, double standard, double scalar, double batch) {
+    std::printf("%-5s std::complex %6.2f ns, rstd::complex %6.2f ns (%.1fx), "
+                "batch %6.2f ns (%.1fx)\n",
+                name, standard, scalar, scalar / standard, batch,
+                batch / standard);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t count =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    const Operands x(count);
+
+    std::vector<std::complex<double>> std_out(count);
+    std::vector<rstd::complex<rdouble>> out(count);
+    std::vector<rdouble> real(count);
+    std::vector<rdouble> imag(count);
+
+    const auto time_std = [&](auto op) {
+        return best_ns_per_element(
+            [&] {
+                for (std::size_t i = 0; i < count; ++i) {
+                    std_out[i] = op(x.std_lhs[i], x.std_rhs[i]);
+                }
+                sink = std_out[count / 2].real();
+            },
+            count);
+    };
+    const auto time_scalar = [&](auto op) {
+        return best_ns_per_element(
+            [&] {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = op(x.lhs[i], x.rhs[i]);
+                }
+                sink = out[count / 2].real().underlying_value();
+            },
+            count);
+    };
+    const auto time_batch = [&](auto op) {
+        return best_ns_per_element(
+            [&] {
+                op();
+                sink = real[count / 2].underlying_value();
+            },
+            count);
+    };
+
+    report(
+        "mul", time_std([](auto a, auto b) { return a * b; }),
+        time_scalar([](auto a, auto b) { return a * b; }), time_batch([&] {
+            rstd::batch::complex_multiply(
+                x.lhs_real.data(), x.lhs_imag.data(), x.rhs_real.data(),
+                x.rhs_imag.data(), count, real.data(), imag.data());
+        }));
+    report(
+        "div", time_std([](auto a, auto b) { return a / b; }),
+        time_scalar([](auto a, auto b) { return a / b; }), time_batch([&] {
+            rstd::batch::complex_divide(
+                x.lhs_real.data(), x.lhs_imag.data(), x.rhs_real.data(),
+                x.rhs_imag.data(), count, real.data(), imag.data());
+        }));
+    report(
+        "abs",
+        time_std([](auto a, auto) { return std::complex<double>(std::abs(a)); }),
+        time_scalar(
+            [](auto a, auto) { return rstd::complex<rdouble>(rstd::abs(a)); }),
+        time_batch([&] {
+            rstd::batch::complex_abs(x.lhs_real.data(), x.lhs_imag.data(),
+                                     count, real.data());
+        }));
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Times each rdouble_dd operation against the same operation on rdouble,
+// as a dependent chain, so the ratio is roughly the number of double
+// operations one double-double operation costs.
+//
+// Usage: dd_bench [count]
+//
+// Each operation runs count times (default 10000000), best of 5.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include <rdd>
+#include <rfloat>
+
+namespace {
+
+constexpr int repetitions = 5;
+
+template <typename F> double best_ns_per_op(F run, std::size_t count) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(count));
+    }
+    return best;
+}
+
+volatile double sink;
+// Read at run time, so that the compiler can't fold the chains
+volatile double start_value = 1.0;
+volatile double step = 1.0 + 0x1p-20;
+
+// x stays close to 1 through every operation, so nothing overflows
+template <typename T, typename Op>
+double time_op(std::size_t count, Op op) {
+    return best_ns_per_op(
+        [&] {
+            T x = double(start_value);
+            const T y = double(step);
+            for (std::size_t i = 0; i < count; ++i) {
+                x = op(x, y);
+            }
+            sink = x.fp64();
+        },
+        count);
+}
+
+template <typename Op>
+void report(const char *name, std::size_t count, Op op) {
+    const double plain = time_op<rdouble>(count, op);
+    const double dd = time_op<rdouble_dd>(count, op);
+    std::printf("%-8s rdouble %6.2f ns, rdouble_dd %6.2f ns (%.1fx)\n", name,
+                plain, dd, dd / plain);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t count =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    report("add+sub", count, [](auto x, auto y) { return x + y - y; });
+    report("mul", count, [](auto x, auto y) { return x * y; });
+    report("div", count, [](auto x, auto y) { return x / y; });
+    report("sqrt", count, [](auto x, auto y) { return rstd::sqrt(x * y); });
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Times rstd::fft::plan<rdouble> against a textbook radix-2 transform on
+// double, for each power-of-two size from 64 up to a maximum.
+// Both are reported in FFTW's units, 5 n log2(n) / time in microseconds
+// ("mflops"), so that they can be put next to FFTW's own benchmark on the
+// same machine.
+//
+// Usage: fft_bench [max_size]
+//
+// Each size runs for about 0.2 s, best of 5. max_size defaults to 65536.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <rcomplex>
+#include <rfft>
+#include <rfloat>
+
+namespace {
+
+constexpr int repetitions = 5;
+constexpr double pi = 3.14159265358979323846;
+
+template <typename F> double best_ns(F run, std::size_t passes) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            run();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(passes));
+    }
+    return best;
+}
+
+volatile double sink;
+
+// In-place iterative radix-2 on separate real and imaginary arrays,
+// decimated in time, with precomputed roots
+class Radix2 {
+  public:
+    explicit Radix2(std::size_t n) : m_root_re(n / 2), m_root_im(n / 2) {
+        for (std::size_t k = 0; k < n / 2; ++k) {
+            const double angle = 2 * pi * double(k) / double(n);
+            m_root_re[k] = std::cos(angle);
+            m_root_im[k] = -std::sin(angle);
+        }
+    }
+
+    void operator()(std::vector<double> &re, std::vector<double> &im) const {
+        const std::size_t n = re.size();
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+        for (std::size_t length = 2; length <= n; length *= 2) {
+            const std::size_t half = length / 2;
+            const std::size_t step = n / length;
+            for (std::size_t i = 0; i < n; i += length) {
+                for (std::size_t k = 0; k < half; ++k) {
+                    const double w_re = m_root_re[k * step];
+                    const double w_im = m_root_im[k * step];
+                    const double a = re[i + k + half];
+                    const double b = im[i + k + half];
+                    const double v_re = a * w_re - b * w_im;
+                    const double v_im = a * w_im + b * w_re;
+                    re[i + k + half] = re[i + k] - v_re;
+                    im[i + k + half] = im[i + k] - v_im;
+                    re[i + k] += v_re;
+                    im[i + k] += v_im;
+                }
+            }
+        }
+    }
+
+  private:
+    std::vector<double> m_root_re;
+    std::vector<double> m_root_im;
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t max_size =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 65536;
+
+    std::printf("mflops\n%8s %12s %12s %12s\n", "n", "radix-2", "rfft",
+                "rfft split");
+    for (std::size_t n = 64; n <= max_size; n *= 2) {
+        std::mt19937_64 gen(n);
+        std::uniform_real_distribution<double> dist(-1, 1);
+        std::vector<std::complex<double>> signal(n);
+        std::vector<rstd::complex<rdouble>> rsignal(n);
+        std::vector<rdouble> re(n);
+        std::vector<rdouble> im(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            signal[i] = {dist(gen), dist(gen)};
+            rsignal[i] = signal[i];
+            re[i] = signal[i].real();
+            im[i] = signal[i].imag();
+        }
+        const double flops = 5.0 * double(n) * std::log2(double(n));
+        const std::size_t passes =
+            std::max<std::size_t>(1, std::size_t(4e7 / flops));
+
+        const Radix2 radix2(n);
+        std::vector<double> plain_re(n);
+        std::vector<double> plain_im(n);
+        const double plain = best_ns(
+            [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    plain_re[i] = signal[i].real();
+                    plain_im[i] = signal[i].imag();
+                }
+                radix2(plain_re, plain_im);
+                sink = plain_re[1];
+            },
+            passes);
+
+        const rstd::fft::plan<rdouble> plan(n);
+        std::vector<rstd::complex<rdouble>> out(n);
+        const double interleaved = best_ns(
+            [&] {
+                plan.forward(rsignal.data(), out.data());
+                sink = out[1].real().underlying_value();
+            },
+            passes);
+
+        std::vector<rdouble> out_re(n);
+        std::vector<rdouble> out_im(n);
+        const double split = best_ns(
+            [&] {
+                plan.forward(re.data(), im.data(), out_re.data(),
+                             out_im.data());
+                sink = out_re[1].underlying_value();
+            },
+            passes);
+
+        std::printf("%8zu %12.0f %12.0f %12.0f\n", n, 1000 * flops / plain,
+                    1000 * flops / interleaved, 1000 * flops / split);
+    }
+    return 0;
+}
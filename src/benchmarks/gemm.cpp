@@ -0,0 +1,96 @@
+// Times rstd::linalg::multiply on square rdouble matrices against a plain
+// double loop, and checks that every thread count gives the same bits.
+//
+// Usage: gemm_bench [n] [threads...]
+//
+// n defaults to 1024, and the thread counts to 1 and the number of hardware
+// threads. The double baseline is the i-k-j loop the compiler is free to
+// vectorize and contract, so it shows what the fixed order of operations
+// costs rather than what blocking gains.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <rlinalg>
+
+namespace {
+
+template <typename F> double seconds(F run) {
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+void report(const char *name, std::size_t n, double time) {
+    const double flops = 2.0 * double(n) * double(n) * double(n);
+    std::printf("%-24s %10.3f s %10.2f GFLOP/s\n", name, time,
+                flops / time * 1e-9);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1024;
+    std::vector<std::size_t> thread_counts;
+    for (int i = 2; i < argc; ++i) {
+        thread_counts.push_back(std::strtoul(argv[i], nullptr, 10));
+    }
+    if (thread_counts.empty()) {
+        thread_counts = {1, std::max(1u, std::thread::hardware_concurrency())};
+    }
+
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<double> a(n * n), b(n * n);
+    for (auto &v : a) {
+        v = dis(gen);
+    }
+    for (auto &v : b) {
+        v = dis(gen);
+    }
+
+    std::vector<double> c(n * n, 0.0);
+    report("double i-k-j loop", n, seconds([&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   for (std::size_t k = 0; k < n; ++k) {
+                       const double scale = a[i * n + k];
+                       for (std::size_t j = 0; j < n; ++j) {
+                           c[i * n + j] += scale * b[k * n + j];
+                       }
+                   }
+               }
+           }));
+
+    const std::vector<rdouble> ra(a.begin(), a.end());
+    const std::vector<rdouble> rb(b.begin(), b.end());
+    std::vector<rdouble> first;
+    bool identical = true;
+    for (std::size_t threads : thread_counts) {
+        rstd::execution::thread_pool pool(threads);
+        std::vector<rdouble> rc(n * n);
+        char name[64];
+        std::snprintf(name, sizeof(name), "rdouble, %zu thread%s", threads,
+                      threads == 1 ? "" : "s");
+        report(name, n, seconds([&] {
+                   rstd::linalg::multiply(
+                       rstd::execution::deterministic_par.on(pool), n, n, n,
+                       ra.data(), n, rb.data(), n, rc.data(), n);
+               }));
+        if (first.empty()) {
+            first = rc;
+        } else if (std::memcmp(first.data(), rc.data(),
+                               n * n * sizeof(rdouble)) != 0) {
+            identical = false;
+        }
+    }
+    std::printf("Results %s across thread counts\n",
+                identical ? "identical" : "DIFFER");
+    return identical ? 0 : 1;
+}
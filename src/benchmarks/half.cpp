@@ -0,0 +1,94 @@
+// Compares converting arrays between rfloat and the 16-bit storage types of
+// <rhalf> with rstd::widen and rstd::narrow against converting one value at
+// a time, next to a plain copy of the float array for scale.
+//
+// Usage: half_bench [count]
+//
+// count values (default 4000000) are converted each way, best of 5.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <rfloat>
+#include <rhalf>
+
+namespace {
+
+constexpr int repetitions = 5;
+
+template <typename F> double best_ns_per_value(F run, std::size_t count) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(count));
+    }
+    return best;
+}
+
+template <typename H>
+void bench(const char *name, const std::vector<rfloat> &values) {
+    const std::size_t count = values.size();
+    std::vector<H> stored(count);
+    std::vector<rfloat> loaded(count);
+
+    const double narrow_scalar = best_ns_per_value(
+        [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                stored[i] = H(values[i]);
+            }
+        },
+        count);
+    const double narrow_bulk =
+        best_ns_per_value([&] { rstd::narrow(values, stored); }, count);
+    const double widen_scalar = best_ns_per_value(
+        [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                loaded[i] = static_cast<rfloat>(stored[i]);
+            }
+        },
+        count);
+    const double widen_bulk =
+        best_ns_per_value([&] { rstd::widen(stored, loaded); }, count);
+
+    std::printf("%-10s narrow %6.3f ns/value, rstd::narrow %6.3f ns/value "
+                "(%.1fx)\n",
+                name, narrow_scalar, narrow_bulk, narrow_scalar / narrow_bulk);
+    std::printf("%-10s widen  %6.3f ns/value, rstd::widen  %6.3f ns/value "
+                "(%.1fx)\n",
+                name, widen_scalar, widen_bulk, widen_scalar / widen_bulk);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t count =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000000;
+
+    std::mt19937 gen(1);
+    std::normal_distribution<float> dis(0, 10);
+    std::vector<rfloat> values(count);
+    for (auto &v : values) {
+        v = dis(gen);
+    }
+
+    std::vector<rfloat> copy(count);
+    const double copy_time = best_ns_per_value(
+        [&] {
+            std::memcpy(static_cast<void *>(copy.data()), values.data(),
+                        count * sizeof(rfloat));
+        },
+        count);
+    std::printf("%-10s memcpy %6.3f ns/value\n", "rfloat", copy_time);
+
+    bench<rhalf>("rhalf", values);
+    bench<rbfloat16>("rbfloat16", values);
+    return 0;
+}
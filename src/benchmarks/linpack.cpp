@@ -100,7 +100,7 @@ static void *mempool;
 int main(int argc, char **argv)
 
 {
-    char buf[80];
+    char buf[80] = "";
     int arsize;
     long arsize2d, nreps;
     size_t malloc_arg;
@@ -0,0 +1,434 @@
+// Latency and throughput of every ReproducibleWrapper operator and rstd::
+// function, for rfloat and rdouble next to the float and double they wrap.
+//
+// Usage: rfloat_microbench [--filter=<substring>] [--min_time=<ms>]
+//                          [--repetitions=<n>] [--out=<file>]
+//
+// The results are written as JSON in the same layout as Google Benchmark's
+// --benchmark_format=json, so the usual comparison tools can read them.
+// Each benchmark is named "<function>/<type>/<latency|throughput>" and
+// carries the time per call in nanoseconds, plus the ratio to the plain
+// type for rfloat and rdouble.
+//
+// Latency is measured as a chain where every argument depends on the
+// previous result through a multiply-add with an opaque zero. That adds the
+// same constant to every type, so compare ratios rather than absolute
+// latencies. Throughput is measured over independent arguments.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <rcmath>
+#include <rfloat>
+
+namespace {
+
+constexpr std::size_t argument_count = 1024;
+
+struct Options {
+    std::string filter;
+    double min_time_ns = 5e6;
+    int repetitions = 3;
+    const char *output = nullptr;
+};
+
+struct Result {
+    std::string function;
+    std::string type;
+    std::string mode;
+    std::size_t iterations;
+    double ns;
+    double ratio; // to the plain type, or 0 for the plain types themselves
+};
+
+struct Domain {
+    double min;
+    double max;
+};
+
+constexpr Domain everywhere = {-10, 10};
+constexpr Domain positive = {0.125, 100};
+
+template <typename V> const char *type_name();
+template <> const char *type_name<float>() { return "float"; }
+template <> const char *type_name<double>() { return "double"; }
+template <> const char *type_name<rfloat>() { return "rfloat"; }
+template <> const char *type_name<rdouble>() { return "rdouble"; }
+
+// Loaded at run time so that the optimizer can't remove the dependency
+volatile double volatile_zero = 0.0;
+
+double sink = 0;
+
+template <typename V> double to_double(const V &x) { return double(x); }
+template <typename T, rmath::RoundingMode R>
+double to_double(const rstd::ReproducibleWrapper<T, R> &x) {
+    return double(x.underlying_value());
+}
+
+// rfloat can't be constructed from a double without a cast
+template <typename V> V from_double(double x) { return V(x); }
+template <> rfloat from_double<rfloat>(double x) { return float(x); }
+
+template <typename V>
+std::vector<V> arguments(const Domain &domain, unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> dis(domain.min, domain.max);
+    std::vector<V> values(argument_count);
+    for (auto &v : values) {
+        v = from_double<V>(dis(gen));
+    }
+    return values;
+}
+
+// Runs body(passes) with enough passes to take min_time, and returns the
+// best time per call over the repetitions
+template <typename Body>
+double time_per_call(const Options &options, Body body,
+                     std::size_t &iterations) {
+    using clock = std::chrono::steady_clock;
+    std::size_t passes = 1;
+    for (;;) {
+        const auto start = clock::now();
+        body(passes);
+        const std::chrono::duration<double, std::nano> elapsed =
+            clock::now() - start;
+        if (elapsed.count() >= options.min_time_ns || passes >= (1u << 24)) {
+            break;
+        }
+        passes *= 2;
+    }
+    double best = 1e300;
+    for (int i = 0; i < options.repetitions; ++i) {
+        const auto start = clock::now();
+        body(passes);
+        const std::chrono::duration<double, std::nano> elapsed =
+            clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    iterations = passes * argument_count;
+    return best / double(iterations);
+}
+
+template <typename V, typename F>
+double latency(const Options &options, F f, const std::vector<V> &x,
+               const std::vector<V> &y, const std::vector<V> &z,
+               std::size_t &iterations) {
+    const V zero = from_double<V>(volatile_zero);
+    return time_per_call(
+        options,
+        [&](std::size_t passes) {
+            V previous = zero;
+            for (std::size_t pass = 0; pass < passes; ++pass) {
+                for (std::size_t i = 0; i < argument_count; ++i) {
+                    previous = f(x[i] + zero * previous, y[i], z[i]);
+                }
+            }
+            sink += to_double(previous);
+        },
+        iterations);
+}
+
+template <typename V, typename F>
+double throughput(const Options &options, F f, const std::vector<V> &x,
+                  const std::vector<V> &y, const std::vector<V> &z,
+                  std::size_t &iterations) {
+    std::vector<V> results(argument_count);
+    return time_per_call(
+        options,
+        [&](std::size_t passes) {
+            for (std::size_t pass = 0; pass < passes; ++pass) {
+                for (std::size_t i = 0; i < argument_count; ++i) {
+                    results[i] = f(x[i], y[i], z[i]);
+                }
+                sink += to_double(results[pass % argument_count]);
+            }
+        },
+        iterations);
+}
+
+template <typename V, typename F>
+void run(const Options &options, const char *function, F f, Domain dx,
+         Domain dy, Domain dz, double *plain_ns, std::vector<Result> &results) {
+    const auto x = arguments<V>(dx, 1);
+    const auto y = arguments<V>(dy, 2);
+    const auto z = arguments<V>(dz, 3);
+    const bool wrapped = plain_ns[0] != 0;
+    std::size_t iterations;
+    const double latency_ns = latency<V>(options, f, x, y, z, iterations);
+    results.push_back({function, type_name<V>(), "latency", iterations,
+                       latency_ns, wrapped ? latency_ns / plain_ns[0] : 0});
+    const double throughput_ns =
+        throughput<V>(options, f, x, y, z, iterations);
+    results.push_back({function, type_name<V>(), "throughput", iterations,
+                       throughput_ns,
+                       wrapped ? throughput_ns / plain_ns[1] : 0});
+    if (!wrapped) {
+        plain_ns[0] = latency_ns;
+        plain_ns[1] = throughput_ns;
+    }
+}
+
+// Benchmarks f for float, rfloat, double and rdouble. f takes three
+// arguments, drawn from dx, dy and dz, and ignores the ones it doesn't use.
+template <typename F>
+void bench(const Options &options, std::vector<Result> &results,
+           const char *function, F f, Domain dx = everywhere,
+           Domain dy = everywhere, Domain dz = everywhere) {
+    if (std::string(function).find(options.filter) == std::string::npos) {
+        return;
+    }
+    double float_ns[2] = {0, 0};
+    run<float>(options, function, f, dx, dy, dz, float_ns, results);
+    run<rfloat>(options, function, f, dx, dy, dz, float_ns, results);
+    double double_ns[2] = {0, 0};
+    run<double>(options, function, f, dx, dy, dz, double_ns, results);
+    run<rdouble>(options, function, f, dx, dy, dz, double_ns, results);
+    std::fprintf(stderr, "%s done\n", function);
+}
+
+template <typename T> void sincos_of(T x, T *sine, T *cosine) {
+    *sine = std::sin(x);
+    *cosine = std::cos(x);
+}
+
+template <typename T, rmath::RoundingMode R>
+void sincos_of(const rstd::ReproducibleWrapper<T, R> &x,
+               rstd::ReproducibleWrapper<T, R> *sine,
+               rstd::ReproducibleWrapper<T, R> *cosine) {
+    rstd::sincos(x, sine, cosine);
+}
+
+// Unqualified calls find std:: for the plain types and rstd:: for the
+// reproducible ones
+#define UNARY(name)                                                            \
+    [](auto x, auto, auto) {                                                   \
+        using std::name;                                                       \
+        return name(x);                                                        \
+    }
+#define BINARY(name)                                                           \
+    [](auto x, auto y, auto) {                                                 \
+        using std::name;                                                       \
+        return name(x, y);                                                     \
+    }
+
+void run_all(const Options &options, std::vector<Result> &results) {
+    // Operators
+    bench(options, results, "a + b",
+          [](auto x, auto y, auto) { return x + y; });
+    bench(options, results, "a - b",
+          [](auto x, auto y, auto) { return x - y; });
+    bench(options, results, "a * b",
+          [](auto x, auto y, auto) { return x * y; });
+    bench(options, results, "a / b",
+          [](auto x, auto y, auto) { return x / y; }, everywhere, positive);
+    bench(options, results, "a += b", [](auto x, auto y, auto) {
+        x += y;
+        return x;
+    });
+    bench(options, results, "a -= b", [](auto x, auto y, auto) {
+        x -= y;
+        return x;
+    });
+    bench(options, results, "a *= b", [](auto x, auto y, auto) {
+        x *= y;
+        return x;
+    });
+    bench(
+        options, results, "a /= b",
+        [](auto x, auto y, auto) {
+            x /= y;
+            return x;
+        },
+        everywhere, positive);
+    bench(options, results, "-a", [](auto x, auto, auto) { return -x; });
+    bench(options, results, "+a", [](auto x, auto, auto) { return +x; });
+    bench(options, results, "a * b + c",
+          [](auto x, auto y, auto z) { return x * y + z; });
+    bench(options, results, "a < b",
+          [](auto x, auto y, auto) { return x < y ? x : y; });
+    bench(options, results, "a == b",
+          [](auto x, auto y, auto) { return x == y ? y : x; });
+
+    // Basic operations
+    bench(options, results, "abs", UNARY(abs));
+    bench(options, results, "fmin", BINARY(fmin));
+    bench(options, results, "fmax", BINARY(fmax));
+    bench(options, results, "fdim", BINARY(fdim));
+    bench(options, results, "fmod", BINARY(fmod), everywhere, positive);
+    bench(options, results, "remainder", BINARY(remainder), everywhere,
+          positive);
+    bench(options, results, "ceil", UNARY(ceil));
+    bench(options, results, "floor", UNARY(floor));
+    bench(options, results, "trunc", UNARY(trunc));
+    bench(options, results, "round", UNARY(round));
+    bench(options, results, "nearbyint", UNARY(nearbyint));
+    bench(options, results, "rint", UNARY(rint));
+    bench(options, results, "sqrt", UNARY(sqrt), positive);
+    bench(options, results, "fma", [](auto x, auto y, auto z) {
+        using std::fma;
+        return fma(x, y, z);
+    });
+
+    // Exponential and logarithmic functions
+    bench(options, results, "exp", UNARY(exp));
+    bench(options, results, "exp2", UNARY(exp2));
+    bench(options, results, "expm1", UNARY(expm1));
+    bench(options, results, "log", UNARY(log), positive);
+    bench(options, results, "log2", UNARY(log2), positive);
+    bench(options, results, "log10", UNARY(log10), positive);
+    bench(options, results, "log1p", UNARY(log1p), positive);
+    bench(options, results, "pow", BINARY(pow), {0.5, 2}, everywhere);
+
+    // Trigonometric functions
+    bench(options, results, "sin", UNARY(sin));
+    bench(options, results, "cos", UNARY(cos));
+    bench(options, results, "tan", UNARY(tan));
+    bench(options, results, "sincos", [](auto x, auto, auto) {
+        decltype(x) sine;
+        decltype(x) cosine;
+        sincos_of(x, &sine, &cosine);
+        return sine + cosine;
+    });
+    bench(options, results, "atan", UNARY(atan));
+    bench(options, results, "atan2", BINARY(atan2));
+
+#if defined(RSTD_NONDETERMINISM)
+    // Functions that are only as reproducible as the standard library
+    bench(options, results, "cbrt", UNARY(cbrt));
+    bench(options, results, "hypot", BINARY(hypot));
+    bench(options, results, "asin", UNARY(asin), {-0.9, 0.9});
+    bench(options, results, "acos", UNARY(acos), {-0.9, 0.9});
+    bench(options, results, "sinh", UNARY(sinh));
+    bench(options, results, "cosh", UNARY(cosh));
+    bench(options, results, "tanh", UNARY(tanh));
+    bench(options, results, "asinh", UNARY(asinh));
+    bench(options, results, "acosh", UNARY(acosh), {1, 100});
+    bench(options, results, "atanh", UNARY(atanh), {-0.9, 0.9});
+    bench(options, results, "erf", UNARY(erf));
+    bench(options, results, "erfc", UNARY(erfc));
+    bench(options, results, "tgamma", UNARY(tgamma), {0.5, 10});
+    bench(options, results, "lgamma", UNARY(lgamma), positive);
+#endif /* defined(RSTD_NONDETERMINISM) */
+}
+
+#undef UNARY
+#undef BINARY
+
+const char *compiler() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+#define RSTD_STRINGIFY(x) #x
+#define RSTD_TO_STRING(x) RSTD_STRINGIFY(x)
+    return "msvc " RSTD_TO_STRING(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+void write_json(std::FILE *out, const Options &options,
+                const std::vector<Result> &results) {
+    char date[64];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z",
+                  std::localtime(&now));
+
+    std::fprintf(out, "{\n  \"context\": {\n");
+    std::fprintf(out, "    \"date\": \"%s\",\n", date);
+    std::fprintf(out, "    \"compiler\": \"%s\",\n", compiler());
+#if defined(RFLOAT_MICROBENCH_FLAGS)
+    std::fprintf(out, "    \"flags\": \"%s\",\n", RFLOAT_MICROBENCH_FLAGS);
+#endif
+    std::fprintf(out, "    \"nondeterminism\": %s,\n",
+#if defined(RSTD_NONDETERMINISM)
+                 "true"
+#else
+                 "false"
+#endif
+    );
+    std::fprintf(out,
+                 "    \"fenced_operators\": {\"+\": %d, \"-\": %d, \"*\": %d, "
+                 "\"/\": %d},\n",
+                 RSTD_FENCE_ADD, RSTD_FENCE_SUB, RSTD_FENCE_MUL,
+                 RSTD_FENCE_DIV);
+    std::fprintf(out, "    \"repetitions\": %d,\n", options.repetitions);
+    std::fprintf(out, "    \"library_build_type\": \"%s\"\n",
+#if defined(NDEBUG)
+                 "release"
+#else
+                 "debug"
+#endif
+    );
+    std::fprintf(out, "  },\n  \"benchmarks\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        std::fprintf(out,
+                     "    {\"name\": \"%s/%s/%s\", \"run_type\": \"iteration\", "
+                     "\"function\": \"%s\", \"type\": \"%s\", \"mode\": "
+                     "\"%s\", \"iterations\": %zu, \"real_time\": %.4f, "
+                     "\"cpu_time\": %.4f, \"time_unit\": \"ns\"",
+                     r.function.c_str(), r.type.c_str(), r.mode.c_str(),
+                     r.function.c_str(), r.type.c_str(), r.mode.c_str(),
+                     r.iterations, r.ns, r.ns);
+        if (r.ratio != 0) {
+            std::fprintf(out, ", \"ratio\": %.4f", r.ratio);
+        }
+        std::fprintf(out, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+bool parse_options(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            options.filter = arg + 9;
+        } else if (std::strncmp(arg, "--min_time=", 11) == 0) {
+            options.min_time_ns = std::atof(arg + 11) * 1e6;
+        } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            options.repetitions = std::max(1, std::atoi(arg + 14));
+        } else if (std::strncmp(arg, "--out=", 6) == 0) {
+            options.output = arg + 6;
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--filter=<substring>] [--min_time=<ms>] "
+                         "[--repetitions=<n>] [--out=<file>]\n",
+                         argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        return 2;
+    }
+    std::vector<Result> results;
+    run_all(options, results);
+
+    std::FILE *out = options.output ? std::fopen(options.output, "w") : stdout;
+    if (!out) {
+        std::perror(options.output);
+        return 1;
+    }
+    write_json(out, options, results);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return sink == 0.5 ? 1 : 0;
+}
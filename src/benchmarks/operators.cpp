@@ -0,0 +1,159 @@
+// Measures what the optimization barrier costs each arithmetic operator.
+//
+// Every operator is timed twice for rfloat / rdouble and for the plain type
+// they wrap: as a dependent chain (latency), and over arrays of independent
+// values (throughput). Build it with different RSTD_FENCE_* settings and
+// flags to see what fencing a particular operator costs, e.g.
+//
+//   operators_bench           every operator fenced (the default)
+//   operators_bench_unfenced  RSTD_FENCE_ADD/SUB/MUL/DIV=0
+//
+// The mul_add rows are the case fencing exists for: unfenced, the compiler
+// may contract them into an FMA when the target has one.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <rfloat>
+
+namespace {
+
+constexpr std::size_t chain_length = 1 << 24;
+constexpr std::size_t array_size = 4096;
+constexpr std::size_t array_passes = chain_length / array_size;
+constexpr int repetitions = 5;
+
+// Operands the optimizer can't see through, so that x * 1 and x / 1
+// aren't folded away
+volatile double volatile_step = 1e-3;
+volatile double volatile_one = 1.0;
+
+template <typename F> double best_ns_per_op(F run, std::size_t operations) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(operations));
+    }
+    return best;
+}
+
+template <typename V> double underlying(V x) { return double(x); }
+template <typename T, rmath::RoundingMode R>
+double underlying(rstd::ReproducibleWrapper<T, R> x) {
+    return double(x.underlying_value());
+}
+
+double sink = 0;
+
+template <typename V, typename Op>
+double latency(Op op, V step, V other = V(0)) {
+    return best_ns_per_op(
+        [&] {
+            V x = V(1);
+            for (std::size_t i = 0; i < chain_length; ++i) {
+                x = op(x, step, other);
+            }
+            sink += underlying(x);
+        },
+        chain_length);
+}
+
+template <typename V, typename Op>
+double throughput(Op op, V step, V other = V(0)) {
+    std::vector<V> values(array_size);
+    for (std::size_t i = 0; i < array_size; ++i) {
+        values[i] = V(1 + double(i) / array_size);
+    }
+    return best_ns_per_op(
+        [&] {
+            for (std::size_t pass = 0; pass < array_passes; ++pass) {
+                for (auto &x : values) {
+                    x = op(x, step, other);
+                }
+            }
+            sink += underlying(values[array_size / 2]);
+        },
+        array_passes * array_size);
+}
+
+template <typename Plain, typename Wrapped, typename Op>
+void report(const char *type, const char *name, Op op, double step) {
+    const double one = volatile_one;
+    const Plain plain_step = Plain(step);
+    const Wrapped wrapped_step = Wrapped(Plain(step));
+    const double plain_latency = latency<Plain>(op, plain_step, Plain(one));
+    const double wrapped_latency =
+        latency<Wrapped>(op, wrapped_step, Wrapped(Plain(one)));
+    const double plain_throughput =
+        throughput<Plain>(op, plain_step, Plain(one));
+    const double wrapped_throughput =
+        throughput<Wrapped>(op, wrapped_step, Wrapped(Plain(one)));
+    std::printf("%-7s %-8s %10.3f %10.3f %7.2fx %10.3f %10.3f %7.2fx\n", type,
+                name, plain_latency, wrapped_latency,
+                wrapped_latency / plain_latency, plain_throughput,
+                wrapped_throughput, wrapped_throughput / plain_throughput);
+}
+
+template <typename Plain, typename Wrapped> void run_all(const char *type) {
+    const double step = volatile_step;
+    const double one = volatile_one;
+    report<Plain, Wrapped>(
+        type, "a + b", [](auto a, auto b, auto) { return a + b; }, step);
+    report<Plain, Wrapped>(
+        type, "a - b", [](auto a, auto b, auto) { return a - b; }, step);
+    report<Plain, Wrapped>(
+        type, "a * b", [](auto a, auto b, auto) { return a * b; }, one);
+    report<Plain, Wrapped>(
+        type, "a / b", [](auto a, auto b, auto) { return a / b; }, one);
+    report<Plain, Wrapped>(
+        type, "a += b",
+        [](auto a, auto b, auto) {
+            a += b;
+            return a;
+        },
+        step);
+    report<Plain, Wrapped>(
+        type, "a -= b",
+        [](auto a, auto b, auto) {
+            a -= b;
+            return a;
+        },
+        step);
+    report<Plain, Wrapped>(
+        type, "a *= b",
+        [](auto a, auto b, auto) {
+            a *= b;
+            return a;
+        },
+        one);
+    report<Plain, Wrapped>(
+        type, "a /= b",
+        [](auto a, auto b, auto) {
+            a /= b;
+            return a;
+        },
+        one);
+    // a * 1 + step - step keeps the chain bounded
+    report<Plain, Wrapped>(
+        type, "mul_add", [](auto a, auto b, auto c) { return a * c + b - b; },
+        step);
+}
+
+} // namespace
+
+int main() {
+    std::printf("Fenced operators: + %d, - %d, * %d, / %d\n", RSTD_FENCE_ADD,
+                RSTD_FENCE_SUB, RSTD_FENCE_MUL, RSTD_FENCE_DIV);
+    std::printf("%-7s %-8s %10s %10s %8s %10s %10s %8s\n", "type", "op",
+                "lat plain", "lat r", "ratio", "tput plain", "tput r",
+                "ratio");
+    std::printf("(nanoseconds per operation, best of %d)\n", repetitions);
+    run_all<float, rfloat>("float");
+    run_all<double, rdouble>("double");
+    return sink == 0.5 ? 1 : 0;
+}
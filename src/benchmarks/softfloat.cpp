@@ -0,0 +1,144 @@
+// Times the operations of <rsoftfloat> against the FPU, as dependent
+// chains on double: the hybrid backend of RSTD_SOFTFLOAT_SUBNORMALS on
+// normal values, where it only checks the FPU result, and on subnormal
+// values, where it falls back to software, next to the full software
+// backend of RSTD_SOFTFLOAT.
+//
+// Usage: softfloat_bench [count]
+//
+// Each operation runs count times (default 2000000), best of 5.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+#include <rcmath>
+#include <rfloat>
+#include <rsoftfloat>
+
+namespace {
+
+constexpr int repetitions = 5;
+
+template <typename F> double best_ns_per_op(F run, std::size_t count) {
+    double best = 1e300;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::nano> elapsed = end - start;
+        best = std::min(best, elapsed.count() / double(count));
+    }
+    return best;
+}
+
+volatile double sink;
+// Read at run time, so that the compiler can't fold the chains
+volatile double normal_start = 1.0;
+volatile double subnormal_start = std::numeric_limits<double>::denorm_min() * 3;
+volatile double step = 1.0 + 0x1p-20;
+
+// x stays close to where it started through every operation
+template <typename T, typename Op>
+double time_op(double start, std::size_t count, Op op) {
+    return best_ns_per_op(
+        [&] {
+            T x = start;
+            const T y = double(step);
+            for (std::size_t i = 0; i < count; ++i) {
+                x = op(x, y);
+            }
+            sink = double(rdouble(x).underlying_value());
+        },
+        count);
+}
+
+struct Hardware {
+    static rdouble add(rdouble a, rdouble b) { return a + b; }
+    static rdouble sub(rdouble a, rdouble b) { return a - b; }
+    static rdouble mul(rdouble a, rdouble b) { return a * b; }
+    static rdouble div(rdouble a, rdouble b) { return a / b; }
+    static rdouble sqrt(rdouble a) { return rstd::sqrt(a); }
+};
+
+template <typename Backend> struct Software {
+    static double add(double a, double b) { return Backend::add(a, b); }
+    static double sub(double a, double b) { return Backend::sub(a, b); }
+    static double mul(double a, double b) { return Backend::mul(a, b); }
+    static double div(double a, double b) { return Backend::div(a, b); }
+    static double sqrt(double a) { return Backend::sqrt(a); }
+};
+
+struct SoftBackend {
+    static double add(double a, double b) {
+        return rstd::softfloat::add(a, b);
+    }
+    static double sub(double a, double b) {
+        return rstd::softfloat::sub(a, b);
+    }
+    static double mul(double a, double b) {
+        return rstd::softfloat::mul(a, b);
+    }
+    static double div(double a, double b) {
+        return rstd::softfloat::div(a, b);
+    }
+    static double sqrt(double a) { return rstd::softfloat::sqrt(a); }
+};
+
+struct HybridBackend {
+    static double add(double a, double b) {
+        return rstd::softfloat::hybrid::add(a, b);
+    }
+    static double sub(double a, double b) {
+        return rstd::softfloat::hybrid::sub(a, b);
+    }
+    static double mul(double a, double b) {
+        return rstd::softfloat::hybrid::mul(a, b);
+    }
+    static double div(double a, double b) {
+        return rstd::softfloat::hybrid::div(a, b);
+    }
+    static double sqrt(double a) { return rstd::softfloat::hybrid::sqrt(a); }
+};
+
+template <typename Op>
+void report(const char *name, std::size_t count, Op op) {
+    const double hardware =
+        time_op<rdouble>(normal_start, count, [&](auto x, auto y) {
+            return op(Hardware(), x, y);
+        });
+    const double hybrid =
+        time_op<double>(normal_start, count, [&](auto x, auto y) {
+            return op(Software<HybridBackend>(), x, y);
+        });
+    const double hybrid_subnormal =
+        time_op<double>(subnormal_start, count, [&](auto x, auto y) {
+            return op(Software<HybridBackend>(), x, y);
+        });
+    const double soft =
+        time_op<double>(normal_start, count, [&](auto x, auto y) {
+            return op(Software<SoftBackend>(), x, y);
+        });
+    std::printf("%-8s fpu %6.2f ns, hybrid %6.2f ns (%.1fx), hybrid on "
+                "subnormals %6.2f ns, soft %6.2f ns (%.1fx)\n",
+                name, hardware, hybrid, hybrid / hardware, hybrid_subnormal,
+                soft, soft / hardware);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t count =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+
+    report("add+sub", count,
+           [](auto ops, auto x, auto y) { return ops.sub(ops.add(x, y), y); });
+    report("mul", count, [](auto ops, auto x, auto y) { return ops.mul(x, y); });
+    report("div", count, [](auto ops, auto x, auto y) { return ops.div(x, y); });
+    report("sqrt", count, [](auto ops, auto x, auto y) {
+        return ops.sqrt(ops.mul(x, y));
+    });
+    return 0;
+}
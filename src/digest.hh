@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// A streaming 128-bit MurmurHash3 (the x64 variant). It's no cryptographic
+// hash, but it's fast and mixes well enough that two platforms' results can
+// be compared by their digests alone. Values are hashed as little-endian
+// bytes, so the digest of the same values is the same on every platform.
+class Digest128 {
+  public:
+    struct Value {
+        std::uint64_t high;
+        std::uint64_t low;
+
+        bool operator==(const Value &other) const {
+            return high == other.high && low == other.low;
+        }
+        bool operator!=(const Value &other) const { return !(*this == other); }
+    };
+
+    void add(std::uint32_t value) {
+        unsigned char bytes[4];
+        for (int i = 0; i < 4; ++i) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+        add_bytes(bytes, sizeof(bytes));
+    }
+
+    void add(std::uint64_t value) {
+        unsigned char bytes[8];
+        for (int i = 0; i < 8; ++i) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+        add_bytes(bytes, sizeof(bytes));
+    }
+
+    void add(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(bits);
+    }
+
+    void add(double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(bits);
+    }
+
+    // Adds another digest, e.g. one of a part of the data
+    void add(const Value &value) {
+        add(value.high);
+        add(value.low);
+    }
+
+    void add_bytes(const unsigned char *data, std::size_t size) {
+        m_length += size;
+        while (size > 0) {
+            const std::size_t take = std::min(size, 16 - m_pending);
+            std::memcpy(m_block + m_pending, data, take);
+            m_pending += take;
+            data += take;
+            size -= take;
+            if (m_pending == 16) {
+                mix_block(load(m_block), load(m_block + 8));
+                m_pending = 0;
+            }
+        }
+    }
+
+    // The digest of everything added so far. More can be added afterwards.
+    Value finish() const {
+        std::uint64_t h1 = m_h1;
+        std::uint64_t h2 = m_h2;
+        std::uint64_t k1 = 0;
+        std::uint64_t k2 = 0;
+        for (std::size_t i = m_pending; i-- > 8;) {
+            k2 = (k2 << 8) | m_block[i];
+        }
+        for (std::size_t i = std::min<std::size_t>(m_pending, 8); i-- > 0;) {
+            k1 = (k1 << 8) | m_block[i];
+        }
+        if (m_pending > 8) {
+            h2 ^= rotl(k2 * c2, 33) * c1;
+        }
+        if (m_pending > 0) {
+            h1 ^= rotl(k1 * c1, 31) * c2;
+        }
+        h1 ^= m_length;
+        h2 ^= m_length;
+        h1 += h2;
+        h2 += h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        h1 += h2;
+        h2 += h1;
+        return {h1, h2};
+    }
+
+    // The digest as 32 hex digits
+    std::string hex() const {
+        static const char digits[] = "0123456789abcdef";
+        const Value value = finish();
+        std::string text(32, '0');
+        for (int i = 0; i < 16; ++i) {
+            text[15 - i] = digits[(value.high >> (4 * i)) & 15];
+            text[31 - i] = digits[(value.low >> (4 * i)) & 15];
+        }
+        return text;
+    }
+
+  private:
+    static constexpr std::uint64_t c1 = 0x87c37b91114253d5;
+    static constexpr std::uint64_t c2 = 0x4cf5ad432745937f;
+
+    static std::uint64_t rotl(std::uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static std::uint64_t fmix(std::uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccd;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53;
+        k ^= k >> 33;
+        return k;
+    }
+
+    static std::uint64_t load(const unsigned char *bytes) {
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+
+    void mix_block(std::uint64_t k1, std::uint64_t k2) {
+        m_h1 ^= rotl(k1 * c1, 31) * c2;
+        m_h1 = (rotl(m_h1, 27) + m_h2) * 5 + 0x52dce729;
+        m_h2 ^= rotl(k2 * c2, 33) * c1;
+        m_h2 = (rotl(m_h2, 31) + m_h1) * 5 + 0x38495ab5;
+    }
+
+    std::uint64_t m_h1 = 0;
+    std::uint64_t m_h2 = 0;
+    std::uint64_t m_length = 0;
+    unsigned char m_block[16] = {};
+    std::size_t m_pending = 0;
+};
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <rcmath>
+#include <rexecution>
+#include <rfloat>
+
+#include "digest.hh"
+
+/* Evaluates rstd:: unary functions on rfloat for every float bit pattern and
+ * prints a 128-bit digest of the results of each one. Two platforms, compilers
+ * or sets of flags agree on a function exactly when its digests match, so
+ * they can be compared by exchanging a few lines of output instead of 16 GiB
+ * of results per function.
+ *
+ * Usage: exhaustive_sweep [--filter=<substring>] [--threads=<n>]
+ *                         [--first=<bits>] [--last=<bits>] [--raw-nan]
+ *
+ * --first and --last restrict the sweep to an inclusive range of input bit
+ * patterns (0 to 0xffffffff by default, decimal or 0x hex). NaN results are
+ * hashed as a single canonical NaN unless --raw-nan is given, since IEEE-754
+ * leaves the sign and payload of a NaN result to the platform.
+ *
+ * The inputs are split into fixed chunks, each hashed separately and then
+ * combined in order, so the digests don't depend on the number of threads.
+ * Digests go to stdout, one "<function> <digest>" line each, and timings to
+ * stderr.
+ */
+
+namespace {
+
+constexpr std::uint64_t chunk_size = std::uint64_t(1) << 20;
+constexpr std::uint32_t canonical_nan = 0x7fc00000;
+
+struct Options {
+    const char *filter = "";
+    std::size_t threads = 0;
+    std::uint64_t first = 0;
+    std::uint64_t last = 0xffffffff;
+    bool raw_nan = false;
+};
+
+template <rfloat (*F)(rfloat)>
+Digest128::Value sweep_chunk(std::uint64_t first, std::uint64_t last,
+                             bool raw_nan) {
+    Digest128 digest;
+    for (std::uint64_t i = first; i <= last; ++i) {
+        const auto input_bits = static_cast<std::uint32_t>(i);
+        float input;
+        std::memcpy(&input, &input_bits, sizeof(input));
+        const float result = F(rfloat(input)).underlying_value();
+        std::uint32_t bits;
+        std::memcpy(&bits, &result, sizeof(bits));
+        // Classified by bits, since -ffast-math lets the compiler assume
+        // there are no NaNs
+        if (!raw_nan && (bits & 0x7f800000) == 0x7f800000 &&
+            (bits & 0x007fffff) != 0) {
+            bits = canonical_nan;
+        }
+        digest.add(bits);
+    }
+    return digest.finish();
+}
+
+struct Function {
+    const char *name;
+    Digest128::Value (*sweep)(std::uint64_t, std::uint64_t, bool);
+};
+
+#define SWEEP_FUNCTION(name)                                                   \
+    rfloat sweep_##name(rfloat x) { return rstd::name(x); }
+#define SWEEP_ENTRY(name) {#name, sweep_chunk<sweep_##name>}
+
+SWEEP_FUNCTION(abs)
+SWEEP_FUNCTION(ceil)
+SWEEP_FUNCTION(floor)
+SWEEP_FUNCTION(trunc)
+SWEEP_FUNCTION(round)
+SWEEP_FUNCTION(nearbyint)
+SWEEP_FUNCTION(rint)
+SWEEP_FUNCTION(sqrt)
+SWEEP_FUNCTION(logb)
+SWEEP_FUNCTION(log)
+SWEEP_FUNCTION(log10)
+SWEEP_FUNCTION(log2)
+SWEEP_FUNCTION(log1p)
+SWEEP_FUNCTION(exp)
+SWEEP_FUNCTION(exp2)
+SWEEP_FUNCTION(expm1)
+SWEEP_FUNCTION(sin)
+SWEEP_FUNCTION(cos)
+SWEEP_FUNCTION(tan)
+SWEEP_FUNCTION(atan)
+#if defined(RSTD_NONDETERMINISM)
+SWEEP_FUNCTION(cbrt)
+SWEEP_FUNCTION(asin)
+SWEEP_FUNCTION(acos)
+SWEEP_FUNCTION(sinh)
+SWEEP_FUNCTION(cosh)
+SWEEP_FUNCTION(tanh)
+SWEEP_FUNCTION(asinh)
+SWEEP_FUNCTION(acosh)
+SWEEP_FUNCTION(atanh)
+SWEEP_FUNCTION(erf)
+SWEEP_FUNCTION(erfc)
+SWEEP_FUNCTION(tgamma)
+SWEEP_FUNCTION(lgamma)
+#endif /* defined(RSTD_NONDETERMINISM) */
+
+const Function functions[] = {
+    SWEEP_ENTRY(abs),   SWEEP_ENTRY(ceil),      SWEEP_ENTRY(floor),
+    SWEEP_ENTRY(trunc), SWEEP_ENTRY(round),     SWEEP_ENTRY(nearbyint),
+    SWEEP_ENTRY(rint),  SWEEP_ENTRY(sqrt),      SWEEP_ENTRY(logb),
+    SWEEP_ENTRY(log),   SWEEP_ENTRY(log10),     SWEEP_ENTRY(log2),
+    SWEEP_ENTRY(log1p), SWEEP_ENTRY(exp),       SWEEP_ENTRY(exp2),
+    SWEEP_ENTRY(expm1), SWEEP_ENTRY(sin),       SWEEP_ENTRY(cos),
+    SWEEP_ENTRY(tan),   SWEEP_ENTRY(atan),
+#if defined(RSTD_NONDETERMINISM)
+    SWEEP_ENTRY(cbrt),  SWEEP_ENTRY(asin),      SWEEP_ENTRY(acos),
+    SWEEP_ENTRY(sinh),  SWEEP_ENTRY(cosh),      SWEEP_ENTRY(tanh),
+    SWEEP_ENTRY(asinh), SWEEP_ENTRY(acosh),     SWEEP_ENTRY(atanh),
+    SWEEP_ENTRY(erf),   SWEEP_ENTRY(erfc),      SWEEP_ENTRY(tgamma),
+    SWEEP_ENTRY(lgamma),
+#endif /* defined(RSTD_NONDETERMINISM) */
+};
+
+#undef SWEEP_FUNCTION
+#undef SWEEP_ENTRY
+
+bool parse_options(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            options.filter = arg + 9;
+        } else if (std::strncmp(arg, "--threads=", 10) == 0) {
+            options.threads = std::strtoull(arg + 10, nullptr, 10);
+        } else if (std::strncmp(arg, "--first=", 8) == 0) {
+            options.first = std::strtoull(arg + 8, nullptr, 0);
+        } else if (std::strncmp(arg, "--last=", 7) == 0) {
+            options.last = std::strtoull(arg + 7, nullptr, 0);
+        } else if (std::strcmp(arg, "--raw-nan") == 0) {
+            options.raw_nan = true;
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--filter=<substring>] [--threads=<n>] "
+                         "[--first=<bits>] [--last=<bits>] [--raw-nan]\n",
+                         argv[0]);
+            return false;
+        }
+    }
+    if (options.last > 0xffffffff || options.first > options.last) {
+        std::fprintf(stderr, "%s: bad input range\n", argv[0]);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        return 2;
+    }
+    rstd::execution::thread_pool pool(options.threads);
+    const std::uint64_t count = options.last - options.first + 1;
+    const std::uint64_t chunks = (count + chunk_size - 1) / chunk_size;
+    std::fprintf(stderr,
+                 "Sweeping inputs 0x%08llx to 0x%08llx on %zu threads\n",
+                 static_cast<unsigned long long>(options.first),
+                 static_cast<unsigned long long>(options.last), pool.size());
+
+    std::vector<Digest128::Value> results(chunks);
+    for (const Function &function : functions) {
+        if (!std::strstr(function.name, options.filter)) {
+            continue;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        pool.run(chunks, [&](std::size_t chunk) {
+            const std::uint64_t first = options.first + chunk * chunk_size;
+            const std::uint64_t last =
+                std::min(options.last, first + chunk_size - 1);
+            results[chunk] = function.sweep(first, last, options.raw_nan);
+        });
+        Digest128 digest;
+        for (const Digest128::Value &result : results) {
+            digest.add(result);
+        }
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        std::printf("%-10s %s\n", function.name, digest.hex().c_str());
+        std::fflush(stdout);
+        std::fprintf(stderr, "%-10s %8.1f s\n", function.name,
+                     elapsed.count());
+    }
+    return 0;
+}
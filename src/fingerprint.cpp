@@ -0,0 +1,501 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <rcmath>
+#include <rcomplex>
+#include <rfft>
+#include <rlinalg>
+#include <rnumeric>
+#include <rfloat>
+
+#include "digest.hh"
+#include "rcmath_tests.hh"
+
+/* Runs a fixed, deterministic workload through every part of rfloat and
+ * prints one 128-bit digest per subsystem and type, then a digest of all of
+ * them. A new compiler, set of flags or architecture is reproducible with an
+ * old one exactly when the digests match, without any test data:
+ *
+ *   rfloat_fingerprint > x86_64.txt
+ *   qemu-aarch64 ./rfloat_fingerprint | diff x86_64.txt -
+ *
+ * Usage: rfloat_fingerprint [--detail]
+ *
+ * --detail also prints a digest per rcmath function, to narrow down a
+ * mismatch. The workload draws its inputs from splitmix64 rather than the
+ * standard distributions, whose results differ between standard libraries.
+ * Inputs are kept away from subnormals, which -ffast-math flushes at startup,
+ * and NaN results are hashed as one canonical NaN.
+ *
+ * Functions rfloat only provides with RSTD_NONDETERMINISM are fingerprinted
+ * separately as rcmath_nondeterministic, and are expected to differ.
+ */
+
+namespace {
+
+// Inputs drawn from a seed, the same on every platform
+class Inputs {
+  public:
+    explicit Inputs(std::uint64_t seed) : m_state(seed) {}
+
+    explicit Inputs(const char *name) {
+        // FNV-1a, so that each workload has its own inputs
+        m_state = 0xcbf29ce484222325;
+        for (const char *c = name; *c; ++c) {
+            m_state = (m_state ^ std::uint8_t(*c)) * 0x100000001b3;
+        }
+    }
+
+    std::uint64_t next() {
+        std::uint64_t z = (m_state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, 1), from 53 random bits
+    rdouble unit() { return rdouble(double(next() >> 11) * 0x1p-53); }
+
+    // Uniform in [lo, hi)
+    template <typename W> W uniform(double lo, double hi) {
+        return convert<W>(rdouble(lo) + (rdouble(hi) - rdouble(lo)) * unit());
+    }
+
+    // A random sign and mantissa times 2^e for e uniform in
+    // [min_exp, max_exp], covering every scale in between equally
+    template <typename W> W log_uniform(int min_exp, int max_exp) {
+        const rdouble mantissa = rdouble(1.0) + unit();
+        const int e = min_exp + int(next() % std::uint64_t(max_exp - min_exp + 1));
+        const rdouble value = rstd::ldexp(mantissa, e);
+        return convert<W>(next() & 1 ? -value : value);
+    }
+
+    int integer(int lo, int hi) {
+        return lo + int(next() % std::uint64_t(hi - lo + 1));
+    }
+
+  private:
+    // Rounds a value drawn in double precision to W
+    template <typename W> static W convert(rdouble value) {
+        return W(static_cast<typename W::underlying_type>(
+            value.underlying_value()));
+    }
+
+    std::uint64_t m_state;
+};
+
+void add_value(Digest128 &digest, float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Classified by bits, since -ffast-math lets the compiler assume there
+    // are no NaNs
+    if ((bits & 0x7f800000) == 0x7f800000 && (bits & 0x007fffff) != 0) {
+        bits = 0x7fc00000;
+    }
+    digest.add(bits);
+}
+
+void add_value(Digest128 &digest, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7ff0000000000000) == 0x7ff0000000000000 &&
+        (bits & 0x000fffffffffffff) != 0) {
+        bits = 0x7ff8000000000000;
+    }
+    digest.add(bits);
+}
+
+template <typename T, rmath::RoundingMode R>
+void add_value(Digest128 &digest, const rstd::ReproducibleWrapper<T, R> &value) {
+    add_value(digest, value.underlying_value());
+}
+
+void add_value(Digest128 &digest, int value) {
+    digest.add(static_cast<std::uint32_t>(value));
+}
+
+template <typename W> const char *type_name();
+template <> const char *type_name<rfloat>() { return "rfloat"; }
+template <> const char *type_name<rdouble>() { return "rdouble"; }
+
+// The digest of each subsystem and type, in the order they ran
+struct Fingerprint {
+    std::vector<std::pair<std::string, Digest128::Value>> entries;
+    bool detail = false;
+
+    void record(const std::string &name, const Digest128 &digest) {
+        entries.emplace_back(name, digest.finish());
+        std::printf("%-32s %s\n", name.c_str(), digest.hex().c_str());
+        std::fflush(stdout);
+    }
+};
+
+template <typename W> void arithmetic(Fingerprint &fingerprint) {
+    Inputs inputs("arithmetic");
+    Digest128 digest;
+    for (int i = 0; i < (1 << 20); ++i) {
+        const W a = inputs.log_uniform<W>(-40, 40);
+        const W b = inputs.log_uniform<W>(-40, 40);
+        const W c = inputs.log_uniform<W>(-40, 40);
+        add_value(digest, a + b);
+        add_value(digest, a - b);
+        add_value(digest, a * b);
+        add_value(digest, a / b);
+        // Fused into a single rounding unless every operator is fenced
+        add_value(digest, a * b + c);
+        add_value(digest, a - b * c);
+    }
+    fingerprint.record(std::string("arithmetic/") + type_name<W>(), digest);
+}
+
+template <typename W> void chaotic(Fingerprint &fingerprint) {
+    using Functions = TestFunctions<W>;
+    const std::string type = type_name<W>();
+
+    Inputs inputs("lorenz");
+    Digest128 digest;
+    for (int i = 0; i < 256; ++i) {
+        const typename Functions::Array3 state = {
+            inputs.uniform<W>(-20, 20), inputs.uniform<W>(-20, 20),
+            inputs.uniform<W>(0, 50)};
+        for (const W &value : Functions::lorenz(state, 4000)) {
+            add_value(digest, value);
+        }
+    }
+    fingerprint.record("lorenz/" + type, digest);
+
+    digest = Digest128();
+    for (int i = 0; i < 256; ++i) {
+        for (int j = 0; j < 256; ++j) {
+            const typename Functions::Array2 c = {W(-2.0 + 3.0 * i / 256),
+                                                  W(-1.5 + 3.0 * j / 256)};
+            for (const W &value : Functions::mandelbrot(c, 256)) {
+                add_value(digest, value);
+            }
+        }
+    }
+    fingerprint.record("mandelbrot/" + type, digest);
+
+    inputs = Inputs("logistic_map");
+    digest = Digest128();
+    for (int i = 0; i < 4096; ++i) {
+        const W r = inputs.uniform<W>(3.5, 4);
+        const W x = inputs.uniform<W>(0.01, 0.99);
+        add_value(digest, Functions::logistic_map(r, x, 1000));
+    }
+    fingerprint.record("logistic_map/" + type, digest);
+}
+
+template <typename W> void filters(Fingerprint &fingerprint) {
+    using Functions = TestFunctions<W>;
+    const std::string type = type_name<W>();
+    constexpr int samples = 1 << 16;
+
+    // A stable low-pass biquad
+    const std::vector<W> feedforward = {W(0.0675), W(0.1349), W(0.0675)};
+    const std::vector<W> feedback = {W(1.0), W(-1.143), W(0.4128)};
+    Inputs inputs("iir");
+    std::vector<W> input_history(feedforward.size(), W(0.0));
+    std::vector<W> output_history(feedback.size() - 1, W(0.0));
+    Digest128 digest;
+    for (int i = 0; i < samples; ++i) {
+        input_history.insert(input_history.begin(), inputs.uniform<W>(-1, 1));
+        input_history.pop_back();
+        add_value(digest, Functions::iir_filter(feedforward, feedback,
+                                                input_history, output_history));
+        output_history.resize(feedback.size() - 1);
+    }
+    fingerprint.record("iir/" + type, digest);
+
+    inputs = Inputs("fir");
+    std::vector<W> taps(32);
+    for (auto &tap : taps) {
+        tap = inputs.uniform<W>(-0.1, 0.1);
+    }
+    input_history.assign(taps.size(), W(0.0));
+    output_history.clear();
+    digest = Digest128();
+    for (int i = 0; i < samples; ++i) {
+        input_history.insert(input_history.begin(), inputs.uniform<W>(-1, 1));
+        input_history.pop_back();
+        add_value(digest,
+                  Functions::fir_filter(taps, input_history, output_history));
+        output_history.clear();
+    }
+    fingerprint.record("fir/" + type, digest);
+}
+
+// Each function gets its own inputs, so that adding one doesn't change the
+// digests of the others
+template <typename W> class RcmathWorkload {
+  public:
+    explicit RcmathWorkload(Fingerprint &fingerprint, const char *subsystem)
+        : m_fingerprint(fingerprint), m_subsystem(subsystem) {}
+
+    ~RcmathWorkload() {
+        m_fingerprint.record(m_subsystem + "/" + type_name<W>(), m_digest);
+    }
+
+    template <typename Op> void uniform(const char *name, double lo,
+                                        double hi, Op op) {
+        run(name, [&](Inputs &inputs, Digest128 &digest) {
+            add_value(digest, op(inputs.uniform<W>(lo, hi)));
+        });
+    }
+
+    template <typename Op>
+    void log_uniform(const char *name, int min_exp, int max_exp, Op op) {
+        run(name, [&](Inputs &inputs, Digest128 &digest) {
+            add_value(digest, op(inputs.log_uniform<W>(min_exp, max_exp)));
+        });
+    }
+
+    template <typename Op>
+    void uniform2(const char *name, double lo, double hi, Op op) {
+        run(name, [&](Inputs &inputs, Digest128 &digest) {
+            const W x = inputs.uniform<W>(lo, hi);
+            add_value(digest, op(x, inputs.uniform<W>(lo, hi)));
+        });
+    }
+
+    // Hashes whatever op adds itself, for functions with several results
+    template <typename Op> void custom(const char *name, Op op) {
+        run(name, op);
+    }
+
+  private:
+    static constexpr int count = 1 << 14;
+
+    template <typename Op> void run(const char *name, Op op) {
+        Inputs inputs(name);
+        Digest128 digest;
+        for (int i = 0; i < count; ++i) {
+            op(inputs, digest);
+        }
+        m_digest.add(digest.finish());
+        if (m_fingerprint.detail) {
+            std::printf("  %-30s %s\n",
+                        (std::string(name) + "/" + type_name<W>()).c_str(),
+                        digest.hex().c_str());
+        }
+    }
+
+    Fingerprint &m_fingerprint;
+    std::string m_subsystem;
+    Digest128 m_digest;
+};
+
+template <typename W> void rcmath(Fingerprint &fingerprint) {
+    RcmathWorkload<W> work(fingerprint, "rcmath");
+    work.uniform("abs", -1e6, 1e6, [](W x) { return rstd::abs(x); });
+    work.uniform("ceil", -1e6, 1e6, [](W x) { return rstd::ceil(x); });
+    work.uniform("floor", -1e6, 1e6, [](W x) { return rstd::floor(x); });
+    work.uniform("trunc", -1e6, 1e6, [](W x) { return rstd::trunc(x); });
+    work.uniform("round", -1e6, 1e6, [](W x) { return rstd::round(x); });
+    work.uniform("nearbyint", -1e6, 1e6,
+                 [](W x) { return rstd::nearbyint(x); });
+    work.uniform("rint", -1e6, 1e6, [](W x) { return rstd::rint(x); });
+    work.log_uniform("sqrt", -60, 60, [](W x) { return rstd::sqrt(x); });
+    work.log_uniform("logb", -60, 60, [](W x) { return rstd::logb(x); });
+    work.log_uniform("log", -60, 60, [](W x) { return rstd::log(x); });
+    work.log_uniform("log10", -60, 60, [](W x) { return rstd::log10(x); });
+    work.log_uniform("log2", -60, 60, [](W x) { return rstd::log2(x); });
+    work.uniform("log1p", -0.999, 100, [](W x) { return rstd::log1p(x); });
+    work.uniform("exp", -80, 80, [](W x) { return rstd::exp(x); });
+    work.uniform("exp2", -120, 120, [](W x) { return rstd::exp2(x); });
+    work.uniform("expm1", -80, 80, [](W x) { return rstd::expm1(x); });
+    work.log_uniform("sin", -20, 40, [](W x) { return rstd::sin(x); });
+    work.log_uniform("cos", -20, 40, [](W x) { return rstd::cos(x); });
+    work.log_uniform("tan", -20, 40, [](W x) { return rstd::tan(x); });
+    work.log_uniform("atan", -30, 30, [](W x) { return rstd::atan(x); });
+    work.uniform2("fmin", -1e3, 1e3, [](W x, W y) { return rstd::fmin(x, y); });
+    work.uniform2("fmax", -1e3, 1e3, [](W x, W y) { return rstd::fmax(x, y); });
+    work.uniform2("fdim", -1e3, 1e3, [](W x, W y) { return rstd::fdim(x, y); });
+    work.uniform2("fmod", -1e3, 1e3, [](W x, W y) { return rstd::fmod(x, y); });
+    work.uniform2("remainder", -1e3, 1e3,
+                  [](W x, W y) { return rstd::remainder(x, y); });
+    work.uniform2("copysign", -1e3, 1e3,
+                  [](W x, W y) { return rstd::copysign(x, y); });
+    work.uniform2("nextafter", -1e3, 1e3,
+                  [](W x, W y) { return rstd::nextafter(x, y); });
+    work.uniform2("atan2", -1e3, 1e3,
+                  [](W y, W x) { return rstd::atan2(y, x); });
+    work.custom("pow", [](Inputs &inputs, Digest128 &digest) {
+        const W base = inputs.uniform<W>(0, 10);
+        add_value(digest, rstd::pow(base, inputs.uniform<W>(-20, 20)));
+    });
+    work.custom("fma", [](Inputs &inputs, Digest128 &digest) {
+        const W x = inputs.uniform<W>(-1e3, 1e3);
+        const W y = inputs.uniform<W>(-1e3, 1e3);
+        add_value(digest, rstd::fma(x, y, inputs.uniform<W>(-1e3, 1e3)));
+    });
+    work.custom("ldexp", [](Inputs &inputs, Digest128 &digest) {
+        const W x = inputs.uniform<W>(-1e3, 1e3);
+        add_value(digest, rstd::ldexp(x, inputs.integer(-60, 60)));
+    });
+    work.custom("scalbn", [](Inputs &inputs, Digest128 &digest) {
+        const W x = inputs.uniform<W>(-1e3, 1e3);
+        add_value(digest, rstd::scalbn(x, inputs.integer(-60, 60)));
+    });
+    work.custom("frexp", [](Inputs &inputs, Digest128 &digest) {
+        int exponent = 0;
+        add_value(digest,
+                  rstd::frexp(inputs.log_uniform<W>(-60, 60), &exponent));
+        add_value(digest, exponent);
+    });
+    work.custom("modf", [](Inputs &inputs, Digest128 &digest) {
+        W integral = 0;
+        add_value(digest,
+                  rstd::modf(inputs.uniform<W>(-1e6, 1e6), &integral));
+        add_value(digest, integral);
+    });
+    work.custom("remquo", [](Inputs &inputs, Digest128 &digest) {
+        const W x = inputs.uniform<W>(-1e3, 1e3);
+        int quotient = 0;
+        add_value(digest,
+                  rstd::remquo(x, inputs.uniform<W>(-1e3, 1e3), &quotient));
+        // Only the sign and the last 3 bits are specified
+        add_value(digest, quotient < 0 ? -(-quotient & 7) : quotient & 7);
+    });
+}
+
+#if defined(RSTD_NONDETERMINISM)
+template <typename W> void rcmath_nondeterministic(Fingerprint &fingerprint) {
+    RcmathWorkload<W> work(fingerprint, "rcmath_nondeterministic");
+    work.uniform("cbrt", -1e6, 1e6, [](W x) { return rstd::cbrt(x); });
+    work.uniform("asin", -1, 1, [](W x) { return rstd::asin(x); });
+    work.uniform("acos", -1, 1, [](W x) { return rstd::acos(x); });
+    work.uniform("sinh", -80, 80, [](W x) { return rstd::sinh(x); });
+    work.uniform("cosh", -80, 80, [](W x) { return rstd::cosh(x); });
+    work.uniform("tanh", -20, 20, [](W x) { return rstd::tanh(x); });
+    work.log_uniform("asinh", -30, 30, [](W x) { return rstd::asinh(x); });
+    work.uniform("acosh", 1, 1e6, [](W x) { return rstd::acosh(x); });
+    work.uniform("atanh", -0.999, 0.999, [](W x) { return rstd::atanh(x); });
+    work.uniform("erf", -5, 5, [](W x) { return rstd::erf(x); });
+    work.uniform("erfc", -5, 5, [](W x) { return rstd::erfc(x); });
+    work.uniform("tgamma", 0.01, 30, [](W x) { return rstd::tgamma(x); });
+    work.uniform("lgamma", 0.01, 100, [](W x) { return rstd::lgamma(x); });
+    work.uniform2("hypot", -1e3, 1e3,
+                  [](W x, W y) { return rstd::hypot(x, y); });
+}
+#endif /* defined(RSTD_NONDETERMINISM) */
+
+template <typename W> void numeric(Fingerprint &fingerprint) {
+    Inputs inputs("rnumeric");
+    std::vector<W> values(1 << 20);
+    for (auto &value : values) {
+        value = inputs.log_uniform<W>(-20, 20);
+    }
+    Digest128 digest;
+    add_value(digest, rstd::reproducible_sum(values));
+    add_value(digest, rstd::reduce(rstd::execution::deterministic_par,
+                                   values.begin(), values.end()));
+    add_value(digest, rstd::transform_reduce(
+                          rstd::execution::deterministic_par, values.begin(),
+                          values.end(), values.begin(), W(0.0)));
+    fingerprint.record(std::string("rnumeric/") + type_name<W>(), digest);
+}
+
+template <typename W> void linalg(Fingerprint &fingerprint) {
+    constexpr std::size_t n = 192;
+    Inputs inputs("rlinalg");
+    std::vector<W> a(n * n), b(n * n), c(n * n);
+    for (auto &value : a) {
+        value = inputs.uniform<W>(-1, 1);
+    }
+    for (auto &value : b) {
+        value = inputs.uniform<W>(-1, 1);
+    }
+    Digest128 digest;
+    rstd::linalg::multiply(rstd::execution::deterministic_par, n, n, n,
+                           a.data(), n, b.data(), n, c.data(), n);
+    for (const W &value : c) {
+        add_value(digest, value);
+    }
+    std::vector<std::size_t> pivots(n);
+    add_value(digest, int(rstd::linalg::lu_factor(
+                          rstd::execution::deterministic_par, n, a.data(), n,
+                          pivots.data())));
+    for (const W &value : a) {
+        add_value(digest, value);
+    }
+    for (const std::size_t pivot : pivots) {
+        add_value(digest, int(pivot));
+    }
+    fingerprint.record(std::string("rlinalg/") + type_name<W>(), digest);
+}
+
+template <typename W> void fft(Fingerprint &fingerprint) {
+    Inputs inputs("rfft");
+    Digest128 digest;
+    // Sizes ending in a radix 2 and a radix 4 stage
+    for (const std::size_t n : {std::size_t(1) << 13, std::size_t(1) << 14}) {
+        std::vector<rstd::complex<W>> signal(n);
+        for (auto &value : signal) {
+            const W re = inputs.uniform<W>(-1, 1);
+            value = {re, inputs.uniform<W>(-1, 1)};
+        }
+        const rstd::fft::plan<W> plan(n);
+        const std::vector<rstd::complex<W>> spectrum = plan.forward(signal);
+        for (const auto &value : spectrum) {
+            add_value(digest, value.real());
+            add_value(digest, value.imag());
+        }
+        for (const auto &value : plan.inverse(spectrum)) {
+            add_value(digest, value.real());
+            add_value(digest, value.imag());
+        }
+    }
+    fingerprint.record(std::string("rfft/") + type_name<W>(), digest);
+}
+
+template <typename W> void run_all(Fingerprint &fingerprint) {
+    arithmetic<W>(fingerprint);
+    chaotic<W>(fingerprint);
+    filters<W>(fingerprint);
+    rcmath<W>(fingerprint);
+#if defined(RSTD_NONDETERMINISM)
+    rcmath_nondeterministic<W>(fingerprint);
+#endif
+    numeric<W>(fingerprint);
+    linalg<W>(fingerprint);
+    fft<W>(fingerprint);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Fingerprint fingerprint;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--detail") == 0) {
+            fingerprint.detail = true;
+        } else {
+            std::fprintf(stderr, "usage: %s [--detail]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    run_all<rfloat>(fingerprint);
+    run_all<rdouble>(fingerprint);
+
+    // Everything but the nondeterministic functions, so that the total is
+    // comparable between builds with and without RSTD_NONDETERMINISM
+    Digest128 total;
+    for (const auto &entry : fingerprint.entries) {
+        if (entry.first.compare(0, 23, "rcmath_nondeterministic") != 0) {
+            total.add(entry.second);
+        }
+    }
+    std::printf("%-32s %s\n", "total", total.hex().c_str());
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::fprintf(stderr, "Fingerprinted in %.1f s\n", elapsed.count());
+    return 0;
+}
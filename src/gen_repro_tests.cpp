@@ -2,6 +2,8 @@
 
 #include "gen_repro_tests.hh"
 #include "rcmath_tests.hh"
+#include <cstdlib>
+#include <cstring>
 #include <rcmath>
 #include <rfloat>
 
@@ -149,116 +151,116 @@ static std::array<T, 1> check_isunordered(const std::array<T, 2> &input) {
     return {rstd::isunordered(input[0], input[1]) ? 1.0 : 0.0};
 }
 
-#if defined(RSTD_NONDETERMINISM)
-
 template <typename T>
-static std::array<T, 1> check_sin(const std::array<T, 1> &input) {
-    return {rstd::sin(input[0])};
+static std::array<T, 1> check_log(const std::array<T, 1> &input) {
+    return {rstd::log(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_cos(const std::array<T, 1> &input) {
-    return {rstd::cos(input[0])};
+static std::array<T, 1> check_log2(const std::array<T, 1> &input) {
+    return {rstd::log2(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_tan(const std::array<T, 1> &input) {
-    return {rstd::tan(input[0])};
+static std::array<T, 1> check_log10(const std::array<T, 1> &input) {
+    return {rstd::log10(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_asin(const std::array<T, 1> &input) {
-    return {rstd::asin(input[0])};
+static std::array<T, 1> check_log1p(const std::array<T, 1> &input) {
+    return {rstd::log1p(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_acos(const std::array<T, 1> &input) {
-    return {rstd::acos(input[0])};
+static std::array<T, 1> check_exp(const std::array<T, 1> &input) {
+    return {rstd::exp(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_atan(const std::array<T, 1> &input) {
-    return {rstd::atan(input[0])};
+static std::array<T, 1> check_exp2(const std::array<T, 1> &input) {
+    return {rstd::exp2(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_atan2(const std::array<T, 2> &input) {
-    return {rstd::atan2(input[0], input[1])};
+static std::array<T, 1> check_expm1(const std::array<T, 1> &input) {
+    return {rstd::expm1(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_sinh(const std::array<T, 1> &input) {
-    return {rstd::sinh(input[0])};
+static std::array<T, 1> check_pow(const std::array<T, 2> &input) {
+    return {rstd::pow(input[0], input[1])};
 }
 
 template <typename T>
-static std::array<T, 1> check_cosh(const std::array<T, 1> &input) {
-    return {rstd::cosh(input[0])};
+static std::array<T, 1> check_sin(const std::array<T, 1> &input) {
+    return {rstd::sin(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_tanh(const std::array<T, 1> &input) {
-    return {rstd::tanh(input[0])};
+static std::array<T, 1> check_cos(const std::array<T, 1> &input) {
+    return {rstd::cos(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_asinh(const std::array<T, 1> &input) {
-    return {rstd::asinh(input[0])};
+static std::array<T, 1> check_tan(const std::array<T, 1> &input) {
+    return {rstd::tan(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_acosh(const std::array<T, 1> &input) {
-    return {rstd::acosh(input[0])};
+static std::array<T, 1> check_atan(const std::array<T, 1> &input) {
+    return {rstd::atan(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_atanh(const std::array<T, 1> &input) {
-    return {rstd::atanh(input[0])};
+static std::array<T, 1> check_atan2(const std::array<T, 2> &input) {
+    return {rstd::atan2(input[0], input[1])};
 }
 
+#if defined(RSTD_NONDETERMINISM)
+
 template <typename T>
-static std::array<T, 1> check_hypot(const std::array<T, 2> &input) {
-    return {rstd::hypot(input[0], input[1])};
+static std::array<T, 1> check_asin(const std::array<T, 1> &input) {
+    return {rstd::asin(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_log(const std::array<T, 1> &input) {
-    return {rstd::log(input[0])};
+static std::array<T, 1> check_acos(const std::array<T, 1> &input) {
+    return {rstd::acos(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_log2(const std::array<T, 1> &input) {
-    return {rstd::log2(input[0])};
+static std::array<T, 1> check_sinh(const std::array<T, 1> &input) {
+    return {rstd::sinh(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_log10(const std::array<T, 1> &input) {
-    return {rstd::log10(input[0])};
+static std::array<T, 1> check_cosh(const std::array<T, 1> &input) {
+    return {rstd::cosh(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_log1p(const std::array<T, 1> &input) {
-    return {rstd::log1p(input[0])};
+static std::array<T, 1> check_tanh(const std::array<T, 1> &input) {
+    return {rstd::tanh(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_exp(const std::array<T, 1> &input) {
-    return {rstd::exp(input[0])};
+static std::array<T, 1> check_asinh(const std::array<T, 1> &input) {
+    return {rstd::asinh(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_exp2(const std::array<T, 1> &input) {
-    return {rstd::exp2(input[0])};
+static std::array<T, 1> check_acosh(const std::array<T, 1> &input) {
+    return {rstd::acosh(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_expm1(const std::array<T, 1> &input) {
-    return {rstd::expm1(input[0])};
+static std::array<T, 1> check_atanh(const std::array<T, 1> &input) {
+    return {rstd::atanh(input[0])};
 }
 
 template <typename T>
-static std::array<T, 1> check_pow(const std::array<T, 2> &input) {
-    return {rstd::pow(input[0], input[1])};
+static std::array<T, 1> check_hypot(const std::array<T, 2> &input) {
+    return {rstd::hypot(input[0], input[1])};
 }
 
 template <typename T>
@@ -295,260 +297,324 @@ static std::array<T, 1> check_lerp(const std::array<T, 3> &input) {
 
 #endif /* defined(RSTD_NONDETERMINISM)*/
 
-int main() {
+static bool parse_options(int argc, char **argv, GeneratorOptions &options) {
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--rows=", 7) == 0) {
+            options.rows = std::strtoull(arg + 7, nullptr, 10);
+        } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+            options.seed = std::strtoull(arg + 7, nullptr, 10);
+        } else if (std::strncmp(arg, "--threads=", 10) == 0) {
+            options.threads = std::strtoull(arg + 10, nullptr, 10);
+        } else if (std::strncmp(arg, "--out=", 6) == 0) {
+            options.output = arg + 6;
+        } else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--rows=<n>] [--seed=<n>] [--threads=<n>]"
+                         " [--out=<file>]"
+                      << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes the test vectors for reproducibility_tests. Every section gets
+// --rows rows (100 by default) drawn from --seed, and the file is the same
+// whatever --threads is.
+int main(int argc, char **argv) {
     using TestType = rdouble;
+    GeneratorOptions options;
+    if (!parse_options(argc, argv, options)) {
+        return 2;
+    }
+    TestDataGenerator generator(options);
 
     // basic deterministic tests
-    auto random_abs_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_abs", check_abs<TestType>,
-                                       random_abs_inputs);
+    auto random_abs_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_abs",
+                                       check_abs<TestType>, random_abs_inputs);
 
-    auto random_sqrt_inputs = uniform_random_args<TestType, 1>(100, 0.0);
-    generate_test_data<TestType, 1, 1>("random_sqrt", check_sqrt<TestType>,
+    auto random_sqrt_inputs = uniform_random_args<TestType, 1>(0.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_sqrt",
+                                       check_sqrt<TestType>,
                                        random_sqrt_inputs);
 
-    auto random_ceil_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_ceil", check_ceil<TestType>,
+    auto random_ceil_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_ceil",
+                                       check_ceil<TestType>,
                                        random_ceil_inputs);
 
-    auto random_floor_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_floor", check_floor<TestType>,
+    auto random_floor_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_floor",
+                                       check_floor<TestType>,
                                        random_floor_inputs);
 
-    auto random_round_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_round", check_round<TestType>,
+    auto random_round_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_round",
+                                       check_round<TestType>,
                                        random_round_inputs);
 
-    auto random_trunc_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_trunc", check_trunc<TestType>,
+    auto random_trunc_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_trunc",
+                                       check_trunc<TestType>,
                                        random_trunc_inputs);
 
-    auto random_rint_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_rint", check_rint<TestType>,
+    auto random_rint_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_rint",
+                                       check_rint<TestType>,
                                        random_rint_inputs);
 
-    auto random_nearbyint_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>(
-        "random_nearbyint", check_nearbyint<TestType>, random_nearbyint_inputs);
+    auto random_nearbyint_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_nearbyint",
+                                       check_nearbyint<TestType>,
+                                       random_nearbyint_inputs);
 
     auto random_nextafter_inputs = uniform_random_args<TestType, 2>(
-        100, std::numeric_limits<TestType>::min(), 0.000001);
-    generate_test_data<TestType, 2, 1>(
-        "random_nextafter", check_nextafter<TestType>, random_nextafter_inputs);
+        std::numeric_limits<TestType>::min(), 0.000001);
+    generate_test_data<TestType, 2, 1>(generator, "random_nextafter",
+                                       check_nextafter<TestType>,
+                                       random_nextafter_inputs);
 
     auto random_nexttoward_inputs = uniform_random_args<TestType, 2>(
-        100, std::numeric_limits<TestType>::min(), 0.000001);
-    generate_test_data<TestType, 2, 1>("random_nexttoward",
+        std::numeric_limits<TestType>::min(), 0.000001);
+    generate_test_data<TestType, 2, 1>(generator, "random_nexttoward",
                                        check_nexttoward<TestType>,
                                        random_nexttoward_inputs);
 
-    auto random_fmod_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_fmod", check_fmod<TestType>,
+    auto random_fmod_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_fmod",
+                                       check_fmod<TestType>,
                                        random_fmod_inputs);
 
-    auto random_fmax_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_fmax", check_fmax<TestType>,
+    auto random_fmax_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_fmax",
+                                       check_fmax<TestType>,
                                        random_fmax_inputs);
 
-    auto random_fmin_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_fmin", check_fmin<TestType>,
+    auto random_fmin_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_fmin",
+                                       check_fmin<TestType>,
                                        random_fmin_inputs);
 
-    auto random_fdim_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_fdim", check_fdim<TestType>,
+    auto random_fdim_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_fdim",
+                                       check_fdim<TestType>,
                                        random_fdim_inputs);
 
-    auto random_remainder_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>(
-        "random_remainder", check_remainder<TestType>, random_remainder_inputs);
+    auto random_remainder_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_remainder",
+                                       check_remainder<TestType>,
+                                       random_remainder_inputs);
 
-    auto random_fma_inputs = normal_random_args<TestType, 3>(100, 0.0, 3000.0);
-    generate_test_data<TestType, 3, 1>("random_fma", check_fma<TestType>,
-                                       random_fma_inputs);
+    auto random_fma_inputs = normal_random_args<TestType, 3>(0.0, 3000.0);
+    generate_test_data<TestType, 3, 1>(generator, "random_fma",
+                                       check_fma<TestType>, random_fma_inputs);
 
-    auto random_isgreater_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>(
-        "random_isgreater", check_isgreater<TestType>, random_isgreater_inputs);
+    auto random_isgreater_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_isgreater",
+                                       check_isgreater<TestType>,
+                                       random_isgreater_inputs);
 
-    auto random_isless_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_isless", check_isless<TestType>,
+    auto random_isless_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_isless",
+                                       check_isless<TestType>,
                                        random_isless_inputs);
 
-    auto random_islessequal_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_islessequal",
+    auto random_islessequal_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_islessequal",
                                        check_islessequal<TestType>,
                                        random_islessequal_inputs);
 
-    auto random_isgreaterequal_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_isgreaterequal",
+    auto random_isgreaterequal_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_isgreaterequal",
                                        check_isgreaterequal<TestType>,
                                        random_isgreaterequal_inputs);
 
-    auto random_islessgreater_inputs = uniform_random_args<TestType, 2>(100);
-    generate_test_data<TestType, 2, 1>("random_islessgreater",
+    auto random_islessgreater_inputs = uniform_random_args<TestType, 2>();
+    generate_test_data<TestType, 2, 1>(generator, "random_islessgreater",
                                        check_islessgreater<TestType>,
                                        random_islessgreater_inputs);
-#if defined(RSTD_NONDETERMINISM)
-    auto random_exp_inputs = uniform_random_args<TestType, 1>(100, -10.0, 10.0);
-    generate_test_data<TestType, 1, 1>("random_exp", check_exp<TestType>,
-                                       random_exp_inputs);
+    auto random_exp_inputs = uniform_random_args<TestType, 1>(-10.0, 10.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_exp",
+                                       check_exp<TestType>, random_exp_inputs);
 
-    auto random_exp2_inputs =
-        uniform_random_args<TestType, 1>(100, -10.0, 10.0);
-    generate_test_data<TestType, 1, 1>("random_exp2", check_exp2<TestType>,
+    auto random_exp2_inputs = uniform_random_args<TestType, 1>(-10.0, 10.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_exp2",
+                                       check_exp2<TestType>,
                                        random_exp2_inputs);
 
-    auto random_expm1_inputs =
-        uniform_random_args<TestType, 1>(100, -10.0, 10.0);
-    generate_test_data<TestType, 1, 1>("random_expm1", check_expm1<TestType>,
+    auto random_expm1_inputs = uniform_random_args<TestType, 1>(-10.0, 10.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_expm1",
+                                       check_expm1<TestType>,
                                        random_expm1_inputs);
 
-    auto random_log_inputs = uniform_random_args<TestType, 1>(100, 0.0);
-    generate_test_data<TestType, 1, 1>("random_log", check_log<TestType>,
-                                       random_log_inputs);
+    auto random_log_inputs = uniform_random_args<TestType, 1>(0.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_log",
+                                       check_log<TestType>, random_log_inputs);
 
-    auto random_log2_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_log2", check_log2<TestType>,
+    auto random_log2_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_log2",
+                                       check_log2<TestType>,
                                        random_log2_inputs);
 
-    auto random_log10_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_log10", check_log10<TestType>,
+    auto random_log10_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_log10",
+                                       check_log10<TestType>,
                                        random_log10_inputs);
 
-    auto random_log1p_inputs = uniform_random_args<TestType, 1>(100);
-    generate_test_data<TestType, 1, 1>("random_log1p", check_log1p<TestType>,
+    auto random_log1p_inputs = uniform_random_args<TestType, 1>();
+    generate_test_data<TestType, 1, 1>(generator, "random_log1p",
+                                       check_log1p<TestType>,
                                        random_log1p_inputs);
 
-    auto random_sin_inputs = uniform_random_args<TestType, 1>(100, 0.0, pi);
-    generate_test_data<TestType, 1, 1>("random_sin", check_sin<TestType>,
-                                       random_sin_inputs);
+    auto random_sin_inputs = uniform_random_args<TestType, 1>(0.0, pi);
+    generate_test_data<TestType, 1, 1>(generator, "random_sin",
+                                       check_sin<TestType>, random_sin_inputs);
 
-    auto random_cos_inputs = uniform_random_args<TestType, 1>(100, 0.0, pi);
-    generate_test_data<TestType, 1, 1>("random_cos", check_cos<TestType>,
-                                       random_cos_inputs);
+    auto random_cos_inputs = uniform_random_args<TestType, 1>(0.0, pi);
+    generate_test_data<TestType, 1, 1>(generator, "random_cos",
+                                       check_cos<TestType>, random_cos_inputs);
 
     auto random_tan_inputs =
-        uniform_random_args<TestType, 1>(100, -pi / 2.0, pi / 2.0);
-    generate_test_data<TestType, 1, 1>("random_tan", check_tan<TestType>,
-                                       random_tan_inputs);
-
-    auto random_asin_inputs = uniform_random_args<TestType, 1>(100, -1.0, 1.0);
-    generate_test_data<TestType, 1, 1>("random_asin", check_asin<TestType>,
-                                       random_asin_inputs);
-
-    auto random_acos_inputs = uniform_random_args<TestType, 1>(100, -1.0, 1.0);
-    generate_test_data<TestType, 1, 1>("random_acos", check_acos<TestType>,
-                                       random_acos_inputs);
+        uniform_random_args<TestType, 1>(-pi / 2.0, pi / 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_tan",
+                                       check_tan<TestType>, random_tan_inputs);
 
     auto random_atan_inputs =
-        uniform_random_args<TestType, 1>(100, -pi / 2.0, pi / 2.0);
-    generate_test_data<TestType, 1, 1>("random_atan", check_atan<TestType>,
+        uniform_random_args<TestType, 1>(-pi / 2.0, pi / 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_atan",
+                                       check_atan<TestType>,
                                        random_atan_inputs);
 
     auto random_atan2_inputs =
-        uniform_random_args<TestType, 2>(100, -pi / 2.0, pi / 2.0);
-    generate_test_data<TestType, 2, 1>("random_atan2", check_atan2<TestType>,
+        uniform_random_args<TestType, 2>(-pi / 2.0, pi / 2.0);
+    generate_test_data<TestType, 2, 1>(generator, "random_atan2",
+                                       check_atan2<TestType>,
                                        random_atan2_inputs);
 
+#if defined(RSTD_NONDETERMINISM)
+    auto random_asin_inputs = uniform_random_args<TestType, 1>(-1.0, 1.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_asin",
+                                       check_asin<TestType>,
+                                       random_asin_inputs);
+
+    auto random_acos_inputs = uniform_random_args<TestType, 1>(-1.0, 1.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_acos",
+                                       check_acos<TestType>,
+                                       random_acos_inputs);
+
     auto random_hypot_inputs =
-        uniform_random_args<TestType, 2>(100, -pi / 2.0, pi / 2.0);
-    generate_test_data<TestType, 2, 1>("random_hypot", check_hypot<TestType>,
+        uniform_random_args<TestType, 2>(-pi / 2.0, pi / 2.0);
+    generate_test_data<TestType, 2, 1>(generator, "random_hypot",
+                                       check_hypot<TestType>,
                                        random_hypot_inputs);
 
     auto random_sinh_inputs =
-        uniform_random_args<TestType, 1>(100, -pi * 2.0, pi * 2.0);
-    generate_test_data<TestType, 1, 1>("random_sinh", check_sinh<TestType>,
+        uniform_random_args<TestType, 1>(-pi * 2.0, pi * 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_sinh",
+                                       check_sinh<TestType>,
                                        random_sinh_inputs);
 
     auto random_cosh_inputs =
-        uniform_random_args<TestType, 1>(100, -pi * 2.0, pi * 2.0);
-    generate_test_data<TestType, 1, 1>("random_cosh", check_cosh<TestType>,
+        uniform_random_args<TestType, 1>(-pi * 2.0, pi * 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_cosh",
+                                       check_cosh<TestType>,
                                        random_cosh_inputs);
 
     auto random_tanh_inputs =
-        uniform_random_args<TestType, 1>(100, -pi / 2.0, pi / 2.0);
-    generate_test_data<TestType, 1, 1>("random_tanh", check_tanh<TestType>,
+        uniform_random_args<TestType, 1>(-pi / 2.0, pi / 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_tanh",
+                                       check_tanh<TestType>,
                                        random_tanh_inputs);
 
     auto random_asinh_inputs =
-        uniform_random_args<TestType, 1>(100, -pi * 2.0, pi * 2.0);
-    generate_test_data<TestType, 1, 1>("random_asinh", check_asinh<TestType>,
+        uniform_random_args<TestType, 1>(-pi * 2.0, pi * 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_asinh",
+                                       check_asinh<TestType>,
                                        random_asinh_inputs);
 
     auto random_acosh_inputs =
-        uniform_random_args<TestType, 1>(100, -pi * 2.0, pi * 2.0);
-    generate_test_data<TestType, 1, 1>("random_acosh", check_acosh<TestType>,
+        uniform_random_args<TestType, 1>(-pi * 2.0, pi * 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_acosh",
+                                       check_acosh<TestType>,
                                        random_acosh_inputs);
 
     auto random_atanh_inputs =
-        uniform_random_args<TestType, 1>(100, -pi / 2.0, pi / 2.0);
-    generate_test_data<TestType, 1, 1>("random_atanh", check_atanh<TestType>,
+        uniform_random_args<TestType, 1>(-pi / 2.0, pi / 2.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_atanh",
+                                       check_atanh<TestType>,
                                        random_atanh_inputs);
 
-    auto random_cbrt_inputs = uniform_random_args<TestType, 1>(100, 0.0);
-    generate_test_data<TestType, 1, 1>("random_cbrt", check_cbrt<TestType>,
+    auto random_cbrt_inputs = uniform_random_args<TestType, 1>(0.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_cbrt",
+                                       check_cbrt<TestType>,
                                        random_cbrt_inputs);
-    auto random_pow_inputs = uniform_random_args<TestType, 2>(100, -10.0, 10.0);
-    generate_test_data<TestType, 2, 1>("random_pow", check_pow<TestType>,
-                                       random_pow_inputs);
+    auto random_pow_inputs = uniform_random_args<TestType, 2>(-10.0, 10.0);
+    generate_test_data<TestType, 2, 1>(generator, "random_pow",
+                                       check_pow<TestType>, random_pow_inputs);
 
-    auto random_erf_inputs = uniform_random_args<TestType, 1>(100, -5.0, 5.0);
-    generate_test_data<TestType, 1, 1>("random_erf", check_erf<TestType>,
-                                       random_erf_inputs);
+    auto random_erf_inputs = uniform_random_args<TestType, 1>(-5.0, 5.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_erf",
+                                       check_erf<TestType>, random_erf_inputs);
 
-    auto random_erfc_inputs = uniform_random_args<TestType, 1>(100, -5.0, 5.0);
-    generate_test_data<TestType, 1, 1>("random_erfc", check_erfc<TestType>,
+    auto random_erfc_inputs = uniform_random_args<TestType, 1>(-5.0, 5.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_erfc",
+                                       check_erfc<TestType>,
                                        random_erfc_inputs);
 
-    auto random_lgamma_inputs =
-        uniform_random_args<TestType, 1>(100, 0.0, 10.0);
-    generate_test_data<TestType, 1, 1>("random_lgamma", check_lgamma<TestType>,
+    auto random_lgamma_inputs = uniform_random_args<TestType, 1>(0.0, 10.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_lgamma",
+                                       check_lgamma<TestType>,
                                        random_lgamma_inputs);
 
-    auto random_tgamma_inputs =
-        uniform_random_args<TestType, 1>(100, 0.0, 10.0);
-    generate_test_data<TestType, 1, 1>("random_tgamma", check_tgamma<TestType>,
+    auto random_tgamma_inputs = uniform_random_args<TestType, 1>(0.0, 10.0);
+    generate_test_data<TestType, 1, 1>(generator, "random_tgamma",
+                                       check_tgamma<TestType>,
                                        random_tgamma_inputs);
 #if __cpp_lib_interpolate >= 201902L
-    auto random_lerp_inputs = uniform_random_args<TestType, 3>(100);
-    generate_test_data<TestType, 3, 1>("random_lerp", check_lerp<TestType>,
+    auto random_lerp_inputs = uniform_random_args<TestType, 3>();
+    generate_test_data<TestType, 3, 1>(generator, "random_lerp",
+                                       check_lerp<TestType>,
                                        random_lerp_inputs);
 #endif /* __cpp_lib_interpolate >= 201902L */
 #endif /* defined(RSTD_NONDETERMINISM) */
 
     // Chaotic function tests
-    auto random_lorenz_inputs = normal_random_args<TestType, 3>(100, 0.0, 20.0);
-    generate_test_data<TestType, 3, 3>("random_lorenz", lorenz<TestType>,
-                                       random_lorenz_inputs);
-    auto random_mandelbrot_inputs =
-        normal_random_args<TestType, 2>(100, 0.0, 20.0);
-    generate_test_data<TestType, 2, 2>(
-        "random_mandelbrot", mandelbrot<TestType>, random_mandelbrot_inputs);
+    auto random_lorenz_inputs = normal_random_args<TestType, 3>(0.0, 20.0);
+    generate_test_data<TestType, 3, 3>(generator, "random_lorenz",
+                                       lorenz<TestType>, random_lorenz_inputs);
+    auto random_mandelbrot_inputs = normal_random_args<TestType, 2>(0.0, 20.0);
+    generate_test_data<TestType, 2, 2>(generator, "random_mandelbrot",
+                                       mandelbrot<TestType>,
+                                       random_mandelbrot_inputs);
 
     auto random_logistic_map_inputs =
-        normal_random_args<TestType, 2>(100, 3.5, 0.25);
-    generate_test_data<TestType, 2, 1>("random_logistic_map",
+        normal_random_args<TestType, 2>(3.5, 0.25);
+    generate_test_data<TestType, 2, 1>(generator, "random_logistic_map",
                                        logistic_map<TestType>,
                                        random_logistic_map_inputs);
 
     // Implementation validation tests
     auto random_iostream_large_inputs = uniform_random_args<TestType, 1>(
-        100, std::numeric_limits<typename TestType::underlying_type>::min(),
+        std::numeric_limits<typename TestType::underlying_type>::min(),
         std::numeric_limits<typename TestType::underlying_type>::max());
-    auto random_iostream_medium_inputs = uniform_random_args<TestType, 1>(100);
+    auto random_iostream_medium_inputs = uniform_random_args<TestType, 1>();
     auto random_iostream_small_inputs = uniform_random_args<TestType, 1>(
-        100, std::numeric_limits<typename TestType::underlying_type>::min(),
+        std::numeric_limits<typename TestType::underlying_type>::min(),
         0.00000001);
-    generate_test_data<TestType, 1, 1>("random_iostream_large",
+    generate_test_data<TestType, 1, 1>(generator, "random_iostream_large",
                                        check_iostream_operators<TestType>,
                                        random_iostream_large_inputs);
-    generate_test_data<TestType, 1, 1>("random_iostream_medium",
+    generate_test_data<TestType, 1, 1>(generator, "random_iostream_medium",
                                        check_iostream_operators<TestType>,
                                        random_iostream_medium_inputs);
 
-    generate_test_data<TestType, 1, 1>("random_iostream_small",
+    generate_test_data<TestType, 1, 1>(generator, "random_iostream_small",
                                        check_iostream_operators<TestType>,
                                        random_iostream_small_inputs);
 
+    generator.close();
+    std::cout << "Test vectors saved to " << options.output << std::endl;
     return 0;
 }
@@ -1,172 +1,260 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iostream>
 #include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <vector>
 
-#include <iomanip>
+#include <rexecution>
 
-template <typename T, std::size_t InputSize, std::size_t OutputSize>
-class TestDataGenerator {
+#include "reproducibility_tests.hh"
+
+// Writes a test vector file, as read by TestVectorFile, one section at a
+// time. Rows go straight to disk, and the section table and header are
+// written by close().
+class TestVectorWriter {
   public:
-    using InputType = std::array<T, InputSize>;
-    using OutputType = std::array<T, OutputSize>;
-    using FunctionType = std::function<OutputType(const InputType &)>;
-
-    TestDataGenerator(FunctionType func, const std::string &name)
-        : m_func(func), m_name(name) {}
-
-    std::string generate(const std::vector<InputType> &inputs) {
-        std::ostringstream oss;
-        oss << "#pragma once\n#include <string>\n\n";
-        oss << "static const std::string " << m_name << "_testdata = R\"(\n";
-
-        for (const auto &input : inputs) {
-            std::ostringstream tmp;
-            try {
-                
-                for (const auto &val : input) {
-                    if(std::isnan(val.fp64()) || std::isinf(val.fp64())) {
-                        throw std::runtime_error("Unsupported special value");
-                    }
-                    tmp << std::setprecision(17) << val << " ";
-                }
+    explicit TestVectorWriter(const std::string &path)
+        : m_path(path), m_out(path, std::ios::binary) {
+        const TestVectorHeader placeholder = {};
+        write_bytes(&placeholder, sizeof(placeholder));
+    }
 
-                OutputType output = m_func(input);
-                for (const auto &val : output) {
-                    if(std::isnan(val.fp64()) || std::isinf(val.fp64())) {
-                        throw std::runtime_error("Unsupported special value");
-                    }
-                    tmp << std::setprecision(17) << val << " ";
-                }
+    ~TestVectorWriter() {
+        if (m_out.is_open()) {
+            close();
+        }
+    }
 
-                oss << tmp.str() << "\n";
-            } catch (std::runtime_error &e) {
-                // Silently drop records that contain special values like
-                // NaN or Inf. std::istream doesn't support them and I don't
-                // want to write a custom parser.
-                continue;
-            }
+    template <typename T, std::size_t InputSize, std::size_t OutputSize>
+    void begin_section(const std::string &name) {
+        if (name.size() >= sizeof(TestVectorSection::name)) {
+            throw std::invalid_argument("Section name too long: " + name);
         }
+        TestVectorSection entry = {};
+        std::memcpy(entry.name, name.data(), name.size());
+        entry.element_size = sizeof(T);
+        entry.input_size = InputSize;
+        entry.output_size = OutputSize;
+        align(test_vector_alignment);
+        entry.offset = m_offset;
+        m_sections.push_back(entry);
+    }
+
+    // Appends a row to the current section
+    template <typename T, std::size_t InputSize, std::size_t OutputSize>
+    void write(const TestParam<T, InputSize, OutputSize> &row) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Test vectors are raw bit patterns");
+        write_bytes(row.inputs.data(), sizeof(T) * InputSize);
+        write_bytes(row.expected_outputs.data(), sizeof(T) * OutputSize);
+        m_sections.back().rows++;
+    }
 
-        oss << ")\";\n";
-        return oss.str();
+    void close() {
+        align(alignof(TestVectorSection));
+        TestVectorHeader header = {};
+        std::memcpy(header.magic, test_vector_magic, sizeof(header.magic));
+        header.byte_order = test_vector_byte_order;
+        header.version = test_vector_version;
+        header.section_count = m_sections.size();
+        header.section_table = m_offset;
+        write_bytes(m_sections.data(),
+                    m_sections.size() * sizeof(TestVectorSection));
+        m_out.seekp(0);
+        m_out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        m_out.close();
+        if (!m_out) {
+            throw std::runtime_error("Unable to write " + m_path);
+        }
     }
 
   private:
-    FunctionType m_func;
-    std::string m_name;
-};
+    void write_bytes(const void *data, std::size_t size) {
+        m_out.write(static_cast<const char *>(data), std::streamsize(size));
+        if (!m_out) {
+            throw std::runtime_error("Unable to write " + m_path);
+        }
+        m_offset += size;
+    }
 
-template <typename T, std::size_t InputSize, std::size_t OutputSize>
-void generate_test_data(
-    const std::string &funcname,
-    std::function<std::array<T, OutputSize>(const std::array<T, InputSize> &)>
-        func,
-    const std::vector<std::array<T, InputSize>> &inputs) {
-    TestDataGenerator<T, InputSize, OutputSize> generator(func, funcname);
-    std::string testData = generator.generate(inputs);
-
-    std::string filename = funcname + "_testdata.hh";
-    std::ofstream outfile(filename);
-    if (outfile) {
-        outfile << testData;
-        outfile.close();
-        std::cout << "Test data for " << funcname << " saved to " << filename
-                  << std::endl;
-    } else {
-        std::cerr << "Unable to open file " << filename << " for writing"
-                  << std::endl;
+    void align(std::size_t alignment) {
+        static const char padding[test_vector_alignment] = {};
+        write_bytes(padding, (alignment - m_offset % alignment) % alignment);
     }
-}
 
-template <typename T> std::vector<T> generate_uniform_random_list(typename T::underlying_type min, typename T::underlying_type max, std::size_t count) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dis(min, max);
+    std::string m_path;
+    std::ofstream m_out;
+    std::uint64_t m_offset = 0;
+    std::vector<TestVectorSection> m_sections;
+};
 
-    std::vector<T> random_numbers;
-    for (std::size_t i = 0; i < count; ++i) {
-        random_numbers.push_back(static_cast<T>(dis(gen)));
-    }
-    return random_numbers;
-}
+// Draws the inputs of one test case
+template <typename T, std::size_t InputSize>
+using InputDistribution =
+    std::function<std::array<T, InputSize>(std::mt19937_64 &)>;
 
-template <typename T> std::vector<T> generate_normal_random_list(typename T::underlying_type mean, typename T::underlying_type stddev, std::size_t count) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::normal_distribution<> dis(mean, stddev);
+// Rows are generated in shards of this many. Every shard draws its inputs
+// from its own engine, seeded with the seed, the section name and the
+// shard's index, so the file only depends on those and on the number of
+// rows, however many threads generate it.
+constexpr std::size_t shard_rows = 4096;
 
-    std::vector<T> random_numbers;
-    for (std::size_t i = 0; i < count; ++i) {
-        random_numbers.push_back(static_cast<T>(dis(gen)));
+inline std::mt19937_64 shard_engine(std::uint64_t seed,
+                                    const std::string &name,
+                                    std::uint64_t shard) {
+    // FNV-1a
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (const char c : name) {
+        hash = (hash ^ std::uint8_t(c)) * 0x100000001b3;
     }
-    return random_numbers;
+    std::seed_seq sequence{std::uint32_t(seed),  std::uint32_t(seed >> 32),
+                           std::uint32_t(hash),  std::uint32_t(hash >> 32),
+                           std::uint32_t(shard), std::uint32_t(shard >> 32)};
+    return std::mt19937_64(sequence);
 }
 
-template<typename T>
-std::vector<T> generate_selected_random_list(const std::vector<T>& collection, std::size_t count) {
-    if (collection.size() < count) {
-        throw std::invalid_argument("Not enough special values provided");
-    }
+struct GeneratorOptions {
+    std::string output = "reproducibility_tests.rtv";
+    std::size_t rows = 100;
+    std::uint64_t seed = 1;
+    // 0 uses every hardware thread
+    std::size_t threads = 0;
+};
 
-    std::vector<T> result;
-    result.reserve(count);
+// Generates every section of a test vector file. Shards are computed on a
+// thread pool a batch at a time and written in order as each batch
+// completes, so memory use doesn't grow with the number of rows.
+class TestDataGenerator {
+  public:
+    explicit TestDataGenerator(const GeneratorOptions &options)
+        : m_options(options), m_writer(options.output),
+          m_pool(options.threads) {}
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, collection.size() - 1);
+    // Writes a section of test vectors, returning the number of rows. Rows
+    // with special values like NaN or Inf are dropped, since the tests
+    // compare results with ==.
+    template <typename T, std::size_t InputSize, std::size_t OutputSize>
+    std::size_t generate(
+        const std::string &name,
+        const std::function<std::array<T, OutputSize>(
+            const std::array<T, InputSize> &)> &func,
+        const InputDistribution<T, InputSize> &inputs) {
+        using Param = TestParam<T, InputSize, OutputSize>;
+        const auto special = [](const T &val) {
+            return std::isnan(val.fp64()) || std::isinf(val.fp64());
+        };
+        const std::size_t shards =
+            (m_options.rows + shard_rows - 1) / shard_rows;
+        const std::size_t batch = 4 * m_pool.size();
+        std::vector<std::vector<Param>> results(std::min(shards, batch));
 
-    for (std::size_t i = 0; i < count; ++i) {
-        std::size_t idx = dis(gen);
-        result.push_back(static_cast<T>(collection[idx]));
+        m_writer.begin_section<T, InputSize, OutputSize>(name);
+        std::size_t written = 0;
+        for (std::size_t first = 0; first < shards; first += batch) {
+            const std::size_t count = std::min(batch, shards - first);
+            m_pool.run(count, [&](std::size_t i) {
+                const std::size_t shard = first + i;
+                const std::size_t rows = std::min(
+                    shard_rows, m_options.rows - shard * shard_rows);
+                std::mt19937_64 engine =
+                    shard_engine(m_options.seed, name, shard);
+                std::vector<Param> &rows_out = results[i];
+                rows_out.clear();
+                for (std::size_t row = 0; row < rows; ++row) {
+                    const std::array<T, InputSize> input = inputs(engine);
+                    if (std::any_of(input.begin(), input.end(), special)) {
+                        continue;
+                    }
+                    const std::array<T, OutputSize> output = func(input);
+                    if (std::any_of(output.begin(), output.end(), special)) {
+                        continue;
+                    }
+                    rows_out.push_back(Param{input, output});
+                }
+            });
+            for (std::size_t i = 0; i < count; ++i) {
+                for (const Param &row : results[i]) {
+                    m_writer.write(row);
+                }
+                written += results[i].size();
+            }
+        }
+        return written;
     }
 
-    return result;
+    void close() { m_writer.close(); }
+
+  private:
+    GeneratorOptions m_options;
+    TestVectorWriter m_writer;
+    rstd::execution::thread_pool m_pool;
+};
+
+template <typename T, std::size_t InputSize, std::size_t OutputSize>
+void generate_test_data(
+    TestDataGenerator &generator, const std::string &funcname,
+    std::function<std::array<T, OutputSize>(const std::array<T, InputSize> &)>
+        func,
+    const InputDistribution<T, InputSize> &inputs) {
+    const std::size_t rows =
+        generator.generate<T, InputSize, OutputSize>(funcname, func, inputs);
+    std::cout << "Test data for " << funcname << ": " << rows << " rows"
+              << std::endl;
 }
 
-template <typename T, std::size_t InputSize> 
-std::vector<std::array<T, InputSize>> uniform_random_args(std::size_t count, typename T::underlying_type min = -1e9, typename T::underlying_type max = 1e9) {
-    std::vector<std::array<T, InputSize>> inputs;
-    inputs.reserve(count);
-    for (std::size_t i = 0; i < count; ++i) {
+template <typename T, std::size_t InputSize>
+InputDistribution<T, InputSize>
+uniform_random_args(typename T::underlying_type min = -1e9,
+                    typename T::underlying_type max = 1e9) {
+    return [min, max](std::mt19937_64 &engine) {
+        std::uniform_real_distribution<> dis(min, max);
         std::array<T, InputSize> input;
-        auto result = generate_uniform_random_list<T>(min, max, InputSize);
-        std::copy(result.begin(), result.end(), input.begin());
-        inputs.push_back(input);
-    }
-    return inputs;
+        for (auto &value : input) {
+            value = static_cast<T>(dis(engine));
+        }
+        return input;
+    };
 }
 
 template <typename T, std::size_t InputSize>
-std::vector<std::array<T, InputSize>> normal_random_args(std::size_t count, typename T::underlying_type mean, typename T::underlying_type stddev) {
-    std::vector<std::array<T, InputSize>> inputs;
-    inputs.reserve(count);
-    for (std::size_t i = 0; i < count; ++i) {
+InputDistribution<T, InputSize>
+normal_random_args(typename T::underlying_type mean,
+                   typename T::underlying_type stddev) {
+    return [mean, stddev](std::mt19937_64 &engine) {
+        std::normal_distribution<> dis(mean, stddev);
         std::array<T, InputSize> input;
-        auto result = generate_normal_random_list<T>(mean, stddev, InputSize);
-        std::copy(result.begin(), result.end(), input.begin());
-        inputs.push_back(input);
-    }
-    return inputs;
+        for (auto &value : input) {
+            value = static_cast<T>(dis(engine));
+        }
+        return input;
+    };
 }
 
-template <typename T, std::size_t InputSize> 
-std::vector<std::array<T, InputSize>> selected_random_args(const std::vector<T>& collection, std::size_t count) {
-    std::vector<std::array<T, InputSize>> inputs;
-    inputs.reserve(count);
-    for (std::size_t i = 0; i < count; ++i) {
-        std::array<T, InputSize> input;
-        auto result = generate_selected_random_list<T>(collection, InputSize);
-        std::copy(result.begin(), result.end(), input.begin());
-        inputs.push_back(input);
+template <typename T, std::size_t InputSize>
+InputDistribution<T, InputSize>
+selected_random_args(const std::vector<T> &collection) {
+    if (collection.size() < InputSize) {
+        throw std::invalid_argument("Not enough special values provided");
     }
-    return inputs;
-}
\ No newline at end of file
+    return [collection](std::mt19937_64 &engine) {
+        std::uniform_int_distribution<std::size_t> dis(0,
+                                                       collection.size() - 1);
+        std::array<T, InputSize> input;
+        for (auto &value : input) {
+            value = static_cast<T>(collection[dis(engine)]);
+        }
+        return input;
+    };
+}
@@ -0,0 +1,222 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <rbatch>
+#include <rcmath>
+#include <rfloat>
+
+using rmath::RoundingMode;
+
+template <typename T> static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// Random values over a wide range of magnitudes and both signs, followed by
+// every special case the scalar functions treat separately
+template <typename T> static std::vector<T> test_values(std::size_t count) {
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<T> mantissa(-2, 2);
+    std::uniform_int_distribution<int> exponent(-40, 12);
+    std::vector<T> values(count);
+    for (auto &v : values) {
+        v = std::ldexp(mantissa(gen), exponent(gen));
+    }
+    const T specials[] = {0,
+                          -T(0),
+                          1,
+                          -1,
+                          2,
+                          T(0.5),
+                          std::numeric_limits<T>::infinity(),
+                          -std::numeric_limits<T>::infinity(),
+                          std::numeric_limits<T>::quiet_NaN(),
+                          std::numeric_limits<T>::denorm_min(),
+                          -std::numeric_limits<T>::denorm_min(),
+                          std::numeric_limits<T>::min(),
+                          std::numeric_limits<T>::max(),
+                          -std::numeric_limits<T>::max(),
+                          T(709.5),
+                          T(-745.5),
+                          T(88.5),
+                          T(-103.5),
+                          T(1e-9),
+                          T(1e30),
+                          T(3.14159265358979),
+                          T(1.5707963267948966)};
+    values.insert(values.end(), std::begin(specials), std::end(specials));
+    return values;
+}
+
+template <typename T, RoundingMode R> static void check_unary() {
+    using W = rstd::ReproducibleWrapper<T, R>;
+    const auto values = test_values<T>(4003);
+    const std::vector<W> input(values.begin(), values.end());
+    std::vector<W> output(input.size());
+
+    const auto check = [&](auto batch, auto scalar) {
+        batch(input, output);
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            CAPTURE(values[i]);
+            CHECK(same_bits(output[i].underlying_value(),
+                            scalar(input[i]).underlying_value()));
+        }
+    };
+    check([](const auto &x, auto &y) { rstd::batch::exp(x, y); },
+          [](W x) { return rstd::exp(x); });
+    check([](const auto &x, auto &y) { rstd::batch::log(x, y); },
+          [](W x) { return rstd::log(x); });
+    check([](const auto &x, auto &y) { rstd::batch::sin(x, y); },
+          [](W x) { return rstd::sin(x); });
+    check([](const auto &x, auto &y) { rstd::batch::cos(x, y); },
+          [](W x) { return rstd::cos(x); });
+    check([](const auto &x, auto &y) { rstd::batch::sqrt(x, y); },
+          [](W x) { return rstd::sqrt(x); });
+}
+
+template <typename T, RoundingMode R> static void check_pow() {
+    using W = rstd::ReproducibleWrapper<T, R>;
+    auto bases = test_values<T>(2003);
+    for (auto &b : bases) {
+        // Mostly positive bases, which take the vectorized path
+        if (b < 0 && &b - bases.data() < 1500) {
+            b = -b;
+        }
+    }
+    auto exponents = test_values<T>(bases.size() - 22);
+    std::shuffle(exponents.begin(), exponents.end(), std::mt19937(7));
+    const std::vector<W> x(bases.begin(), bases.end());
+    const std::vector<W> y(exponents.begin(), exponents.end());
+    std::vector<W> output(x.size());
+
+    rstd::batch::pow(x, y, output);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        CAPTURE(bases[i]);
+        CAPTURE(exponents[i]);
+        CHECK(same_bits(output[i].underlying_value(),
+                        rstd::pow(x[i], y[i]).underlying_value()));
+    }
+}
+
+template <typename T> static void check_all_modes() {
+    check_unary<T, RoundingMode::ToEven>();
+    check_unary<T, RoundingMode::ToPositive>();
+    check_unary<T, RoundingMode::ToNegative>();
+    check_unary<T, RoundingMode::ToZero>();
+    check_pow<T, RoundingMode::ToEven>();
+    check_pow<T, RoundingMode::ToPositive>();
+    check_pow<T, RoundingMode::ToNegative>();
+    check_pow<T, RoundingMode::ToZero>();
+}
+
+TEST_CASE("BatchTest.double_matches_scalar") { check_all_modes<double>(); }
+
+TEST_CASE("BatchTest.float_matches_scalar") { check_all_modes<float>(); }
+
+TEST_CASE("BatchTest.lengths_and_aliasing") {
+    const auto values = test_values<double>(41);
+    // Every length around the block size, so the tail is exercised
+    for (std::size_t length = 0; length <= values.size(); ++length) {
+        std::vector<rdouble> data(values.begin(), values.begin() + length);
+        std::vector<rdouble> expected(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            expected[i] = rstd::exp(data[i]);
+        }
+        // In place, through the pointer overload
+        rstd::batch::exp(data.data(), data.data() + length, data.data());
+        for (std::size_t i = 0; i < length; ++i) {
+            CHECK(same_bits(data[i].underlying_value(),
+                            expected[i].underlying_value()));
+        }
+    }
+
+    std::array<rdouble, 9> x;
+    std::array<rdouble, 9> y;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = 0.25 * double(i + 1);
+        y[i] = 1.5 - double(i);
+    }
+    std::array<rdouble, 9> expected;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        expected[i] = rstd::pow(x[i], y[i]);
+    }
+    // The result may replace the bases
+    rstd::batch::pow(x, y, x);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        CHECK(same_bits(x[i].underlying_value(),
+                        expected[i].underlying_value()));
+    }
+}
+
+// The kernels are shared with <rtranscendental>, so every lane has to
+// give the scalar approximation exactly, before any rounding
+TEST_CASE("BatchTest.kernels_match_scalar") {
+    namespace batch = rstd::detail::batch;
+    namespace crmath = rstd::detail::crmath;
+    constexpr std::size_t lanes = batch::lanes;
+    std::mt19937_64 gen(54321);
+    std::uniform_real_distribution<double> mantissa(1, 2);
+    std::uniform_int_distribution<int> exponent(-1000, 1000);
+    std::uniform_real_distribution<double> argument(-700, 700);
+    std::uniform_real_distribution<double> angle(0, 1e6);
+    auto matches = [](const batch::dd_pack &x, std::size_t i,
+                      const crmath::dd &y) {
+        return batch::lane(x.hi, i) == y.hi && batch::lane(x.lo, i) == y.lo;
+    };
+    for (int block = 0; block < 20000; ++block) {
+        double x[lanes], v[lanes], a[lanes];
+        for (std::size_t i = 0; i < lanes; ++i) {
+            x[i] = std::ldexp(mantissa(gen), exponent(gen));
+            v[i] = argument(gen);
+            a[i] = angle(gen);
+        }
+        const auto pack_of = [](const double(&values)[lanes]) {
+            return batch::generate([&](std::size_t i) { return values[i]; });
+        };
+
+        const batch::log_pack reduction = batch::reduce_log(pack_of(x));
+        const batch::dd_pack log_fast = batch::log_fast(reduction);
+        const batch::dd_pack log_accurate = batch::log_accurate(reduction);
+        int e[lanes];
+        const batch::dd_pack exp = batch::exp_fast({pack_of(v), 0.0}, e);
+        batch::pack k;
+        batch::pack error;
+        const batch::dd_pack r = batch::reduce_trig(pack_of(a), k, error);
+        batch::dd_pack sine;
+        batch::dd_pack cosine;
+        batch::sin_cos_fast(r, sine, cosine);
+
+        for (std::size_t i = 0; i < lanes; ++i) {
+            CAPTURE(x[i]);
+            CAPTURE(v[i]);
+            CAPTURE(a[i]);
+            const auto scalar_reduction =
+                crmath::reduce_log(rstd::detail::float_fields<double>(x[i]));
+            CHECK(matches(log_fast, i, crmath::log_fast(scalar_reduction)));
+            CHECK(matches(log_accurate, i,
+                          crmath::log_accurate(scalar_reduction)));
+
+            const auto exp_reduction = crmath::reduce_exp({v[i], 0});
+            int scalar_e;
+            const crmath::dd y = crmath::exp_fast(
+                crmath::exp2_table(exp_reduction.k, scalar_e),
+                exp_reduction.r);
+            CHECK(matches(exp, i, crmath::fast_two_sum(y.hi, y.lo)));
+            CHECK(e[i] == scalar_e);
+
+            const crmath::trig_reduction trig = crmath::reduce_trig(a[i]);
+            CHECK(matches(r, i, trig.r));
+            crmath::dd scalar_sine;
+            crmath::dd scalar_cosine;
+            crmath::sin_cos_fast(trig.r, &scalar_sine, &scalar_cosine);
+            CHECK(matches(sine, i, scalar_sine));
+            CHECK(matches(cosine, i, scalar_cosine));
+        }
+    }
+}
@@ -0,0 +1,308 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <rcharconv>
+#include <rfloat>
+
+template <typename W> static std::string format(const W &value) {
+    char buffer[64];
+    const auto result = rstd::to_chars(buffer, buffer + sizeof(buffer), value);
+    REQUIRE(result.ec == std::errc());
+    return std::string(buffer, result.ptr);
+}
+
+template <typename W> static W parse(const std::string &text) {
+    W value = 0;
+    const auto result =
+        rstd::from_chars(text.data(), text.data() + text.size(), value);
+    REQUIRE(result.ec == std::errc());
+    CHECK_EQ(result.ptr, text.data() + text.size());
+    return value;
+}
+
+template <typename T> static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// Classified by bits, since -ffast-math lets the compiler assume there are
+// no NaNs
+template <typename T> struct bit_fields {
+    using type = typename std::conditional<sizeof(T) == 8, std::uint64_t,
+                                           std::uint32_t>::type;
+    static constexpr type mantissa =
+        (type(1) << (std::numeric_limits<T>::digits - 1)) - 1;
+    static constexpr type exponent = type(~type(0) >> 1) & ~mantissa;
+
+    static type bits(T value) {
+        type result;
+        std::memcpy(&result, &value, sizeof(T));
+        return result;
+    }
+    static bool is_nan(T value) {
+        return (bits(value) & exponent) == exponent &&
+               (bits(value) & mantissa) != 0;
+    }
+    static bool is_subnormal(T value) {
+        return (bits(value) & exponent) == 0 && (bits(value) & mantissa) != 0;
+    }
+};
+
+// -ffast-math links in startup code that flushes subnormals to zero, which
+// the standard library's conversions can't work around
+#if defined(__FAST_MATH__)
+constexpr bool subnormals_supported = false;
+#else
+constexpr bool subnormals_supported = true;
+#endif
+
+template <typename W> static void check_round_trip(W value) {
+    using T = typename W::underlying_type;
+    using fields = bit_fields<T>;
+    const T x = value.underlying_value();
+    if (!subnormals_supported && fields::is_subnormal(x)) {
+        return;
+    }
+    const std::string text = format(value);
+    CAPTURE(text);
+    CHECK(text.size() <= rstd::shortest_chars_max<T>);
+    const T parsed = parse<W>(text).underlying_value();
+    if (fields::is_nan(x)) {
+        CHECK(fields::is_nan(parsed));
+    } else {
+        CHECK(same_bits(parsed, x));
+    }
+}
+
+TEST_CASE("CharconvTest.shortest_text") {
+    CHECK_EQ(format(rdouble(0.1)), "0.1");
+    CHECK_EQ(format(rdouble(-0.0)), "-0");
+    CHECK_EQ(format(rdouble(1e100)), "1e+100");
+    CHECK_EQ(format(rdouble(123456.0)), "123456");
+    CHECK_EQ(format(rdouble(0.1) + rdouble(0.2)), "0.30000000000000004");
+    if (subnormals_supported) {
+        CHECK_EQ(format(rdouble(std::numeric_limits<double>::denorm_min())),
+                 "5e-324");
+    }
+    CHECK_EQ(format(rdouble(-std::numeric_limits<double>::min())),
+             "-2.2250738585072014e-308");
+    CHECK_EQ(format(rdouble(std::numeric_limits<double>::max())),
+             "1.7976931348623157e+308");
+    CHECK_EQ(format(rdouble(std::numeric_limits<double>::infinity())), "inf");
+    CHECK_EQ(format(rdouble(-std::numeric_limits<double>::infinity())),
+             "-inf");
+    CHECK_EQ(format(rdouble(std::numeric_limits<double>::quiet_NaN())), "nan");
+
+    CHECK_EQ(format(rfloat(0.1f)), "0.1");
+    CHECK_EQ(format(rfloat(16777216.0f)), "16777216");
+    CHECK_EQ(format(rfloat(-std::numeric_limits<float>::min())),
+             "-1.1754944e-38");
+    CHECK_EQ(format(rfloat(std::numeric_limits<float>::max())),
+             "3.4028235e+38");
+}
+
+TEST_CASE("CharconvTest.formats_and_precision") {
+    char buffer[64];
+    auto result = rstd::to_chars(buffer, buffer + sizeof(buffer),
+                                 rdouble(1234.5), std::chars_format::scientific);
+    CHECK_EQ(std::string(buffer, result.ptr), "1.2345e+03");
+    result = rstd::to_chars(buffer, buffer + sizeof(buffer), rdouble(1234.5),
+                            std::chars_format::fixed, 3);
+    CHECK_EQ(std::string(buffer, result.ptr), "1234.500");
+    result = rstd::to_chars(buffer, buffer + sizeof(buffer), rdouble(1.0 / 3),
+                            std::chars_format::general, 17);
+    CHECK_EQ(std::string(buffer, result.ptr), "0.33333333333333331");
+
+    // Too small a buffer is reported, not overrun
+    result = rstd::to_chars(buffer, buffer + 3, rdouble(0.125));
+    CHECK(result.ec == std::errc::value_too_large);
+}
+
+TEST_CASE("CharconvTest.round_trip") {
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 100000; ++i) {
+        // Every bit pattern is equally likely, so subnormals, huge values
+        // and NaNs are all covered
+        std::uint64_t bits = gen();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        float f;
+        const auto bits32 = std::uint32_t(bits >> 32);
+        std::memcpy(&f, &bits32, sizeof(f));
+
+        check_round_trip(rdouble(d));
+        check_round_trip(rfloat(f));
+    }
+}
+
+TEST_CASE("CharconvTest.from_chars") {
+    // Correctly rounded, including halfway cases iostreams have got wrong
+    CHECK_EQ(parse<rdouble>("0.1"), rdouble(0.1));
+    CHECK_EQ(parse<rdouble>("2.2250738585072011e-308"),
+             rdouble(2.2250738585072011e-308));
+    CHECK_EQ(parse<rdouble>("9007199254740993"), rdouble(9007199254740992.0));
+    CHECK_EQ(parse<rfloat>("16777217"), rfloat(16777216.0f));
+
+    rdouble value = 5.0;
+    const std::string invalid = "x1";
+    auto result = rstd::from_chars(invalid.data(),
+                                   invalid.data() + invalid.size(), value);
+    CHECK(result.ec == std::errc::invalid_argument);
+    CHECK_EQ(value, rdouble(5.0));
+
+    const std::string tiny = "1e-400";
+    result = rstd::from_chars(tiny.data(), tiny.data() + tiny.size(), value);
+    CHECK(result.ec == std::errc::result_out_of_range);
+    CHECK_EQ(value, rdouble(5.0));
+
+    const std::string partial = "2.5,3";
+    result = rstd::from_chars(partial.data(), partial.data() + partial.size(),
+                              value);
+    CHECK(result.ec == std::errc());
+    CHECK_EQ(result.ptr, partial.data() + 3);
+    CHECK_EQ(value, rdouble(2.5));
+}
+
+// Writes a comma as the decimal point and groups thousands
+struct comma_numpunct : std::numpunct<char> {
+    char do_decimal_point() const override { return ','; }
+    char do_thousands_sep() const override { return '.'; }
+    std::string do_grouping() const override { return "\3"; }
+};
+
+TEST_CASE("CharconvTest.shortest_manipulator") {
+    std::ostringstream out;
+    out.imbue(std::locale(out.getloc(), new comma_numpunct));
+    out << std::setprecision(3) << std::scientific;
+    out << rstd::shortest(rdouble(1234.5)) << ' '
+        << rstd::shortest(rfloat(0.1f)) << ' ' << rstd::shortest(2.5) << ' '
+        << std::setw(6) << rstd::shortest(rdouble(-1.5)) << '|' << std::left
+        << std::setfill('*') << std::setw(5) << rstd::shortest(rdouble(7))
+        << '|';
+    CHECK_EQ(out.str(), "1234.5 0.1 2.5   -1.5|7****|");
+
+    // What the manipulator replaces
+    std::ostringstream stream;
+    stream.imbue(std::locale(stream.getloc(), new comma_numpunct));
+    stream << rdouble(1234.5);
+    CHECK_EQ(stream.str(), "1.234,5");
+}
+
+TEST_CASE("CharconvTest.parse_values") {
+    const std::string text = " 1.5,2e3\t-0.25 ,\r\n+4 , , inf\n7";
+    std::vector<rdouble> values = {rdouble(9.0)};
+    auto result =
+        rstd::parse_values(text.data(), text.data() + text.size(), values);
+    CHECK(result.ec == std::errc());
+    CHECK_EQ(result.ptr, text.data() + text.size());
+    REQUIRE_EQ(values.size(), 7);
+    CHECK_EQ(values[0], rdouble(9.0));
+    CHECK_EQ(values[1], rdouble(1.5));
+    CHECK_EQ(values[2], rdouble(2000.0));
+    CHECK_EQ(values[3], rdouble(-0.25));
+    CHECK_EQ(values[4], rdouble(4.0));
+    CHECK_EQ(format(values[5]), "inf");
+    CHECK_EQ(values[6], rdouble(7.0));
+
+    // Stops at the first bad token, keeping the values before it
+    std::vector<rfloat> floats;
+    const std::string bad = "1 2 3x 4";
+    result = rstd::parse_values(bad.data(), bad.data() + bad.size(), floats);
+    CHECK(result.ec == std::errc::invalid_argument);
+    CHECK_EQ(result.ptr, bad.data() + 4);
+    CHECK_EQ(floats.size(), 2);
+
+    const std::string sign = "+-1";
+    result = rstd::parse_values(sign.data(), sign.data() + sign.size(), floats);
+    CHECK(result.ec == std::errc::invalid_argument);
+    CHECK_EQ(result.ptr, sign.data());
+
+    const std::string huge = "1,1e40";
+    result = rstd::parse_values(huge.data(), huge.data() + huge.size(), floats);
+    CHECK(result.ec == std::errc::result_out_of_range);
+    CHECK_EQ(result.ptr, huge.data() + 2);
+    CHECK_EQ(floats.size(), 3);
+
+    const std::string empty = " ,\n";
+    result =
+        rstd::parse_values(empty.data(), empty.data() + empty.size(), floats);
+    CHECK(result.ec == std::errc());
+    CHECK_EQ(floats.size(), 3);
+}
+
+TEST_CASE("CharconvTest.parse_values_round_trip") {
+    std::mt19937_64 gen(7);
+    std::vector<rdouble> written;
+    std::string text;
+    char buffer[rstd::shortest_chars_max<double>];
+    while (written.size() < 10000) {
+        std::uint64_t bits = gen();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        if (bit_fields<double>::is_nan(d) ||
+            (!subnormals_supported && bit_fields<double>::is_subnormal(d))) {
+            continue;
+        }
+        written.push_back(rdouble(d));
+        text.append(buffer, rstd::to_chars(buffer, buffer + sizeof(buffer),
+                                           written.back())
+                                .ptr);
+        text += written.size() % 8 == 0 ? "\n" : ", ";
+    }
+    std::vector<rdouble> parsed;
+    const auto result =
+        rstd::parse_values(text.data(), text.data() + text.size(), parsed);
+    CHECK(result.ec == std::errc());
+    REQUIRE_EQ(parsed.size(), written.size());
+    for (std::size_t i = 0; i < parsed.size(); ++i) {
+        CHECK(same_bits(parsed[i].underlying_value(),
+                        written[i].underlying_value()));
+    }
+}
+
+TEST_CASE("CharconvTest.parse_manipulator") {
+    std::istringstream in("  1234.5 +0.1,2 inf 9007199254740993 x");
+    in.imbue(std::locale(in.getloc(), new comma_numpunct));
+    rdouble a = 0, b = 0, d = 0, e = 0;
+    rfloat c = 0;
+    in >> rstd::parse(a) >> rstd::parse(b);
+    CHECK_EQ(a, rdouble(1234.5));
+    CHECK_EQ(b, rdouble(0.1));
+    CHECK_EQ(in.get(), ',');
+    in >> rstd::parse(c) >> rstd::parse(d) >> rstd::parse(e);
+    CHECK(in.good());
+    CHECK_EQ(c, rfloat(2.0f));
+    CHECK_EQ(format(d), "inf");
+    CHECK_EQ(e, rdouble(9007199254740992.0));
+
+    // A token that isn't a number sets failbit and leaves the value alone
+    in >> rstd::parse(a);
+    CHECK(in.fail());
+    CHECK_EQ(a, rdouble(1234.5));
+
+    std::istringstream partial("1.5e");
+    partial >> rstd::parse(a);
+    CHECK(partial.fail());
+    CHECK_EQ(a, rdouble(1234.5));
+
+    double plain = 0;
+    std::istringstream last("-2.5");
+    last >> rstd::parse(plain);
+    CHECK(!last.fail());
+    CHECK(last.eof());
+    CHECK_EQ(plain, -2.5);
+
+    std::istringstream noskip(" 1");
+    noskip >> std::noskipws >> rstd::parse(plain);
+    CHECK(noskip.fail());
+}
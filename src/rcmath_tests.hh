@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <utility>
 #include <vector>
 
 template <typename T>
@@ -38,6 +39,39 @@ static T fir_filter(const std::vector<T>& coeff, std::vector<T>& input_hist, std
     return output;
 }
 
+// Textbook in-place radix-2 FFT, decimated in time. data.size() must be a
+// power of two, and roots[k] = e^(-2 pi i k / n) for k < n / 2.
+static std::vector<Array2> fft(std::vector<Array2> data, const std::vector<Array2>& roots) {
+    const std::size_t n = data.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    for (std::size_t length = 2; length <= n; length *= 2) {
+        const std::size_t half = length / 2;
+        for (std::size_t i = 0; i < n; i += length) {
+            for (std::size_t k = 0; k < half; ++k) {
+                const Array2& w = roots[k * (n / length)];
+                const Array2 u = data[i + k];
+                const Array2 v = data[i + k + half];
+                T re = v[0] * w[0] - v[1] * w[1];
+                T im = v[0] * w[1] + v[1] * w[0];
+                data[i + k] = Array2{u[0] + re, u[1] + im};
+                data[i + k + half] = Array2{u[0] - re, u[1] - im};
+            }
+        }
+    }
+
+    return data;
+}
+
 static Matrix matrix_multiply(const Matrix& A,
                                                 const Matrix& B) {
     Matrix C{};
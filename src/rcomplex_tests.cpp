@@ -0,0 +1,324 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <rcmath>
+#include <rcomplex>
+#include <rfloat>
+
+#include "rcmath_tests.hh"
+
+using cdouble = rstd::complex<rdouble>;
+using cfloat = rstd::complex<rfloat>;
+
+template <typename T> static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T, rmath::RoundingMode R>
+static bool same_bits(const rstd::complex<rstd::ReproducibleWrapper<T, R>> &z,
+                      T re, T im) {
+    return same_bits(z.real().underlying_value(), re) &&
+           same_bits(z.imag().underlying_value(), im);
+}
+
+// The formulas of <rcomplex> on plain values, with every intermediate
+// stored to a volatile so that nothing is contracted or reassociated
+template <typename T> struct Reference {
+    static T round(T x) {
+        volatile T stored = x;
+        return stored;
+    }
+
+    static std::complex<T> multiply(T a, T b, T c, T d) {
+        const T ac = round(a * c);
+        const T bd = round(b * d);
+        const T ad = round(a * d);
+        const T bc = round(b * c);
+        return {round(ac - bd), round(ad + bc)};
+    }
+
+    static std::complex<T> divide(T a, T b, T c, T d) {
+        int k;
+        std::frexp(std::fabs(c) > std::fabs(d) ? c : d, &k);
+        const T scale = std::ldexp(T(1), 1 - k);
+        const T cs = round(c * scale);
+        const T ds = round(d * scale);
+        const T divisor = round(round(cs * cs) + round(ds * ds));
+        const T re = round(round(round(a * cs) + round(b * ds)) / divisor);
+        const T im = round(round(round(b * cs) - round(a * ds)) / divisor);
+        return {round(re * scale), round(im * scale)};
+    }
+};
+
+// Random components over a range of magnitudes wide enough for the scaling
+// to matter, but with no intermediate result overflowing or going
+// subnormal
+template <typename T>
+static std::vector<T> random_components(std::size_t count, unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<T> mantissa(-2, 2);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    std::vector<T> values(count);
+    for (auto &value : values) {
+        value = std::ldexp(mantissa(gen), exponent(gen));
+    }
+    return values;
+}
+
+template <typename T> static void check_formulas() {
+    using wrapper = rstd::ReproducibleWrapper<T>;
+    using complex = rstd::complex<wrapper>;
+    const auto values = random_components<T>(4000, 1);
+    for (std::size_t i = 0; i < values.size(); i += 4) {
+        const T a = values[i];
+        const T b = values[i + 1];
+        const T c = values[i + 2];
+        const T d = values[i + 3];
+        const complex x(a, b);
+        const complex y(c, d);
+
+        const std::complex<T> product = Reference<T>::multiply(a, b, c, d);
+        CHECK(same_bits(x * y, product.real(), product.imag()));
+
+        const std::complex<T> quotient = Reference<T>::divide(a, b, c, d);
+        CHECK(same_bits(x / y, quotient.real(), quotient.imag()));
+
+        CHECK(same_bits(x + y, T(a + c), T(b + d)));
+        CHECK(same_bits(x - y, T(a - c), T(b - d)));
+        CHECK(same_bits(x * wrapper(c), T(a * c), T(b * c)));
+        CHECK(same_bits(x / wrapper(c), T(a / c), T(b / c)));
+    }
+}
+
+TEST_CASE("ComplexTest.float_formulas") { check_formulas<float>(); }
+
+TEST_CASE("ComplexTest.double_formulas") { check_formulas<double>(); }
+
+TEST_CASE("ComplexTest.algorithms_are_pinned") {
+    // (1 + 2i) / (3 + 4i) = 0.44 + 0.08i
+    CHECK(same_bits(cdouble(1.0, 2.0) / cdouble(3.0, 4.0),
+                    0x1.c28f5c28f5c29p-2, 0x1.47ae147ae147bp-4));
+    CHECK(same_bits(cdouble(0.1, 0.7) * cdouble(0.3, -0.9),
+                    0x1.51eb851eb851fp-1, 0x1.eb851eb851eb7p-4));
+    CHECK(same_bits(cfloat(0.1f, 0.7f) / cfloat(0.3f, -0.9f),
+                    -0x1.555556p-1f, 0x1.555556p-2f));
+    CHECK(same_bits(rstd::abs(cdouble(0.1, 0.7)).underlying_value(),
+                    0x1.6a09e667f3bccp-1));
+}
+
+template <typename T> static void check_division_range() {
+    using complex = rstd::complex<rstd::ReproducibleWrapper<T>>;
+    const T huge = std::numeric_limits<T>::max() / 4;
+    const T tiny = std::numeric_limits<T>::min() * 4;
+
+    // |c|^2 overflows or underflows without the scaling
+    const complex big_divisor = complex(T(2), T(1)) / complex(huge, huge);
+    const complex small_divisor = complex(T(2), T(1)) * complex(tiny, tiny);
+    CHECK(std::isfinite(big_divisor.real().underlying_value()));
+    CHECK(big_divisor.real() != T(0));
+
+    const complex one = small_divisor / small_divisor;
+    CHECK(one.real() == T(1));
+    CHECK(one.imag() == T(0));
+
+    const complex quotient = complex(huge, -huge) / complex(huge, huge);
+    CHECK(quotient.real() == T(0));
+    CHECK(quotient.imag() == T(-1));
+}
+
+TEST_CASE("ComplexTest.float_division_range") { check_division_range<float>(); }
+
+TEST_CASE("ComplexTest.double_division_range") { check_division_range<double>(); }
+
+TEST_CASE("ComplexTest.fused_multiply_keeps_cancelled_bits") {
+    const double a = 1 + 0x1p-30;
+    const double c = 1 - 0x1p-30;
+    const cdouble x(a, 1.0);
+    const cdouble y(c, 1.0);
+    // a*c - 1 = -2^-60 exactly, but a*c rounds to 1
+    CHECK((x * y).real() == 0.0);
+    const cdouble fused = rstd::fused_multiply(x, y);
+    CHECK(same_bits(fused.real().underlying_value(), -0x1p-60));
+    CHECK(same_bits(fused.imag().underlying_value(), 2.0));
+}
+
+template <typename T> static void check_abs() {
+    using complex = rstd::complex<rstd::ReproducibleWrapper<T>>;
+    const auto values = random_components<T>(4000, 2);
+    for (std::size_t i = 0; i < values.size(); i += 2) {
+        const long double exact =
+            std::hypot((long double)values[i], (long double)values[i + 1]);
+        const T result =
+            rstd::abs(complex(values[i], values[i + 1])).underlying_value();
+        const long double ulp =
+            std::ldexp((long double)1, std::ilogb(result) -
+                                           std::numeric_limits<T>::digits + 1);
+        // Three roundings before the square root, and the root itself
+        CHECK(std::fabs(result - exact) <= 1.5L * ulp);
+    }
+
+    const T huge = std::numeric_limits<T>::max() / 2;
+    CHECK(rstd::abs(complex(huge, huge)).underlying_value() ==
+          T(huge * std::sqrt(T(2))));
+    const T tiny = std::numeric_limits<T>::min();
+    CHECK(rstd::abs(complex(T(3) * tiny, T(4) * tiny)) == T(5) * tiny);
+    CHECK(rstd::abs(complex(T(-3), T(4))) == T(5));
+
+    const T infinity = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    CHECK(same_bits(rstd::abs(complex(nan, -infinity)).underlying_value(),
+                    infinity));
+    CHECK(same_bits(rstd::abs(complex(infinity, nan)).underlying_value(),
+                    infinity));
+}
+
+TEST_CASE("ComplexTest.float_abs") { check_abs<float>(); }
+
+TEST_CASE("ComplexTest.double_abs") { check_abs<double>(); }
+
+TEST_CASE("ComplexTest.transcendental_functions") {
+    const auto values = random_components<double>(1000, 3);
+    for (std::size_t i = 0; i < values.size(); i += 2) {
+        const rdouble re = values[i];
+        const rdouble im = values[i + 1];
+        const cdouble z(re, im);
+        CHECK(same_bits(rstd::arg(z).underlying_value(),
+                        rstd::atan2(im, re).underlying_value()));
+
+        const rdouble r = rstd::exp(re);
+        const cdouble e = rstd::exp(z);
+        CHECK(same_bits(e, (r * rstd::cos(im)).underlying_value(),
+                        (r * rstd::sin(im)).underlying_value()));
+        CHECK(same_bits(rstd::polar(re, im),
+                        (re * rstd::cos(im)).underlying_value(),
+                        (re * rstd::sin(im)).underlying_value()));
+    }
+
+    // Real arguments stay real, even once e^x overflows
+    const cdouble overflow = rstd::exp(cdouble(1000.0, 0.0));
+    CHECK(same_bits(overflow.real().underlying_value(),
+                    std::numeric_limits<double>::infinity()));
+    CHECK(same_bits(overflow.imag().underlying_value(), 0.0));
+    CHECK(same_bits(rstd::exp(cdouble(0.0, -0.0)), 1.0, -0.0));
+}
+
+template <typename T> static void check_batch() {
+    using wrapper = rstd::ReproducibleWrapper<T>;
+    using complex = rstd::complex<wrapper>;
+    // Not a multiple of any lane count, so the scalar tail runs too
+    constexpr std::size_t count = 1001;
+    const auto values = random_components<T>(4 * count, 4);
+    std::vector<wrapper> a_re(values.begin(), values.begin() + count);
+    std::vector<wrapper> a_im(values.begin() + count,
+                              values.begin() + 2 * count);
+    std::vector<wrapper> b_re(values.begin() + 2 * count,
+                              values.begin() + 3 * count);
+    std::vector<wrapper> b_im(values.begin() + 3 * count, values.end());
+    // Special values in the first block and in the tail
+    const T infinity = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    for (std::size_t i : {std::size_t(1), count - 1}) {
+        a_re[i] = infinity;
+        a_im[i] = nan;
+        b_re[i - 1] = 0;
+        b_im[i - 1] = 0;
+    }
+
+    std::vector<wrapper> re(count);
+    std::vector<wrapper> im(count);
+    std::vector<wrapper> magnitude(count);
+
+    rstd::batch::complex_multiply(a_re.data(), a_im.data(), b_re.data(),
+                                  b_im.data(), count, re.data(), im.data());
+    for (std::size_t i = 0; i < count; ++i) {
+        const complex product = complex(a_re[i], a_im[i]) *
+                                complex(b_re[i], b_im[i]);
+        CHECK(same_bits(re[i].underlying_value(),
+                        product.real().underlying_value()));
+        CHECK(same_bits(im[i].underlying_value(),
+                        product.imag().underlying_value()));
+    }
+
+    rstd::batch::complex_divide(a_re.data(), a_im.data(), b_re.data(),
+                                b_im.data(), count, re.data(), im.data());
+    for (std::size_t i = 0; i < count; ++i) {
+        const complex quotient = complex(a_re[i], a_im[i]) /
+                                 complex(b_re[i], b_im[i]);
+        CHECK(same_bits(re[i].underlying_value(),
+                        quotient.real().underlying_value()));
+        CHECK(same_bits(im[i].underlying_value(),
+                        quotient.imag().underlying_value()));
+    }
+
+    rstd::batch::complex_abs(a_re.data(), a_im.data(), count,
+                             magnitude.data());
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK(same_bits(
+            magnitude[i].underlying_value(),
+            rstd::abs(complex(a_re[i], a_im[i])).underlying_value()));
+    }
+
+    // In place
+    std::vector<wrapper> expected_re = b_re;
+    std::vector<wrapper> expected_im = b_im;
+    rstd::batch::complex_multiply(a_re.data(), a_im.data(), b_re.data(),
+                                  b_im.data(), count, expected_re.data(),
+                                  expected_im.data());
+    rstd::batch::complex_multiply(a_re.data(), a_im.data(), b_re.data(),
+                                  b_im.data(), count, b_re.data(),
+                                  b_im.data());
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK(same_bits(b_re[i].underlying_value(),
+                        expected_re[i].underlying_value()));
+        CHECK(same_bits(b_im[i].underlying_value(),
+                        expected_im[i].underlying_value()));
+    }
+}
+
+TEST_CASE("ComplexTest.float_batch_matches_scalar") { check_batch<float>(); }
+
+TEST_CASE("ComplexTest.double_batch_matches_scalar") { check_batch<double>(); }
+
+TEST_CASE("ComplexTest.mandelbrot_matches_hand_written") {
+    using Functions = TestFunctions<rdouble>;
+    const auto values = random_components<double>(400, 5);
+    for (std::size_t i = 0; i < values.size(); i += 2) {
+        const Functions::Array2 c = {rdouble(values[i] * 0x1p-20),
+                                     rdouble(values[i + 1] * 0x1p-20)};
+        const Functions::Array2 expected = Functions::mandelbrot(c, 50);
+
+        const cdouble point(c[0], c[1]);
+        cdouble z;
+        for (int n = 0; n < 50 && !(rstd::norm(z) > rdouble(4)); ++n) {
+            z = z * z + point;
+        }
+        CHECK(same_bits(z, expected[0].underlying_value(),
+                        expected[1].underlying_value()));
+    }
+}
+
+TEST_CASE("ComplexTest.std_complex_interoperability") {
+    const std::complex<double> value(0.25, -3.5);
+    const cdouble z = value;
+    CHECK(static_cast<std::complex<double>>(z) == value);
+    CHECK(rstd::real(z) == 0.25);
+    CHECK(rstd::imag(rstd::conj(z)) == 3.5);
+    CHECK(rstd::norm(z) == 0.0625 + 12.25);
+
+    std::ostringstream out;
+    out << z;
+    CHECK(out.str() == "(0.25,-3.5)");
+
+    std::istringstream in("(1.5,2)");
+    cdouble parsed;
+    in >> parsed;
+    CHECK(parsed == cdouble(1.5, 2.0));
+}
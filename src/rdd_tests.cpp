@@ -0,0 +1,225 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <rdd>
+#include <rfloat>
+#include <rnumeric>
+
+static std::uint64_t bits_of(double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static bool same_bits(const rdouble_dd &x, double hi, double lo) {
+    return bits_of(x.hi().underlying_value()) == bits_of(hi) &&
+           bits_of(x.lo().underlying_value()) == bits_of(lo);
+}
+
+// Random double-doubles with magnitudes from 2^-30 to 2^30 and a full low
+// part, so that no intermediate result is subnormal
+static std::vector<rdouble_dd> random_values(std::size_t count,
+                                             unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::vector<rdouble_dd> values(count);
+    for (auto &value : values) {
+        const double hi = std::ldexp(mantissa(gen), exponent(gen));
+        const double lo = hi * mantissa(gen) * 0x1p-53;
+        value = rstd::two_sum(hi, lo);
+    }
+    return values;
+}
+
+// The exact value of a sum of double-doubles and exact products of them,
+// rounded once
+class ExactSum {
+  public:
+    ExactSum &add(const rdouble_dd &x) {
+        m_terms.push_back(x.hi());
+        m_terms.push_back(x.lo());
+        return *this;
+    }
+
+    ExactSum &subtract(const rdouble_dd &x) { return add(-x); }
+
+    ExactSum &add_product(const rdouble_dd &x, const rdouble_dd &y) {
+        add(rstd::two_prod(x.hi(), y.hi()));
+        add(rstd::two_prod(x.hi(), y.lo()));
+        add(rstd::two_prod(x.lo(), y.hi()));
+        return add(rstd::two_prod(x.lo(), y.lo()));
+    }
+
+    double result() const {
+        return rstd::reproducible_sum(m_terms).underlying_value();
+    }
+
+  private:
+    std::vector<rdouble> m_terms;
+};
+
+// hi must be hi + lo rounded to nearest
+static void check_normalized(const rdouble_dd &x) {
+    CHECK(x.hi() + x.lo() == x.hi());
+}
+
+TEST_CASE("DoubleDoubleTest.two_sum_and_two_prod_are_exact") {
+    const rdouble_dd sum = rstd::two_sum(1.0, 0x1p-80);
+    CHECK(same_bits(sum, 1.0, 0x1p-80));
+    const rdouble_dd product =
+        rstd::two_prod(1.0 + 0x1p-30, 1.0 + 0x1p-30);
+    CHECK(same_bits(product, 1.0 + 0x1p-29, 0x1p-60));
+    CHECK(same_bits(rstd::two_sum(0x1p60, -0x1p60), 0.0, 0.0));
+}
+
+TEST_CASE("DoubleDoubleTest.addition_and_subtraction_accurate_to_2_104") {
+    const auto a = random_values(20000, 1);
+    const auto b = random_values(20000, 2);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const rdouble_dd sum = a[i] + b[i];
+        const rdouble_dd difference = a[i] - b[i];
+        check_normalized(sum);
+        check_normalized(difference);
+        CHECK(std::abs(ExactSum().add(a[i]).add(b[i]).subtract(sum).result()) <=
+              0x1p-104 * std::abs(sum.fp64()));
+        CHECK(std::abs(ExactSum()
+                           .add(a[i])
+                           .subtract(b[i])
+                           .subtract(difference)
+                           .result()) <=
+              0x1p-104 * std::abs(difference.fp64()));
+    }
+    // Cancelling high parts leave the low parts exact
+    const rdouble_dd x = rdouble_dd::from_parts(1.0, 0x1p-60);
+    const rdouble_dd y = rdouble_dd::from_parts(1.0, -0x1p-70);
+    CHECK(same_bits(x - y, 0x1p-60 + 0x1p-70, 0.0));
+}
+
+TEST_CASE("DoubleDoubleTest.multiplication_accurate_to_2_104") {
+    const auto a = random_values(20000, 3);
+    const auto b = random_values(20000, 4);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const rdouble_dd product = a[i] * b[i];
+        check_normalized(product);
+        CHECK(std::abs(ExactSum()
+                           .add_product(a[i], b[i])
+                           .subtract(product)
+                           .result()) <= 0x1p-104 * std::abs(product.fp64()));
+    }
+}
+
+TEST_CASE("DoubleDoubleTest.division_and_sqrt_accurate_to_2_103") {
+    const auto a = random_values(20000, 5);
+    const auto b = random_values(20000, 6);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        // q * b - a, relative to a, is the relative error of q
+        const rdouble_dd quotient = a[i] / b[i];
+        check_normalized(quotient);
+        CHECK(std::abs(ExactSum()
+                           .add_product(quotient, b[i])
+                           .subtract(a[i])
+                           .result()) <= 0x1p-103 * std::abs(a[i].fp64()));
+
+        // r * r - x, relative to 2x, is the relative error of r
+        const rdouble_dd x = abs(a[i]);
+        const rdouble_dd root = rstd::sqrt(x);
+        check_normalized(root);
+        CHECK(std::abs(ExactSum().add_product(root, root).subtract(x).result()) <=
+              0x1p-103 * 2 * x.fp64());
+    }
+    CHECK(same_bits(rdouble_dd(1.0) / rdouble_dd(3.0), 0x1.5555555555555p-2,
+                    0x1.5555555555555p-56));
+    CHECK(same_bits(rstd::sqrt(rdouble_dd(2.0)), 0x1.6a09e667f3bcdp+0,
+                    -0x1.bdd3413b26455p-54));
+}
+
+// -ffast-math may enable flush-to-zero, which loses subnormal low parts
+static bool flushes_subnormals() {
+    volatile double smallest = std::numeric_limits<double>::min();
+    volatile double half = smallest / 2;
+    return half == 0;
+}
+
+TEST_CASE("DoubleDoubleTest.extreme_products_match_with_and_without_fma") {
+    // The error of the high parts' product is subnormal
+    if (!flushes_subnormals()) {
+        const rdouble_dd tiny =
+            rdouble_dd::from_parts(0x1.25ed7f321b3e9p-492,
+                                   0x1.d243c85234bcap-552) *
+            rdouble_dd::from_parts(0x1.e2e9ec3f93b2p-509,
+                                   0x1.5b3f46ff0d5c4p-569);
+        CHECK(same_bits(tiny, 0x1.153adef286177p-1000,
+                        -0x0.00000001600e9p-1022));
+    }
+
+    // Splitting the high parts for an exact product would overflow
+    const rdouble_dd huge =
+        rdouble_dd::from_parts(0x1.5bf0a8b145769p+1000,
+                               0x1.4d57ee2b1013ap+946) *
+        rdouble_dd::from_parts(0x1.921fb54442d18p-20,
+                               0x1.1a62633145c07p-74);
+    CHECK(same_bits(huge, 0x1.114580b45d475p+981, -0x1.867bdea1974bcp+927));
+    const rdouble_dd quotient =
+        rdouble_dd::from_parts(0x1.5bf0a8b145769p+1010,
+                               0x1.4d57ee2b1013ap+956) /
+        rdouble_dd::from_parts(0x1.921fb54442d18p+3, 0x1.1a62633145c07p-51);
+    CHECK(same_bits(quotient, 0x1.bb02d4eca8f95p+1006,
+                    0x1.910f23e7abf6cp+951));
+}
+
+TEST_CASE("DoubleDoubleTest.long_computations_are_reproducible") {
+    // H(100000) to about 30 digits, through 100000 divisions and additions.
+    // The exact value is 12.0901461298634279473632193635042...
+    rdouble_dd harmonic = 0.0;
+    for (int k = 1; k <= 100000; ++k) {
+        harmonic += rdouble_dd(1.0) / rdouble_dd(double(k));
+    }
+    CHECK(same_bits(harmonic, 0x1.82e27a22f3fbp+3, 0x1.38fcd89ac292cp-51));
+
+    // Newton's iteration for 1 / sqrt(3), mixed with double operands
+    rdouble_dd y = 0.5;
+    for (int i = 0; i < 8; ++i) {
+        y = y * (1.5 - rdouble(0.5) * 3.0 * y * y);
+    }
+    const rdouble_dd error = y * y * 3.0 - 1.0;
+    CHECK(std::abs(error.fp64()) <= 0x1p-102);
+}
+
+TEST_CASE("DoubleDoubleTest.comparisons_and_special_values") {
+    const rdouble_dd one = 1.0;
+    const rdouble_dd above = rdouble_dd::from_parts(1.0, 0x1p-80);
+    CHECK(one < above);
+    CHECK(above > one);
+    CHECK(one <= one);
+    CHECK(above >= one);
+    CHECK(one != above);
+    CHECK(-above < one);
+    CHECK(abs(-above) == above);
+    CHECK(static_cast<rdouble>(above) == rdouble(1.0));
+
+    rdouble_dd x = 2.0;
+    x *= 3.0;
+    x -= rdouble(1.0);
+    x /= 5.0;
+    x += 1.0;
+    CHECK(same_bits(x, 2.0, 0.0));
+
+    // Non-finite results keep a zero low part
+    const rdouble_dd infinity = rdouble_dd(1.0) / rdouble_dd(0.0);
+    CHECK(bits_of(infinity.fp64()) == 0x7ff0000000000000);
+    CHECK(bits_of(infinity.lo().underlying_value()) == 0);
+    const rdouble_dd sum = infinity + 1.0;
+    CHECK(same_bits(sum, infinity.fp64(), 0.0));
+    const rdouble_dd product = rdouble_dd(0x1p1000) * rdouble_dd(0x1p100);
+    CHECK(same_bits(product, infinity.fp64(), 0.0));
+    CHECK(same_bits(rstd::sqrt(rdouble_dd(0.0)), 0.0, 0.0));
+    CHECK((bits_of(rstd::sqrt(rdouble_dd(-1.0)).fp64()) & 0x7ff0000000000000) ==
+          0x7ff0000000000000);
+}
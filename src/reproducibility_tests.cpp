@@ -1,75 +1,19 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest/doctest.h"
 #include "rcmath_tests.hh"
+#include <iomanip>
+#include <sstream>
 #include <rcmath>
 #include <rfloat>
 
 #include "reproducibility_tests.hh"
 
-// Include the test cases
-// Might be time to break this up into smaller files
-#include "testdata/random_abs_testdata.hh"
-#include "testdata/random_acos_testdata.hh"
-#include "testdata/random_acosh_testdata.hh"
-#include "testdata/random_asin_testdata.hh"
-#include "testdata/random_asinh_testdata.hh"
-#include "testdata/random_atan2_testdata.hh"
-#include "testdata/random_atan_testdata.hh"
-#include "testdata/random_atanh_testdata.hh"
-#include "testdata/random_cbrt_testdata.hh"
-#include "testdata/random_ceil_testdata.hh"
-#include "testdata/random_cos_testdata.hh"
-#include "testdata/random_cosh_testdata.hh"
-#include "testdata/random_erf_testdata.hh"
-#include "testdata/random_erfc_testdata.hh"
-#include "testdata/random_exp2_testdata.hh"
-#include "testdata/random_exp_testdata.hh"
-#include "testdata/random_expm1_testdata.hh"
-#include "testdata/random_fdim_testdata.hh"
-#include "testdata/random_floor_testdata.hh"
-#include "testdata/random_fma_testdata.hh"
-#include "testdata/random_fmax_testdata.hh"
-#include "testdata/random_fmin_testdata.hh"
-#include "testdata/random_fmod_testdata.hh"
-#include "testdata/random_hypot_testdata.hh"
-#include "testdata/random_iostream_large_testdata.hh"
-#include "testdata/random_iostream_medium_testdata.hh"
-#include "testdata/random_iostream_small_testdata.hh"
-#include "testdata/random_isgreater_testdata.hh"
-#include "testdata/random_isgreaterequal_testdata.hh"
-#include "testdata/random_isless_testdata.hh"
-#include "testdata/random_islessequal_testdata.hh"
-#include "testdata/random_islessgreater_testdata.hh"
-#include "testdata/random_lerp_testdata.hh"
-#include "testdata/random_lgamma_testdata.hh"
-#include "testdata/random_log10_testdata.hh"
-#include "testdata/random_log1p_testdata.hh"
-#include "testdata/random_log2_testdata.hh"
-#include "testdata/random_log_testdata.hh"
-#include "testdata/random_logistic_map_testdata.hh"
-#include "testdata/random_lorenz_testdata.hh"
-#include "testdata/random_mandelbrot_testdata.hh"
-#include "testdata/random_nearbyint_testdata.hh"
-#include "testdata/random_nextafter_testdata.hh"
-#include "testdata/random_nexttoward_testdata.hh"
-#include "testdata/random_pow_testdata.hh"
-#include "testdata/random_remainder_testdata.hh"
-#include "testdata/random_rint_testdata.hh"
-#include "testdata/random_round_testdata.hh"
-#include "testdata/random_sin_testdata.hh"
-#include "testdata/random_sinh_testdata.hh"
-#include "testdata/random_sqrt_testdata.hh"
-#include "testdata/random_tan_testdata.hh"
-#include "testdata/random_tanh_testdata.hh"
-#include "testdata/random_tgamma_testdata.hh"
-#include "testdata/random_trunc_testdata.hh"
-
 // Chaotic function tests
 const std::size_t steps = 1000;
 
 TEST_CASE("ChaoticFunctionTest.RandomInputsLorenz") {
-    auto test_data =
-        ParameterizedTest<rdouble, 3, 3>::LoadTestData(random_lorenz_testdata);
+    auto test_data = ParameterizedTest<rdouble, 3, 3>::LoadTestData(
+        "random_lorenz");
     for (const auto &param : test_data) {
         auto results = TestFunctions<rdouble>::lorenz(param.inputs, steps);
         CHECK_EQ(results, param.expected_outputs);
@@ -78,7 +22,7 @@ TEST_CASE("ChaoticFunctionTest.RandomInputsLorenz") {
 
 TEST_CASE("ChaoticFunctionTest.RandomInputsMandelbrot") {
     auto test_data = ParameterizedTest<rdouble, 2, 2>::LoadTestData(
-        random_mandelbrot_testdata);
+        "random_mandelbrot");
     for (const auto &param : test_data) {
         auto results = TestFunctions<rdouble>::mandelbrot(param.inputs, steps);
         CHECK_EQ(results, param.expected_outputs);
@@ -87,7 +31,7 @@ TEST_CASE("ChaoticFunctionTest.RandomInputsMandelbrot") {
 
 TEST_CASE("ChaoticFunctionTest.RandomInputsLogisticMap") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_logistic_map_testdata);
+        "random_logistic_map");
     for (const auto &param : test_data) {
         // We divide the x parameter by 4 on both sides because the random
         // numbers are generated with a distribution centered on 3.5 and x
@@ -100,8 +44,8 @@ TEST_CASE("ChaoticFunctionTest.RandomInputsLogisticMap") {
 
 // rcmath tests
 TEST_CASE("IntegerTests.RandomInputsFloor") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_floor_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_floor");
     for (const auto &param : test_data) {
         auto results = rstd::floor(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -110,8 +54,8 @@ TEST_CASE("IntegerTests.RandomInputsFloor") {
 }
 
 TEST_CASE("IntegerTests.RandomInputsCeil") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_ceil_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_ceil");
     for (const auto &param : test_data) {
         auto results = rstd::ceil(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -120,8 +64,8 @@ TEST_CASE("IntegerTests.RandomInputsCeil") {
 }
 
 TEST_CASE("IntegerTests.RandomInputsRound") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_round_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_round");
     for (const auto &param : test_data) {
         auto results = rstd::round(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -130,8 +74,8 @@ TEST_CASE("IntegerTests.RandomInputsRound") {
 }
 
 TEST_CASE("IntegerTests.RandomInputsTrunc") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_trunc_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_trunc");
     for (const auto &param : test_data) {
         auto results = rstd::trunc(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -141,7 +85,7 @@ TEST_CASE("IntegerTests.RandomInputsTrunc") {
 
 TEST_CASE("IntegerTests.RandomInputsNearbyInt") {
     auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
-        random_nearbyint_testdata);
+        "random_nearbyint");
     for (const auto &param : test_data) {
         auto results = rstd::nearbyint(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -150,8 +94,8 @@ TEST_CASE("IntegerTests.RandomInputsNearbyInt") {
 }
 
 TEST_CASE("IntegerTests.RandomInputsRint") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_rint_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_rint");
     for (const auto &param : test_data) {
         auto results = rstd::rint(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -160,8 +104,8 @@ TEST_CASE("IntegerTests.RandomInputsRint") {
 }
 
 TEST_CASE("BasicTest.RandomInputsAbs") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_abs_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_abs");
     for (const auto &param : test_data) {
         auto results = rstd::abs(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -170,8 +114,8 @@ TEST_CASE("BasicTest.RandomInputsAbs") {
 }
 
 TEST_CASE("BasicTest.RandomInputsFMA") {
-    auto test_data =
-        ParameterizedTest<rdouble, 3, 1>::LoadTestData(random_fma_testdata);
+    auto test_data = ParameterizedTest<rdouble, 3, 1>::LoadTestData(
+        "random_fma");
     for (const auto &param : test_data) {
         auto results =
             rstd::fma(param.inputs[0], param.inputs[1], param.inputs[2]);
@@ -183,8 +127,8 @@ TEST_CASE("BasicTest.RandomInputsFMA") {
 }
 
 TEST_CASE("BasicTest.RandomInputsSqrt") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_sqrt_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_sqrt");
     for (const auto &param : test_data) {
         auto results = rstd::sqrt(param.inputs[0]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -194,7 +138,7 @@ TEST_CASE("BasicTest.RandomInputsSqrt") {
 
 TEST_CASE("BasicTest.RandomInputsNextAfter") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_nextafter_testdata);
+        "random_nextafter");
     for (const auto &param : test_data) {
         auto results = rstd::nextafter(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -205,7 +149,7 @@ TEST_CASE("BasicTest.RandomInputsNextAfter") {
 
 TEST_CASE("BasicTest.RandomInputsNextToward") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_nexttoward_testdata);
+        "random_nexttoward");
     for (const auto &param : test_data) {
         auto results = rstd::nexttoward(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -215,8 +159,8 @@ TEST_CASE("BasicTest.RandomInputsNextToward") {
 }
 
 TEST_CASE("BasicTest.RandomInputsFmod") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_fmod_testdata);
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_fmod");
     for (const auto &param : test_data) {
         auto results = rstd::fmod(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -227,7 +171,7 @@ TEST_CASE("BasicTest.RandomInputsFmod") {
 
 TEST_CASE("BasicTest.RandomInputsRemainder") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_remainder_testdata);
+        "random_remainder");
     for (const auto &param : test_data) {
         auto results = rstd::remainder(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -237,8 +181,8 @@ TEST_CASE("BasicTest.RandomInputsRemainder") {
 }
 
 TEST_CASE("BasicTest.RandomInputsFdim") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_fdim_testdata);
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_fdim");
     for (const auto &param : test_data) {
         auto results = rstd::fdim(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -248,8 +192,8 @@ TEST_CASE("BasicTest.RandomInputsFdim") {
 }
 
 TEST_CASE("BasicTest.RandomInputsFmax") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_fmax_testdata);
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_fmax");
     for (const auto &param : test_data) {
         auto results = rstd::fmax(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -259,8 +203,8 @@ TEST_CASE("BasicTest.RandomInputsFmax") {
 }
 
 TEST_CASE("BasicTest.RandomInputsFmin") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_fmin_testdata);
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_fmin");
     for (const auto &param : test_data) {
         auto results = rstd::fmin(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -271,7 +215,7 @@ TEST_CASE("BasicTest.RandomInputsFmin") {
 
 TEST_CASE("ComparisonTestsTest.RandomIsGreater") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_isgreater_testdata);
+        "random_isgreater");
     for (const auto &param : test_data) {
         auto results = rstd::isgreater(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -283,7 +227,7 @@ TEST_CASE("ComparisonTestsTest.RandomIsGreater") {
 
 TEST_CASE("ComparisonTestsTest.RandomIsGreaterEqual") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_isgreaterequal_testdata);
+        "random_isgreaterequal");
     for (const auto &param : test_data) {
         auto results = rstd::isgreaterequal(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -294,8 +238,8 @@ TEST_CASE("ComparisonTestsTest.RandomIsGreaterEqual") {
 }
 
 TEST_CASE("ComparisonTestsTest.RandomIsLess") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_isless_testdata);
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_isless");
     for (const auto &param : test_data) {
         auto results = rstd::isless(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -307,7 +251,7 @@ TEST_CASE("ComparisonTestsTest.RandomIsLess") {
 
 TEST_CASE("ComparisonTestsTest.RandomIsLessEqual") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_islessequal_testdata);
+        "random_islessequal");
     for (const auto &param : test_data) {
         auto results = rstd::islessequal(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -319,7 +263,7 @@ TEST_CASE("ComparisonTestsTest.RandomIsLessEqual") {
 
 TEST_CASE("ComparisonTestsTest.RandomIsLessGreater") {
     auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
-        random_islessgreater_testdata);
+        "random_islessgreater");
     for (const auto &param : test_data) {
         auto results = rstd::islessgreater(param.inputs[0], param.inputs[1]);
         CHECK_EQ(results, param.expected_outputs[0]);
@@ -331,7 +275,7 @@ TEST_CASE("ComparisonTestsTest.RandomIsLessGreater") {
 
 TEST_CASE("IOStreamTests.RandomLargeInputs") {
     auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
-        random_iostream_large_testdata);
+        "random_iostream_large");
     for (const auto &param : test_data) {
         std::stringstream ss;
         ss << std::setprecision(17) << param.inputs[0];
@@ -343,7 +287,7 @@ TEST_CASE("IOStreamTests.RandomLargeInputs") {
 
 TEST_CASE("IOStreamTests.RandomMediumInputs") {
     auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
-        random_iostream_medium_testdata);
+        "random_iostream_medium");
     for (const auto &param : test_data) {
         std::stringstream ss;
         ss << std::setprecision(17) << param.inputs[0];
@@ -355,7 +299,7 @@ TEST_CASE("IOStreamTests.RandomMediumInputs") {
 
 TEST_CASE("IOStreamTests.RandomSmallInputs") {
     auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
-        random_iostream_small_testdata);
+        "random_iostream_small");
     for (const auto &param : test_data) {
         std::stringstream ss;
         ss << std::setprecision(17) << param.inputs[0];
@@ -365,173 +309,158 @@ TEST_CASE("IOStreamTests.RandomSmallInputs") {
     }
 }
 
-#if defined(RSTD_NONDETERMINISM) && defined(ENABLE_NONDETERMINISTIC_TESTS)
-TEST_CASE("TrigTests.RandomSin") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_sin_testdata);
+TEST_CASE("LogExpTests.RandomLog") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_log");
     for (const auto &param : test_data) {
-        auto result = rstd::sin(param.inputs[0]);
+        auto result = rstd::log(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::sin(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomCos") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_cos_testdata);
+TEST_CASE("LogExpTests.RandomExp") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_exp");
     for (const auto &param : test_data) {
-        auto result = rstd::cos(param.inputs[0]);
+        auto result = rstd::exp(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::cos(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomTan") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_tan_testdata);
+TEST_CASE("LogExpTests.RandomLog2") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_log2");
     for (const auto &param : test_data) {
-        auto result = rstd::tan(param.inputs[0]);
+        auto result = rstd::log2(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::tan(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomAsin") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_asin_testdata);
+TEST_CASE("LogExpTests.RandomLog10") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_log10");
     for (const auto &param : test_data) {
-        auto result = rstd::asin(param.inputs[0]);
+        auto result = rstd::log10(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::asin(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomAcos") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_acos_testdata);
+TEST_CASE("LogExpTests.RandomExp2") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_exp2");
     for (const auto &param : test_data) {
-        auto result = rstd::acos(param.inputs[0]);
+        auto result = rstd::exp2(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::acos(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomAtan") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_atan_testdata);
+TEST_CASE("LogExpTests.RandomLog1p") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_log1p");
     for (const auto &param : test_data) {
-        auto result = rstd::atan(param.inputs[0]);
+        auto result = rstd::log1p(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::atan(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomAtan2") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_atan2_testdata);
+TEST_CASE("LogExpTests.RandomExpm1") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_expm1");
     for (const auto &param : test_data) {
-        auto result = rstd::atan2(param.inputs[0], param.inputs[1]);
+        auto result = rstd::expm1(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::atan2(param.inputs[0].underlying_value(),
-                                    param.inputs[1].underlying_value()));
     }
 }
 
-TEST_CASE("TrigTests.RandomHypot") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_hypot_testdata);
+TEST_CASE("PowTests.RandomPow") {
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_pow");
     for (const auto &param : test_data) {
-        auto result = rstd::hypot(param.inputs[0], param.inputs[1]);
+        auto result = rstd::pow(param.inputs[0], param.inputs[1]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::hypot(param.inputs[0].underlying_value(),
-                                    param.inputs[1].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomLog") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_log_testdata);
+TEST_CASE("TrigTests.RandomSin") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_sin");
     for (const auto &param : test_data) {
-        auto result = rstd::log(param.inputs[0]);
+        auto result = rstd::sin(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::log(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomExp") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_exp_testdata);
+TEST_CASE("TrigTests.RandomCos") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_cos");
     for (const auto &param : test_data) {
-        auto result = rstd::exp(param.inputs[0]);
+        auto result = rstd::cos(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::exp(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomLog2") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_log2_testdata);
+TEST_CASE("TrigTests.RandomTan") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_tan");
     for (const auto &param : test_data) {
-        auto result = rstd::log2(param.inputs[0]);
+        auto result = rstd::tan(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::log2(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomLog10") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_log10_testdata);
+TEST_CASE("TrigTests.RandomAtan") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_atan");
     for (const auto &param : test_data) {
-        auto result = rstd::log10(param.inputs[0]);
+        auto result = rstd::atan(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::log10(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomExp2") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_exp2_testdata);
+TEST_CASE("TrigTests.RandomAtan2") {
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_atan2");
     for (const auto &param : test_data) {
-        auto result = rstd::exp2(param.inputs[0]);
+        auto result = rstd::atan2(param.inputs[0], param.inputs[1]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::exp2(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomLog1p") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_log1p_testdata);
+#if defined(RSTD_NONDETERMINISM) && defined(ENABLE_NONDETERMINISTIC_TESTS)
+TEST_CASE("TrigTests.RandomAsin") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_asin");
     for (const auto &param : test_data) {
-        auto result = rstd::log1p(param.inputs[0]);
+        auto result = rstd::asin(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::log1p(param.inputs[0].underlying_value()));
+        CHECK_EQ(result, std::asin(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("LogExpTests.RandomExpm1") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_expm1_testdata);
+TEST_CASE("TrigTests.RandomAcos") {
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_acos");
     for (const auto &param : test_data) {
-        auto result = rstd::expm1(param.inputs[0]);
+        auto result = rstd::acos(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::expm1(param.inputs[0].underlying_value()));
+        CHECK_EQ(result, std::acos(param.inputs[0].underlying_value()));
     }
 }
 
-TEST_CASE("PowTests.RandomPow") {
-    auto test_data =
-        ParameterizedTest<rdouble, 2, 1>::LoadTestData(random_pow_testdata);
+TEST_CASE("TrigTests.RandomHypot") {
+    auto test_data = ParameterizedTest<rdouble, 2, 1>::LoadTestData(
+        "random_hypot");
     for (const auto &param : test_data) {
-        auto result = rstd::pow(param.inputs[0], param.inputs[1]);
+        auto result = rstd::hypot(param.inputs[0], param.inputs[1]);
         CHECK_EQ(result, param.expected_outputs[0]);
-        CHECK_EQ(result, std::pow(param.inputs[0].underlying_value(),
-                                  param.inputs[1].underlying_value()));
+        CHECK_EQ(result, std::hypot(param.inputs[0].underlying_value(),
+                                    param.inputs[1].underlying_value()));
     }
 }
 
 TEST_CASE("PowTests.RandomCbrt") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_cbrt_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_cbrt");
     for (const auto &param : test_data) {
         auto result = rstd::cbrt(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -540,8 +469,8 @@ TEST_CASE("PowTests.RandomCbrt") {
 }
 
 TEST_CASE("HyperbolicTests.RandomSinh") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_sinh_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_sinh");
     for (const auto &param : test_data) {
         auto result = rstd::sinh(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -550,8 +479,8 @@ TEST_CASE("HyperbolicTests.RandomSinh") {
 }
 
 TEST_CASE("HyperbolicTests.RandomCosh") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_cosh_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_cosh");
     for (const auto &param : test_data) {
         auto result = rstd::cosh(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -560,8 +489,8 @@ TEST_CASE("HyperbolicTests.RandomCosh") {
 }
 
 TEST_CASE("HyperbolicTests.RandomTanh") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_tanh_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_tanh");
     for (const auto &param : test_data) {
         auto result = rstd::tanh(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -570,8 +499,8 @@ TEST_CASE("HyperbolicTests.RandomTanh") {
 }
 
 TEST_CASE("HyperbolicTests.RandomAsinh") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_asinh_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_asinh");
     for (const auto &param : test_data) {
         auto result = rstd::asinh(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -580,8 +509,8 @@ TEST_CASE("HyperbolicTests.RandomAsinh") {
 }
 
 TEST_CASE("HyperbolicTests.RandomAcosh") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_acosh_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_acosh");
     for (const auto &param : test_data) {
         auto result = rstd::acosh(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -590,8 +519,8 @@ TEST_CASE("HyperbolicTests.RandomAcosh") {
 }
 
 TEST_CASE("HyperbolicTests.RandomAtanh") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_atanh_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_atanh");
     for (const auto &param : test_data) {
         auto result = rstd::atanh(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -600,8 +529,8 @@ TEST_CASE("HyperbolicTests.RandomAtanh") {
 }
 
 TEST_CASE("SpecialTests.RandomErf") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_erf_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_erf");
     for (const auto &param : test_data) {
         auto result = rstd::erf(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -610,8 +539,8 @@ TEST_CASE("SpecialTests.RandomErf") {
 }
 
 TEST_CASE("SpecialTests.RandomErfc") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_erfc_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_erfc");
     for (const auto &param : test_data) {
         auto result = rstd::erfc(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -620,8 +549,8 @@ TEST_CASE("SpecialTests.RandomErfc") {
 }
 
 TEST_CASE("SpecialTests.RandomTgamma") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_tgamma_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_tgamma");
     for (const auto &param : test_data) {
         auto result = rstd::tgamma(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -630,8 +559,8 @@ TEST_CASE("SpecialTests.RandomTgamma") {
 }
 
 TEST_CASE("SpecialTests.RandomLgamma") {
-    auto test_data =
-        ParameterizedTest<rdouble, 1, 1>::LoadTestData(random_lgamma_testdata);
+    auto test_data = ParameterizedTest<rdouble, 1, 1>::LoadTestData(
+        "random_lgamma");
     for (const auto &param : test_data) {
         auto result = rstd::lgamma(param.inputs[0]);
         CHECK_EQ(result, param.expected_outputs[0]);
@@ -641,8 +570,8 @@ TEST_CASE("SpecialTests.RandomLgamma") {
 
 #if __cpp_lib_interpolate >= 201902L
 TEST_CASE("SpecialTests.DISABLED_RandomLerp") {
-    auto test_data =
-        ParameterizedTest<rdouble, 3, 1>::LoadTestData(random_lerp_testdata);
+    auto test_data = ParameterizedTest<rdouble, 3, 1>::LoadTestData(
+        "random_lerp");
     for (const auto &param : test_data) {
         auto result =
             rstd::lerp(param.inputs[0], param.inputs[1], param.inputs[2]);
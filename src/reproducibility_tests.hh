@@ -1,64 +1,310 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
 #include <stdexcept>
-#include <vector>
+#include <string>
+#include <type_traits>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define RFLOAT_TEST_VECTORS_MMAP 1
+#endif
 
-// Infrastructure to read lines of test data from the headers
-// included above and parsed into TestParam objects. Each line is a single test
-// case.
+// Path of the test vectors, normally set by the build
+#ifndef RFLOAT_TEST_VECTORS
+#define RFLOAT_TEST_VECTORS "src/testdata/reproducibility_tests.rtv"
+#endif
+
+// Infrastructure to read test vectors from the binary file written by
+// gen_reproducibility_tests. Each row of a section is a single test case.
 template <typename T, std::size_t InputSize, std::size_t OutputSize>
 struct TestParam {
     std::array<T, InputSize> inputs;
     std::array<T, OutputSize> expected_outputs;
 };
 
-template <typename T, std::size_t InputSize, std::size_t OutputSize>
-class ParameterizedTest {
+// The test vector file format. Every integer and value is stored in the byte
+// order of the machine that wrote the file, which byte_order records:
+//
+//   TestVectorHeader
+//   the rows of each section, starting at its offset
+//   TestVectorSection[section_count], starting at section_table
+//
+// A row is the section's inputs followed by its outputs, as raw IEEE bit
+// patterns of element_size bytes each. That's the layout of a TestParam, so
+// the rows are used in place.
+constexpr char test_vector_magic[8] = {'R', 'F', 'L', 'T', 'V', 'E', 'C', '\0'};
+constexpr std::uint32_t test_vector_byte_order = 0x01020304;
+constexpr std::uint32_t test_vector_version = 1;
+// Alignment of the rows of each section within the file
+constexpr std::size_t test_vector_alignment = 16;
+
+struct TestVectorHeader {
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t version;
+    std::uint64_t section_count;
+    std::uint64_t section_table;
+};
+
+struct TestVectorSection {
+    char name[48];
+    std::uint32_t element_size;
+    std::uint32_t input_size;
+    std::uint32_t output_size;
+    std::uint32_t reserved;
+    std::uint64_t rows;
+    std::uint64_t offset;
+};
+
+// The rows of one section, pointing into the file's memory
+template <typename Param> class TestVectorSpan {
   public:
-    static std::vector<TestParam<T, InputSize, OutputSize>>
-    LoadTestData(const std::string &data) {
-        std::vector<TestParam<T, InputSize, OutputSize>> test_data;
-        std::istringstream iss(data);
-        std::string line;
-        int line_number = 0;
+    TestVectorSpan(const Param *data, std::size_t size)
+        : m_data(data), m_size(size) {}
 
-        while (std::getline(iss, line)) {
-            line_number++;
+    const Param *begin() const { return m_data; }
+    const Param *end() const { return m_data + m_size; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const Param &operator[](std::size_t i) const { return m_data[i]; }
 
-            if (line.find_first_not_of(" \t\r\n") == std::string::npos) {
-                continue;
+  private:
+    const Param *m_data;
+    std::size_t m_size;
+};
+
+// A test vector file, memory mapped where the platform supports it and read
+// into memory otherwise. A file written on a machine of the other byte order
+// is copied and byte swapped. Throws std::runtime_error if the file can't be
+// read or isn't a test vector file.
+class TestVectorFile {
+  public:
+    explicit TestVectorFile(const std::string &path) : m_path(path) {
+#if defined(RFLOAT_TEST_VECTORS_MMAP)
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat info;
+        if (fd < 0 || ::fstat(fd, &info) != 0) {
+            if (fd >= 0) {
+                ::close(fd);
             }
+            throw std::runtime_error("Unable to open " + path);
+        }
+        m_size = std::size_t(info.st_size);
+        if (m_size > 0) {
+            void *mapping =
+                ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Unable to map " + path);
+            }
+            m_mapping = mapping;
+            m_data = static_cast<const unsigned char *>(mapping);
+        }
+        ::close(fd);
+#else
+        read(path);
+#endif
+        // The destructor doesn't run if the constructor throws
+        try {
+            validate();
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
 
-            std::istringstream line_stream(line);
-            TestParam<T, InputSize, OutputSize> param;
+    ~TestVectorFile() { unmap(); }
 
-            for (std::size_t i = 0; i < InputSize; ++i) {
-                if (!(line_stream >> param.inputs[i])) {
-                    throw std::runtime_error(
-                        "Not enough valid input values on line " +
-                        std::to_string(line_number));
-                }
-            }
+    TestVectorFile(const TestVectorFile &) = delete;
+    TestVectorFile &operator=(const TestVectorFile &) = delete;
 
-            for (std::size_t i = 0; i < OutputSize; ++i) {
-                if (!(line_stream >> param.expected_outputs[i])) {
-                    throw std::runtime_error(
-                        "Not enough valid output values on line " +
-                        std::to_string(line_number));
-                }
+    // The rows of the named section. Throws std::runtime_error if there's no
+    // such section or its rows aren't of this shape.
+    template <typename T, std::size_t InputSize, std::size_t OutputSize>
+    TestVectorSpan<TestParam<T, InputSize, OutputSize>>
+    section(const std::string &name) const {
+        using Param = TestParam<T, InputSize, OutputSize>;
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Test vectors are raw bit patterns");
+        static_assert(sizeof(Param) == sizeof(T) * (InputSize + OutputSize),
+                      "TestParam must have the layout of a row");
+        for (const TestVectorSection &entry : sections()) {
+            if (name != entry.name) {
+                continue;
             }
+            if (entry.element_size != sizeof(T) ||
+                entry.input_size != InputSize ||
+                entry.output_size != OutputSize) {
+                throw std::runtime_error("Section " + name + " in " + m_path +
+                                         " has a different shape");
+            }
+            return {reinterpret_cast<const Param *>(m_data + entry.offset),
+                    std::size_t(entry.rows)};
+        }
+        throw std::runtime_error("No section " + name + " in " + m_path);
+    }
+
+  private:
+    const TestVectorHeader &header() const {
+        return *reinterpret_cast<const TestVectorHeader *>(m_data);
+    }
+
+    TestVectorSpan<TestVectorSection> sections() const {
+        return {reinterpret_cast<const TestVectorSection *>(
+                    m_data + header().section_table),
+                std::size_t(header().section_count)};
+    }
+
+    // Whether count elements of size bytes from offset are within the file
+    bool contains(std::uint64_t offset, std::uint64_t size,
+                  std::uint64_t count) const {
+        return offset <= m_size &&
+               (size == 0 || count <= (m_size - offset) / size);
+    }
+
+    void read(const std::string &path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            throw std::runtime_error("Unable to open " + path);
+        }
+        m_size = std::size_t(in.tellg());
+        // Backed by 64-bit words so that the rows are aligned
+        m_copy.reset(new std::uint64_t[(m_size + 7) / 8]);
+        in.seekg(0);
+        if (!in.read(reinterpret_cast<char *>(m_copy.get()),
+                     std::streamsize(m_size))) {
+            throw std::runtime_error("Unable to read " + path);
+        }
+        m_data = reinterpret_cast<const unsigned char *>(m_copy.get());
+    }
+
+    void unmap() {
+#if defined(RFLOAT_TEST_VECTORS_MMAP)
+        if (m_mapping) {
+            ::munmap(m_mapping, m_size);
+            m_mapping = nullptr;
+        }
+#endif
+    }
 
-            int extra;
-            if (line_stream >> extra) {
-                throw std::runtime_error("Too many values on line " +
-                                         std::to_string(line_number));
+    void validate() {
+        const auto invalid = [this](const char *reason) {
+            return std::runtime_error(m_path + " isn't a test vector file (" +
+                                      reason + ")");
+        };
+        if (m_size < sizeof(TestVectorHeader) ||
+            std::memcmp(header().magic, test_vector_magic,
+                        sizeof(test_vector_magic)) != 0) {
+            throw invalid("bad magic");
+        }
+        if (header().byte_order != test_vector_byte_order) {
+            swap_byte_order();
+        }
+        if (header().byte_order != test_vector_byte_order) {
+            throw invalid("bad byte order");
+        }
+        if (header().version != test_vector_version) {
+            throw invalid("unsupported version");
+        }
+        if (header().section_table % alignof(TestVectorSection) != 0 ||
+            !contains(header().section_table, sizeof(TestVectorSection),
+                      header().section_count)) {
+            throw invalid("truncated section table");
+        }
+        for (const TestVectorSection &entry : sections()) {
+            if (std::memchr(entry.name, '\0', sizeof(entry.name)) == nullptr ||
+                (entry.element_size != 4 && entry.element_size != 8) ||
+                entry.offset % test_vector_alignment != 0 ||
+                !contains(entry.offset,
+                          std::uint64_t(entry.element_size) *
+                              (entry.input_size + entry.output_size),
+                          entry.rows)) {
+                throw invalid("bad section");
             }
+        }
+    }
 
-            test_data.push_back(param);
+    static void swap_bytes(unsigned char *data, std::size_t size,
+                           std::uint64_t count) {
+        for (std::uint64_t i = 0; i < count; ++i, data += size) {
+            std::reverse(data, data + size);
         }
-        return test_data;
+    }
+
+    template <typename U> static void swap_bytes(U &value) {
+        auto *bytes = reinterpret_cast<unsigned char *>(&value);
+        std::reverse(bytes, bytes + sizeof(U));
+    }
+
+    // Converts a file written on a machine of the other byte order, in a
+    // copy. Whatever doesn't make sense afterwards is left for validate().
+    void swap_byte_order() {
+        if (!m_copy) {
+            std::unique_ptr<std::uint64_t[]> copy(
+                new std::uint64_t[(m_size + 7) / 8]);
+            std::memcpy(copy.get(), m_data, m_size);
+            unmap();
+            m_copy = std::move(copy);
+            m_data = reinterpret_cast<const unsigned char *>(m_copy.get());
+        }
+        auto *data = reinterpret_cast<unsigned char *>(m_copy.get());
+        auto &file = *reinterpret_cast<TestVectorHeader *>(data);
+        swap_bytes(file.byte_order);
+        swap_bytes(file.version);
+        swap_bytes(file.section_count);
+        swap_bytes(file.section_table);
+        if (file.byte_order != test_vector_byte_order ||
+            file.section_table % alignof(TestVectorSection) != 0 ||
+            !contains(file.section_table, sizeof(TestVectorSection),
+                      file.section_count)) {
+            return;
+        }
+        auto *entries =
+            reinterpret_cast<TestVectorSection *>(data + file.section_table);
+        for (std::uint64_t i = 0; i < file.section_count; ++i) {
+            TestVectorSection &entry = entries[i];
+            swap_bytes(entry.element_size);
+            swap_bytes(entry.input_size);
+            swap_bytes(entry.output_size);
+            swap_bytes(entry.rows);
+            swap_bytes(entry.offset);
+            const std::uint64_t count =
+                entry.rows * (entry.input_size + entry.output_size);
+            if (entry.element_size != 0 &&
+                contains(entry.offset, entry.element_size, count)) {
+                swap_bytes(data + entry.offset, entry.element_size, count);
+            }
+        }
+    }
+
+    std::string m_path;
+    std::size_t m_size = 0;
+    const unsigned char *m_data = nullptr;
+    void *m_mapping = nullptr;
+    std::unique_ptr<std::uint64_t[]> m_copy;
+};
+
+// The test vectors the tests were built with, opened on first use
+inline const TestVectorFile &test_vectors() {
+    static const TestVectorFile file(RFLOAT_TEST_VECTORS);
+    return file;
+}
+
+template <typename T, std::size_t InputSize, std::size_t OutputSize>
+class ParameterizedTest {
+  public:
+    static TestVectorSpan<TestParam<T, InputSize, OutputSize>>
+    LoadTestData(const std::string &name) {
+        return test_vectors().section<T, InputSize, OutputSize>(name);
     }
 };
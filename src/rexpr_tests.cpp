@@ -0,0 +1,176 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <rexpr>
+#include <rfloat>
+
+// Reference results round after every operation. Volatile temporaries keep
+// the compiler from contracting or reassociating anything.
+template <typename T> static T rounded_mul(T a, T b) {
+    volatile T result = a * b;
+    return result;
+}
+
+template <typename T> static T rounded_add(T a, T b) {
+    volatile T result = a + b;
+    return result;
+}
+
+template <typename T> static T rounded_sub(T a, T b) {
+    volatile T result = a - b;
+    return result;
+}
+
+template <typename T> static T rounded_div(T a, T b) {
+    volatile T result = a / b;
+    return result;
+}
+
+template <typename W>
+static std::vector<W> random_values(std::size_t count, unsigned seed) {
+    using T = typename W::underlying_type;
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dis(-100, 100);
+    std::vector<W> values(count);
+    for (auto &v : values) {
+        v = dis(gen);
+    }
+    return values;
+}
+
+template <typename W> static void check_per_operation_rounding() {
+    using T = typename W::underlying_type;
+    auto a = random_values<W>(1000, 1);
+    auto b = random_values<W>(1000, 2);
+    auto c = random_values<W>(1000, 3);
+    auto d = random_values<W>(1000, 4);
+    auto e = random_values<W>(1000, 5);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        T x = a[i].underlying_value();
+        T y = b[i].underlying_value();
+        T z = c[i].underlying_value();
+        T w = d[i].underlying_value();
+        T v = e[i].underlying_value();
+
+        W sum_of_products = rstd::lazy(a[i]) * b[i] + c[i] * d[i] - e[i];
+        CHECK_EQ(sum_of_products,
+                 rounded_sub(rounded_add(rounded_mul(x, y), rounded_mul(z, w)),
+                             v));
+
+        W quotient = (rstd::lazy(a[i]) + b[i]) * (c[i] - d[i]) / e[i];
+        CHECK_EQ(quotient, rounded_div(rounded_mul(rounded_add(x, y),
+                                                   rounded_sub(z, w)),
+                                       v));
+
+        W negated = -(rstd::lazy(a[i]) * b[i]) + c[i];
+        CHECK_EQ(negated, rounded_add(-rounded_mul(x, y), z));
+
+        W mixed = T(2) * rstd::lazy(a[i]) - rstd::lazy(b[i]) * T(3);
+        CHECK_EQ(mixed,
+                 rounded_sub(rounded_mul(T(2), x), rounded_mul(y, T(3))));
+
+        // The result escapes the statement and is added to afterwards
+        W product = rstd::lazy(a[i]) * b[i];
+        W later = product + c[i];
+        CHECK_EQ(later, rounded_add(rounded_mul(x, y), z));
+    }
+}
+
+TEST_CASE("ExpressionTest.rfloat_matches_per_operation_rounding") {
+    check_per_operation_rounding<rfloat>();
+}
+
+TEST_CASE("ExpressionTest.rdouble_matches_per_operation_rounding") {
+    check_per_operation_rounding<rdouble>();
+}
+
+TEST_CASE("ExpressionTest.NoContraction") {
+    // a * b is exactly 1 - 2^-60, which rounds to 1. Fused, the result
+    // would be -2^-60 instead of 0.
+    volatile double inputs[] = {1.0 + std::ldexp(1.0, -30),
+                                1.0 - std::ldexp(1.0, -30), -1.0};
+    rdouble a = static_cast<double>(inputs[0]);
+    rdouble b = static_cast<double>(inputs[1]);
+    rdouble c = static_cast<double>(inputs[2]);
+
+    rdouble result = rstd::lazy(a) * b + c;
+    CHECK_EQ(result, 0.0);
+
+    rdouble negated = c - rstd::lazy(a) * b;
+    CHECK_EQ(negated, -2.0);
+
+    auto deferred = rstd::lazy(a) * b;
+    rdouble escaped = deferred;
+    escaped += c;
+    CHECK_EQ(escaped, 0.0);
+}
+
+TEST_CASE("ExpressionTest.CompoundAssignment") {
+    rdouble x = 1.0;
+    rdouble a = 3.0;
+    rdouble b = 0.5;
+    x += rstd::lazy(a) * b;
+    CHECK_EQ(x, 2.5);
+    x -= rstd::lazy(a) / b;
+    CHECK_EQ(x, -3.5);
+}
+
+TEST_CASE("ExpressionTest.LorenzStep") {
+    // Matches a hand-rounded integration of the Lorenz system
+    const double sigma = 10.0, rho = 28.0, beta = 8.0 / 3.0, dt = 0.001;
+    rdouble x = 0.0, y = 1.0, z = 0.0;
+    double rx = 0.0, ry = 1.0, rz = 0.0;
+
+    for (int i = 0; i < 1000; ++i) {
+        rdouble dx = rstd::lazy(x) + sigma * (rstd::lazy(y) - x) * dt;
+        rdouble dy = rstd::lazy(y) + (x * (rho - rstd::lazy(z)) - y) * dt;
+        rdouble dz =
+            rstd::lazy(z) + (rstd::lazy(x) * y - beta * rstd::lazy(z)) * dt;
+        x = dx;
+        y = dy;
+        z = dz;
+
+        double nx = rounded_add(
+            rx, rounded_mul(rounded_mul(sigma, rounded_sub(ry, rx)), dt));
+        double ny = rounded_add(
+            ry,
+            rounded_mul(rounded_sub(rounded_mul(rx, rounded_sub(rho, rz)), ry),
+                        dt));
+        double nz = rounded_add(
+            rz, rounded_mul(rounded_sub(rounded_mul(rx, ry),
+                                        rounded_mul(beta, rz)),
+                            dt));
+        rx = nx;
+        ry = ny;
+        rz = nz;
+    }
+
+    CHECK_EQ(x, rx);
+    CHECK_EQ(y, ry);
+    CHECK_EQ(z, rz);
+}
+
+TEST_CASE("ExpressionTest.Types") {
+    rfloat a = 1.0f;
+    auto leaf = rstd::lazy(a);
+    using Leaf = decltype(leaf);
+    static_assert(std::is_same<Leaf::value_type, rfloat>::value, "");
+
+    using Product = rstd::BinaryExpression<rstd::detail::multiply_op, Leaf,
+                                           Leaf>;
+    static_assert(std::is_same<decltype(leaf * a), Product>::value, "");
+    static_assert(
+        std::is_same<decltype(leaf * a + 1.0f),
+                     rstd::BinaryExpression<rstd::detail::add_op, Product,
+                                            Leaf>>::value,
+        "");
+
+    // Plain wrapper arithmetic is unaffected by including <rexpr>
+    static_assert(std::is_same<decltype(a + a), rfloat>::value, "");
+    static_assert(std::is_same<decltype(1.0f * a), rfloat>::value, "");
+}
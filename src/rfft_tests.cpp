@@ -0,0 +1,368 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <rcomplex>
+#include <rfft>
+#include <rfloat>
+
+#include "digest.hh"
+#include "rcmath_tests.hh"
+
+template <typename T> static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// Compares the bits, since -ffast-math folds std::isnan to false
+template <typename T> static bool is_nan(T x) {
+    using Bits =
+        std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+    const T infinity = std::numeric_limits<T>::infinity();
+    Bits bits;
+    Bits infinity_bits;
+    std::memcpy(&bits, &x, sizeof(T));
+    std::memcpy(&infinity_bits, &infinity, sizeof(T));
+    return (bits << 1) > (infinity_bits << 1);
+}
+
+// The sign and payload of a NaN aren't reproducible, as in IEEE-754
+template <typename T> static bool same_value(T a, T b) {
+    return same_bits(a, b) || (is_nan(a) && is_nan(b));
+}
+
+// Uniform in [-1, 1), from the bits of mt19937_64 rather than a standard
+// distribution, so that the inputs are the same with every standard library
+template <typename T>
+static std::vector<rstd::complex<rstd::ReproducibleWrapper<T>>>
+random_signal(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    const auto uniform = [&] {
+        return T(double(gen() >> 11) * 0x1p-52 - 1.0);
+    };
+    std::vector<rstd::complex<rstd::ReproducibleWrapper<T>>> x(n);
+    for (auto &value : x) {
+        const T re = uniform();
+        value = {re, uniform()};
+    }
+    return x;
+}
+
+// The transform as documented in <rfft>, one butterfly at a time on
+// rstd::complex
+template <typename T> struct Reference {
+    using W = rstd::ReproducibleWrapper<T>;
+    using C = rstd::complex<W>;
+
+    static C times_minus_i(const C &z) { return {z.imag(), -z.real()}; }
+
+    static void butterfly(std::size_t radix, C *x) {
+        const W h = T(0.707106781186547524400844362104849039L);
+        if (radix == 2) {
+            const C sum = x[0] + x[1];
+            x[1] = x[0] - x[1];
+            x[0] = sum;
+        } else if (radix == 4) {
+            const C a02 = x[0] + x[2];
+            const C s02 = x[0] - x[2];
+            const C a13 = x[1] + x[3];
+            const C s13 = times_minus_i(x[1] - x[3]);
+            x[0] = a02 + a13;
+            x[1] = s02 + s13;
+            x[2] = a02 - a13;
+            x[3] = s02 - s13;
+        } else {
+            const C e0 = (x[0] + x[4]) + (x[2] + x[6]);
+            const C e1 = (x[0] + x[4]) - (x[2] + x[6]);
+            const C o0 = (x[1] + x[5]) + (x[3] + x[7]);
+            const C o1 = times_minus_i((x[1] + x[5]) - (x[3] + x[7]));
+            const C s04 = x[0] - x[4];
+            const C s26 = times_minus_i(x[2] - x[6]);
+            const C s15 = x[1] - x[5];
+            const C s37 = times_minus_i(x[3] - x[7]);
+            const C a = s15 + s37;
+            const C b = s15 - s37;
+            const C r0((a.real() + a.imag()) * h, (a.imag() - a.real()) * h);
+            const C r1((b.imag() - b.real()) * h, -((b.real() + b.imag()) * h));
+            x[0] = e0 + o0;
+            x[1] = (s04 + s26) + r0;
+            x[2] = e1 + o1;
+            x[3] = (s04 - s26) + r1;
+            x[4] = e0 - o0;
+            x[5] = (s04 + s26) - r0;
+            x[6] = e1 - o1;
+            x[7] = (s04 - s26) - r1;
+        }
+    }
+
+    static std::vector<C> forward(std::vector<C> x) {
+        const std::size_t n = x.size();
+        std::vector<rdouble> root_re;
+        std::vector<rdouble> root_im;
+        rstd::fft::detail::roots_of_unity(n, root_re, root_im);
+        std::vector<C> y(n);
+        for (std::size_t m = n, stride = 1; m > 1;) {
+            const std::size_t radix = m % 8 == 0 ? 8 : m % 4 == 0 ? 4 : 2;
+            const std::size_t span = m / radix;
+            for (std::size_t p = 0; p < span; ++p) {
+                for (std::size_t q = 0; q < stride; ++q) {
+                    C values[8];
+                    for (std::size_t t = 0; t < radix; ++t) {
+                        values[t] = x[q + stride * (p + t * span)];
+                    }
+                    butterfly(radix, values);
+                    for (std::size_t j = 0; j < radix; ++j) {
+                        if (p != 0 && j != 0) {
+                            const std::size_t k = j * p * stride;
+                            values[j] *= C(T(root_re[k].underlying_value()),
+                                           T(root_im[k].underlying_value()));
+                        }
+                        y[q + stride * (radix * p + j)] = values[j];
+                    }
+                }
+            }
+            std::swap(x, y);
+            m = span;
+            stride *= radix;
+        }
+        return x;
+    }
+};
+
+template <typename T> static void check_matches_dft() {
+    constexpr long double pi = 3.141592653589793238462643383279502884L;
+    const long double epsilon = std::numeric_limits<T>::epsilon();
+    for (std::size_t n = 1; n <= 2048; n *= 2) {
+        CAPTURE(n);
+        const auto x = random_signal<T>(n, n);
+        const auto spectrum = rstd::fft::plan<rstd::ReproducibleWrapper<T>>(n)
+                                  .forward(x);
+        // The error grows with log2(n), times the size of the outputs,
+        // about sqrt(n)
+        const long double bound =
+            4 * epsilon * (std::log2((long double)n) + 1) *
+            std::sqrt((long double)n);
+        for (std::size_t k = 0; k < n; ++k) {
+            long double re = 0;
+            long double im = 0;
+            for (std::size_t j = 0; j < n; ++j) {
+                const long double angle = 2 * pi * ((j * k) % n) / n;
+                const long double a = x[j].real().underlying_value();
+                const long double b = x[j].imag().underlying_value();
+                re += a * std::cos(angle) + b * std::sin(angle);
+                im += b * std::cos(angle) - a * std::sin(angle);
+            }
+            CHECK(std::fabs(spectrum[k].real().underlying_value() - re) <=
+                  bound);
+            CHECK(std::fabs(spectrum[k].imag().underlying_value() - im) <=
+                  bound);
+        }
+    }
+}
+
+TEST_CASE("FftTest.float_matches_dft") { check_matches_dft<float>(); }
+
+TEST_CASE("FftTest.double_matches_dft") { check_matches_dft<double>(); }
+
+template <typename T> static void check_matches_reference() {
+    using W = rstd::ReproducibleWrapper<T>;
+    for (std::size_t n = 1; n <= (1 << 14); n *= 2) {
+        CAPTURE(n);
+        auto x = random_signal<T>(n, 3 * n);
+        if (n >= 4) {
+            // Signed zeros and infinities go through every path alike
+            x[1] = {T(-0.0), T(0.0)};
+            x[n - 1] = {std::numeric_limits<T>::infinity(), T(1)};
+        }
+        const std::vector<rstd::complex<W>> expected = Reference<T>::forward(x);
+        const std::vector<rstd::complex<W>> result =
+            rstd::fft::plan<W>(n).forward(x);
+        bool same = true;
+        for (std::size_t k = 0; k < n; ++k) {
+            const auto e = expected[k].underlying_value();
+            const auto r = result[k].underlying_value();
+            same = same && same_value(e.real(), r.real()) &&
+                   same_value(e.imag(), r.imag());
+        }
+        CHECK(same);
+    }
+}
+
+TEST_CASE("FftTest.float_matches_reference") {
+    check_matches_reference<float>();
+}
+
+TEST_CASE("FftTest.double_matches_reference") {
+    check_matches_reference<double>();
+}
+
+template <typename T> static void check_round_trip() {
+    using W = rstd::ReproducibleWrapper<T>;
+    const T epsilon = std::numeric_limits<T>::epsilon();
+    for (std::size_t n = 1; n <= 4096; n *= 2) {
+        CAPTURE(n);
+        const rstd::fft::plan<W> plan(n);
+        const auto x = random_signal<T>(n, 5 * n);
+        const auto y = plan.inverse(plan.forward(x));
+        const T bound = 4 * epsilon * (std::log2(T(n)) + 1);
+        for (std::size_t j = 0; j < n; ++j) {
+            const rstd::complex<W> scaled = y[j] / W(T(n));
+            CHECK(std::fabs((scaled.real() - x[j].real()).underlying_value()) <=
+                  bound);
+            CHECK(std::fabs((scaled.imag() - x[j].imag()).underlying_value()) <=
+                  bound);
+        }
+    }
+}
+
+TEST_CASE("FftTest.float_round_trip") { check_round_trip<float>(); }
+
+TEST_CASE("FftTest.double_round_trip") { check_round_trip<double>(); }
+
+TEST_CASE("FftTest.split_arrays") {
+    using W = rdouble;
+    const std::size_t n = 512;
+    const rstd::fft::plan<W> plan(n);
+    const auto x = random_signal<double>(n, 7);
+    const auto spectrum = plan.forward(x);
+    const auto signal = plan.inverse(x);
+
+    std::vector<W> re(n);
+    std::vector<W> im(n);
+    std::vector<W> out_re(n);
+    std::vector<W> out_im(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        re[i] = x[i].real();
+        im[i] = x[i].imag();
+    }
+    plan.forward(re.data(), im.data(), out_re.data(), out_im.data());
+    for (std::size_t k = 0; k < n; ++k) {
+        CHECK(same_bits(out_re[k].underlying_value(),
+                        spectrum[k].real().underlying_value()));
+        CHECK(same_bits(out_im[k].underlying_value(),
+                        spectrum[k].imag().underlying_value()));
+    }
+
+    // The inverse is the forward transform with the real and imaginary
+    // parts exchanged
+    plan.forward(im.data(), re.data(), out_im.data(), out_re.data());
+    for (std::size_t j = 0; j < n; ++j) {
+        CHECK(same_bits(out_re[j].underlying_value(),
+                        signal[j].real().underlying_value()));
+        CHECK(same_bits(out_im[j].underlying_value(),
+                        signal[j].imag().underlying_value()));
+    }
+
+    // In place
+    plan.inverse(re.data(), im.data(), re.data(), im.data());
+    for (std::size_t j = 0; j < n; ++j) {
+        CHECK(same_bits(re[j].underlying_value(),
+                        signal[j].real().underlying_value()));
+        CHECK(same_bits(im[j].underlying_value(),
+                        signal[j].imag().underlying_value()));
+    }
+
+    // In place on complex arrays
+    std::vector<rstd::complex<W>> z = x;
+    plan.forward(z.data(), z.data());
+    for (std::size_t k = 0; k < n; ++k) {
+        CHECK(z[k] == spectrum[k]);
+    }
+}
+
+TEST_CASE("FftTest.matches_textbook_radix2") {
+    using W = rdouble;
+    using Functions = TestFunctions<W>;
+    const std::size_t n = 1024;
+    std::vector<rdouble> root_re;
+    std::vector<rdouble> root_im;
+    rstd::fft::detail::roots_of_unity(n, root_re, root_im);
+    std::vector<Functions::Array2> roots(n / 2);
+    for (std::size_t k = 0; k < n / 2; ++k) {
+        roots[k] = {root_re[k], root_im[k]};
+    }
+    const auto x = random_signal<double>(n, 11);
+    std::vector<Functions::Array2> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = {x[i].real(), x[i].imag()};
+    }
+    const auto expected = Functions::fft(data, roots);
+    const auto result = rstd::fft::plan<W>(n).forward(x);
+    for (std::size_t k = 0; k < n; ++k) {
+        const rdouble re = result[k].real() - expected[k][0];
+        const rdouble im = result[k].imag() - expected[k][1];
+        CHECK(std::fabs(re.underlying_value()) < 1e-13);
+        CHECK(std::fabs(im.underlying_value()) < 1e-13);
+    }
+}
+
+TEST_CASE("FftTest.roots_of_unity") {
+    std::vector<rdouble> re;
+    std::vector<rdouble> im;
+    for (std::size_t n = 1; n <= 4096; n *= 2) {
+        CAPTURE(n);
+        rstd::fft::detail::roots_of_unity(n, re, im);
+        REQUIRE(re.size() == n);
+        CHECK(same_bits(re[0].underlying_value(), 1.0));
+        CHECK(same_bits(im[0].underlying_value(), 0.0));
+        if (n >= 2) {
+            CHECK(same_bits(re[n / 2].underlying_value(), -1.0));
+            CHECK(same_bits(im[n / 2].underlying_value(), 0.0));
+        }
+        if (n >= 4) {
+            CHECK(same_bits(re[n / 4].underlying_value(), 0.0));
+            CHECK(same_bits(im[n / 4].underlying_value(), -1.0));
+            CHECK(same_bits(re[3 * n / 4].underlying_value(), 0.0));
+            CHECK(same_bits(im[3 * n / 4].underlying_value(), 1.0));
+        }
+        // Within an ulp of the exact values
+        for (std::size_t k = 0; k < n; ++k) {
+            const long double angle =
+                2 * 3.141592653589793238462643383279502884L * k / n;
+            CHECK(std::fabs(re[k].underlying_value() - std::cos(angle)) <=
+                  0x1p-53);
+            CHECK(std::fabs(im[k].underlying_value() + std::sin(angle)) <=
+                  0x1p-53);
+        }
+    }
+}
+
+TEST_CASE("FftTest.transforms_are_pinned") {
+    // Computed once; every platform, instruction set and set of flags has
+    // to give the same bits
+    const auto digest = [](const auto &values) {
+        Digest128 result;
+        for (const auto &value : values) {
+            result.add(value.real().underlying_value());
+            result.add(value.imag().underlying_value());
+        }
+        return result.hex();
+    };
+    CHECK_EQ(digest(rstd::fft::plan<rfloat>(4096).forward(
+                 random_signal<float>(4096, 42))),
+             std::string("3599b75b65c361114c92198d11863220"));
+    CHECK_EQ(digest(rstd::fft::plan<rdouble>(4096).forward(
+                 random_signal<double>(4096, 42))),
+             std::string("5646ddb73881ab8bbd813274c6509870"));
+    CHECK_EQ(digest(rstd::fft::plan<rdouble>(2048).inverse(
+                 random_signal<double>(2048, 43))),
+             std::string("e3061a1cf0a2b11db1de9c1c159b7cc6"));
+
+    const auto small = rstd::fft::plan<rdouble>(8).forward(
+        random_signal<double>(8, 1));
+    CHECK(same_bits(small[1].real().underlying_value(), -0x1.e6337154a555p-5));
+    CHECK(same_bits(small[1].imag().underlying_value(), -0x1.36d89efc64926p+0));
+}
+
+TEST_CASE("FftTest.size_must_be_a_power_of_two") {
+    CHECK_THROWS_AS(rstd::fft::plan<rdouble>(0), std::invalid_argument);
+    CHECK_THROWS_AS(rstd::fft::plan<rdouble>(12), std::invalid_argument);
+    CHECK_EQ(rstd::fft::plan<rdouble>(64).size(), 64u);
+}
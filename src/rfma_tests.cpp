@@ -0,0 +1,212 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include <rfloat>
+#include <rfma>
+
+template <typename T> static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// std::isfinite and friends may be folded away under -ffast-math, so
+// special values are checked through their bit patterns instead
+static bool sign_bit(double x) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(x));
+    return (bits >> 63) != 0;
+}
+
+// Random finite values with uniformly distributed exponents, so products
+// and sums cover subnormals, overflow and every alignment
+template <typename T> class random_floats {
+    using bits_type = typename std::conditional<sizeof(T) == 4, std::uint32_t,
+                                                std::uint64_t>::type;
+    std::mt19937_64 gen;
+
+  public:
+    explicit random_floats(unsigned seed) : gen(seed) {}
+
+    T operator()() {
+        for (;;) {
+            bits_type bits = static_cast<bits_type>(gen());
+            bits_type exponent =
+                (bits >> (std::numeric_limits<T>::digits - 1)) &
+                ((bits_type(1) << (sizeof(T) * 8 -
+                                   std::numeric_limits<T>::digits)) -
+                 1);
+            if (exponent != (bits_type(1) << (sizeof(T) * 8 -
+                                              std::numeric_limits<T>::digits)) -
+                                1) {
+                T value;
+                std::memcpy(&value, &bits, sizeof(T));
+                return value;
+            }
+        }
+    }
+
+    // A value within a few orders of magnitude of 1
+    T moderate() {
+        std::uniform_real_distribution<T> dis(-4, 4);
+        return std::ldexp(dis(gen), static_cast<int>(gen() % 40) - 20);
+    }
+};
+
+// -ffast-math may enable flush-to-zero, in which case the hardware doesn't
+// implement subnormals and can't serve as the reference for them
+template <typename T> static bool flushes_subnormals() {
+    volatile T smallest = std::numeric_limits<T>::min();
+    volatile T half = smallest / 2;
+    return half == 0;
+}
+
+template <typename T> static bool is_subnormal_or_zero(T x) {
+    return std::abs(x) < std::numeric_limits<T>::min();
+}
+
+template <rmath::RoundingMode R, typename T>
+static void check_soft_fma(T a, T b, T c) {
+    T expected = std::fma(a, b, c);
+    if (flushes_subnormals<T>() &&
+        (is_subnormal_or_zero(a) || is_subnormal_or_zero(b) ||
+         is_subnormal_or_zero(c) || is_subnormal_or_zero(expected))) {
+        return;
+    }
+    T actual = rstd::detail::soft_fma<R>(a, b, c);
+    if (!same_bits(actual, expected)) {
+        CHECK_EQ(actual, expected);
+    }
+}
+
+template <rmath::RoundingMode R, typename T>
+static void check_random_soft_fma(int mode) {
+    random_floats<T> random(42);
+    std::fesetround(mode);
+    for (int i = 0; i < 100000; ++i) {
+        // Mix of fully random operands, which mostly overflow or underflow,
+        // and moderate ones, which mostly exercise the rounding
+        check_soft_fma<R, T>(random(), random(), random());
+        T a = random.moderate();
+        T b = random.moderate();
+        check_soft_fma<R, T>(a, b, random.moderate());
+        // An addend close to the product forces cancellation
+        volatile T product = a * b;
+        check_soft_fma<R, T>(a, b, -product);
+        check_soft_fma<R, T>(a, b, -product * T(1.5));
+    }
+    std::fesetround(FE_TONEAREST);
+}
+
+TEST_CASE("SoftFmaTest.float_matches_hardware") {
+    check_random_soft_fma<rmath::RoundingMode::ToEven, float>(FE_TONEAREST);
+}
+
+TEST_CASE("SoftFmaTest.double_matches_hardware") {
+    check_random_soft_fma<rmath::RoundingMode::ToEven, double>(FE_TONEAREST);
+}
+
+TEST_CASE("SoftFmaTest.directed_rounding") {
+    check_random_soft_fma<rmath::RoundingMode::ToPositive, double>(FE_UPWARD);
+    check_random_soft_fma<rmath::RoundingMode::ToNegative, double>(
+        FE_DOWNWARD);
+    check_random_soft_fma<rmath::RoundingMode::ToZero, float>(FE_TOWARDZERO);
+}
+
+TEST_CASE("SoftFmaTest.special_cases") {
+    using rmath::RoundingMode;
+    const double max = std::numeric_limits<double>::max();
+    const double tiny = std::numeric_limits<double>::denorm_min();
+    const double eps = std::ldexp(1.0, -30);
+
+    // The fused result keeps the bits a rounded product loses
+    CHECK_EQ(rstd::detail::soft_fma<RoundingMode::ToEven>(1.0 + eps,
+                                                           1.0 - eps, -1.0),
+             -std::ldexp(1.0, -60));
+
+    // Exact cancellation gives +0, or -0 when rounding down
+    double zero = rstd::detail::soft_fma<RoundingMode::ToEven>(2.0, 3.0, -6.0);
+    CHECK(same_bits(zero, 0.0));
+    double negative_zero =
+        rstd::detail::soft_fma<RoundingMode::ToNegative>(2.0, 3.0, -6.0);
+    CHECK(sign_bit(negative_zero));
+
+    CHECK_EQ(rstd::detail::soft_fma<RoundingMode::ToEven>(max, 2.0, -max),
+             max);
+    CHECK(same_bits(rstd::detail::soft_fma<RoundingMode::ToEven>(max, 2.0, 0.0),
+                    std::numeric_limits<double>::infinity()));
+    CHECK_EQ(rstd::detail::soft_fma<RoundingMode::ToZero>(max, 2.0, 0.0),
+             max);
+    // 1.5 ulp of the smallest subnormal rounds to even
+    CHECK_EQ(rstd::detail::soft_fma<RoundingMode::ToEven>(tiny, 0.5, tiny),
+             2 * tiny);
+    CHECK_EQ(rstd::detail::soft_fma<RoundingMode::ToEven>(tiny, 0.75, 0.0),
+             tiny);
+    CHECK_EQ(rstd::detail::soft_fma<RoundingMode::ToEven>(0.0, 5.0, 3.0),
+             3.0);
+}
+
+TEST_CASE("ContractedTest.fusion_points") {
+    random_floats<double> random(7);
+    for (int i = 0; i < 1000; ++i) {
+        double x = random.moderate();
+        double y = random.moderate();
+        double z = random.moderate();
+        double w = random.moderate();
+        rdouble_fma a = x, b = y, c = z, d = w;
+
+        CHECK(same_bits((a * b + c).underlying_value(), std::fma(x, y, z)));
+        CHECK(same_bits((c + a * b).underlying_value(), std::fma(x, y, z)));
+        CHECK(same_bits((a * b - c).underlying_value(), std::fma(x, y, -z)));
+        CHECK(same_bits((c - a * b).underlying_value(), std::fma(-x, y, z)));
+        CHECK(same_bits((-(a * b) + c).underlying_value(),
+                        std::fma(-x, y, z)));
+
+        volatile double rounded = z * w;
+        CHECK(same_bits((a * b + c * d).underlying_value(),
+                        std::fma(x, y, rounded)));
+
+        // A product that isn't added to is rounded on its own
+        rdouble_fma product = a * b;
+        volatile double expected_product = x * y;
+        CHECK(same_bits(product.underlying_value(), expected_product));
+        volatile double expected_chain = expected_product * z;
+        rdouble_fma chained = (a * b) * c;
+        CHECK(same_bits(chained.underlying_value(), expected_chain));
+
+        rdouble_fma accumulated = c;
+        accumulated += a * b;
+        CHECK(same_bits(accumulated.underlying_value(), std::fma(x, y, z)));
+        accumulated = c;
+        accumulated -= a * b;
+        CHECK(same_bits(accumulated.underlying_value(), std::fma(-x, y, z)));
+
+        CHECK(same_bits(rstd::fma(a, b, c).underlying_value(),
+                        std::fma(x, y, z)));
+    }
+}
+
+TEST_CASE("ContractedTest.dot_product") {
+    random_floats<float> random(9);
+    rfloat_fma sum = 0.0f;
+    float expected = 0.0f;
+    for (int i = 0; i < 1000; ++i) {
+        float x = random.moderate();
+        float y = random.moderate();
+        sum += rfloat_fma(x) * rfloat_fma(y);
+        expected = std::fma(x, y, expected);
+    }
+    CHECK(same_bits(sum.underlying_value(), expected));
+}
+
+TEST_CASE("ContractedTest.conversions") {
+    rdouble r = 1.5;
+    rdouble_fma c = r;
+    CHECK_EQ(c.reproducible(), r);
+    CHECK_EQ(c * 2.0 + 1.0, 4.0);
+    CHECK(c < 2.0);
+}
@@ -0,0 +1,351 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <rfloat>
+#include <rhalf>
+
+// Values are compared by their bits, since -ffast-math lets the compiler
+// assume there are no NaNs, and flushes float subnormals when they're
+// converted to double.
+
+static std::uint32_t bits_of(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float from_bits(std::uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template <typename Format> constexpr int significand_bits() {
+    return Format::digits - 1;
+}
+
+template <typename Format> constexpr int exponent_bias() {
+    return Format::max_exponent - 1;
+}
+
+template <typename Format> static bool is_nan_bits(std::uint16_t bits) {
+    return (bits & 0x7fff) > Format::infinity;
+}
+
+// The value of a finite 16-bit pattern, decoded from its fields
+template <typename Format> static double decode(std::uint16_t bits) {
+    constexpr int m = significand_bits<Format>();
+    const int exponent = (bits & 0x7fff) >> m;
+    const int significand = bits & ((1 << m) - 1);
+    const double magnitude =
+        exponent == 0
+            ? std::ldexp(significand, 1 - exponent_bias<Format>() - m)
+            : std::ldexp((1 << m) + significand,
+                         exponent - exponent_bias<Format>() - m);
+    return bits & 0x8000 ? -magnitude : magnitude;
+}
+
+// Rounds a double to the nearest 16-bit value, ties to even, by searching
+// the table of every finite positive value
+template <typename Format> class Reference {
+  public:
+    Reference() {
+        for (std::uint32_t bits = 0; bits <= Format::max; ++bits) {
+            m_values.push_back(decode<Format>(std::uint16_t(bits)));
+        }
+        const double max = m_values[Format::max];
+        m_overflow = max + (max - m_values[Format::max - 1]) / 2;
+    }
+
+    std::uint16_t narrow(double value) const {
+        const std::uint16_t sign = std::signbit(value) ? 0x8000 : 0;
+        const double magnitude = std::abs(value);
+        // The largest value is odd, so a tie goes to infinity
+        if (magnitude >= m_overflow) {
+            return sign | Format::infinity;
+        }
+        const auto above =
+            std::upper_bound(m_values.begin(), m_values.end(), magnitude);
+        const auto below = above - 1;
+        std::uint16_t bits = std::uint16_t(below - m_values.begin());
+        if (above != m_values.end()) {
+            const double down = magnitude - *below;
+            const double up = *above - magnitude;
+            if (up < down || (up == down && bits % 2 == 1)) {
+                ++bits;
+            }
+        }
+        return sign | bits;
+    }
+
+    const std::vector<double> &values() const { return m_values; }
+
+  private:
+    std::vector<double> m_values;
+    double m_overflow;
+};
+
+template <typename Format> static const Reference<Format> &reference() {
+    static const Reference<Format> table;
+    return table;
+}
+
+// Samples across every float bit pattern, and the values at, just below
+// and just above each midpoint between consecutive 16-bit values
+template <typename Format> static std::vector<float> narrow_inputs() {
+    std::vector<float> inputs;
+    for (std::uint64_t bits = 0; bits <= 0xffffffff; bits += 65521) {
+        inputs.push_back(from_bits(std::uint32_t(bits)));
+    }
+    const auto &values = reference<Format>().values();
+    for (std::size_t i = 1; i < values.size(); ++i) {
+        const float midpoint = float((values[i - 1] + values[i]) / 2);
+        if (bits_of(midpoint) < 0x00800000) {
+            continue;
+        }
+        for (const float value :
+             {midpoint, std::nextafter(midpoint, 0.0f),
+              std::nextafter(midpoint, std::numeric_limits<float>::max())}) {
+            inputs.push_back(value);
+            inputs.push_back(-value);
+        }
+    }
+    for (const std::uint32_t bits :
+         {0x00000000u, 0x80000000u, 0x7f800000u, 0xff800000u, 0x7f7fffffu,
+          0x477fe000u, 0x477fefffu, 0x477ff000u, 0x477ff001u, 0x38800000u,
+          0x387fffffu, 0x33000000u, 0x33000001u, 0x32ffffffu}) {
+        inputs.push_back(from_bits(bits));
+    }
+    return inputs;
+}
+
+template <typename Format>
+static void check_narrow(float input, std::uint16_t result) {
+    const std::uint32_t input_bits = bits_of(input);
+    INFO("input bits: ", input_bits);
+    if ((input_bits & 0x7fffffff) > 0x7f800000) {
+        CHECK(is_nan_bits<Format>(result));
+        CHECK((result & 0x8000) == ((input_bits >> 16) & 0x8000));
+    } else if ((input_bits & 0x7f800000) != 0) {
+        CHECK(result == reference<Format>().narrow(double(input)));
+    }
+}
+
+TEST_CASE("HalfTest.widens_every_binary16_exactly") {
+    for (std::uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        const rhalf value = rhalf::from_bits(std::uint16_t(bits));
+        const std::uint32_t widened = bits_of(value.fp32());
+        INFO("bits: ", bits);
+        if (is_nan_bits<rstd::binary16>(std::uint16_t(bits))) {
+            CHECK(widened ==
+                  ((bits & 0x8000) << 16 | 0x7f800000 | (bits & 0x3ff) << 13));
+        } else if ((bits & 0x7fff) == 0x7c00) {
+            CHECK(widened == ((bits & 0x8000) << 16 | 0x7f800000));
+        } else {
+            CHECK(widened == bits_of(float(decode<rstd::binary16>(
+                                 std::uint16_t(bits)))));
+        }
+    }
+}
+
+TEST_CASE("HalfTest.bfloat16_widens_to_top_half_of_float") {
+    for (std::uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        const rbfloat16 value = rbfloat16::from_bits(std::uint16_t(bits));
+        CHECK(bits_of(value.fp32()) == bits << 16);
+    }
+}
+
+TEST_CASE("HalfTest.rounds_to_nearest_ties_to_even") {
+    for (const float input : narrow_inputs<rstd::binary16>()) {
+        check_narrow<rstd::binary16>(input, rhalf(input).bits());
+    }
+    // Float subnormals are far below the smallest binary16 subnormal
+    CHECK(rhalf(from_bits(0x00000001)).bits() == 0x0000);
+    CHECK(rhalf(from_bits(0x807fffff)).bits() == 0x8000);
+    // Half the smallest subnormal is a tie with zero, just above it isn't
+    CHECK(rhalf(0x1p-25f).bits() == 0x0000);
+    CHECK(rhalf(std::nextafter(0x1p-25f, 1.0f)).bits() == 0x0001);
+    CHECK(rhalf(65519.0f).bits() == 0x7bff);
+    CHECK(rhalf(65520.0f).bits() == 0x7c00);
+}
+
+TEST_CASE("HalfTest.bfloat16_rounds_to_nearest_ties_to_even") {
+    for (const float input : narrow_inputs<rstd::bfloat16>()) {
+        check_narrow<rstd::bfloat16>(input, rbfloat16(input).bits());
+    }
+    // Subnormals round like any other value
+    CHECK(rbfloat16(from_bits(0x00008000)).bits() == 0x0000);
+    CHECK(rbfloat16(from_bits(0x00018000)).bits() == 0x0002);
+    CHECK(rbfloat16(from_bits(0x00008001)).bits() == 0x0001);
+    CHECK(rbfloat16(from_bits(0x7f7fffff)).bits() == 0x7f80);
+    CHECK(rbfloat16(from_bits(0xff800000)).bits() == 0xff80);
+}
+
+template <typename Format> static void check_bulk_conversions() {
+    using H = rstd::ReproducibleHalf<Format>;
+
+    std::vector<H> halves(0x10000);
+    for (std::uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        halves[bits] = H::from_bits(std::uint16_t(bits));
+    }
+    std::vector<rfloat> widened(halves.size());
+    rstd::widen(halves, widened);
+    for (std::size_t i = 0; i < halves.size(); ++i) {
+        REQUIRE(bits_of(widened[i].underlying_value()) ==
+                bits_of(halves[i].fp32()));
+    }
+
+    std::vector<rfloat> inputs;
+    for (const float input : narrow_inputs<Format>()) {
+        inputs.push_back(input);
+    }
+    std::vector<H> narrowed(inputs.size());
+    rstd::narrow(inputs, narrowed);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        REQUIRE(narrowed[i].bits() == H(inputs[i]).bits());
+    }
+
+    // Every length, so that every tail is converted one value at a time
+    for (std::size_t length = 0; length < 40; ++length) {
+        std::vector<rfloat> output(length + 1, rfloat(-1.0f));
+        rstd::widen(halves.data() + 0x3c00, halves.data() + 0x3c00 + length,
+                    output.data());
+        std::vector<H> round_trip(length + 1, H::from_bits(0xffff));
+        rstd::narrow(output.data(), output.data() + length,
+                     round_trip.data());
+        for (std::size_t i = 0; i < length; ++i) {
+            CHECK(round_trip[i].bits() == 0x3c00 + i);
+        }
+        CHECK(output[length] == rfloat(-1.0f));
+        CHECK(round_trip[length].bits() == 0xffff);
+    }
+}
+
+TEST_CASE("HalfTest.bulk_conversions_match_scalar") {
+    check_bulk_conversions<rstd::binary16>();
+    check_bulk_conversions<rstd::bfloat16>();
+}
+
+// Every result is compared with the exact result rounded once. Sums,
+// differences and products of 16-bit values are exact in double, and a
+// quotient rounded to double first rounds to the same 16-bit value.
+template <typename Format>
+static void check_arithmetic(const std::vector<std::uint16_t> &operands) {
+    using H = rstd::ReproducibleHalf<Format>;
+    const auto &table = reference<Format>();
+    for (std::size_t i = 0; i + 1 < operands.size(); i += 2) {
+        const H a = H::from_bits(operands[i]);
+        const H b = H::from_bits(operands[i + 1]);
+        const double x = a.fp64();
+        const double y = b.fp64();
+        INFO("a: ", operands[i], " b: ", operands[i + 1]);
+        CHECK((a + b).bits() == table.narrow(x + y));
+        CHECK((a - b).bits() == table.narrow(x - y));
+        CHECK((a * b).bits() == table.narrow(x * y));
+        CHECK((a / b).bits() == table.narrow(x / y));
+
+        H sum = a;
+        sum += b;
+        CHECK(sum.bits() == (a + b).bits());
+        H quotient = a;
+        quotient /= b;
+        CHECK(quotient.bits() == (a / b).bits());
+    }
+}
+
+TEST_CASE("HalfTest.arithmetic_is_correctly_rounded") {
+    // Any finite nonzero values, including subnormals: no intermediate
+    // float is ever subnormal, even with flush to zero
+    std::mt19937 gen(12345);
+    std::vector<std::uint16_t> operands;
+    while (operands.size() < 100000) {
+        const auto bits = std::uint16_t(gen());
+        if ((bits & 0x7fff) != 0 && (bits & 0x7fff) < 0x7c00) {
+            operands.push_back(bits);
+        }
+    }
+    check_arithmetic<rstd::binary16>(operands);
+}
+
+TEST_CASE("HalfTest.bfloat16_arithmetic_is_correctly_rounded") {
+    // Exponents from 2^-40 to 2^40, so that no float result is subnormal
+    std::mt19937 gen(12345);
+    std::vector<std::uint16_t> operands;
+    while (operands.size() < 100000) {
+        const auto bits = std::uint16_t(gen());
+        const int exponent = (bits & 0x7fff) >> 7;
+        if (exponent >= 127 - 40 && exponent <= 127 + 40) {
+            operands.push_back(bits);
+        }
+    }
+    check_arithmetic<rstd::bfloat16>(operands);
+}
+
+TEST_CASE("HalfTest.operators") {
+    const rhalf one(1.0f);
+    const rhalf two(2.0f);
+    CHECK(one.bits() == 0x3c00);
+    CHECK((-one).bits() == 0xbc00);
+    CHECK((-rhalf::from_bits(0)).bits() == 0x8000);
+    CHECK((+two).bits() == two.bits());
+    CHECK(one < two);
+    CHECK(two > one);
+    CHECK(one <= one);
+    CHECK(two >= one);
+    CHECK(one != two);
+    CHECK(rhalf::from_bits(0x0000) == rhalf::from_bits(0x8000));
+    CHECK(static_cast<rfloat>(two) == rfloat(2.0f));
+    CHECK(static_cast<rdouble>(two) == rdouble(2.0));
+    CHECK(rhalf(rfloat(0.1f)).bits() == 0x2e66);
+
+    rhalf x = two;
+    x -= one;
+    CHECK(x == one);
+    x *= two;
+    CHECK(x == two);
+
+    std::ostringstream out;
+    out << rhalf(1.5f) << ' ' << rbfloat16(-3.0f);
+    CHECK(out.str() == "1.5 -3");
+}
+
+TEST_CASE("HalfTest.numeric_limits") {
+    using half_limits = std::numeric_limits<rhalf>;
+    static_assert(half_limits::is_specialized, "");
+    static_assert(half_limits::digits == 11 && half_limits::digits10 == 3 &&
+                      half_limits::max_digits10 == 5,
+                  "");
+    static_assert(half_limits::min_exponent10 == -4 &&
+                      half_limits::max_exponent10 == 4,
+                  "");
+    CHECK(half_limits::max().fp32() == 65504.0f);
+    CHECK(half_limits::lowest().fp32() == -65504.0f);
+    CHECK(half_limits::min().fp32() == 0x1p-14f);
+    CHECK(half_limits::denorm_min().fp32() == 0x1p-24f);
+    CHECK(half_limits::epsilon().fp32() == 0x1p-10f);
+    CHECK(half_limits::round_error().fp32() == 0.5f);
+    CHECK(bits_of(half_limits::infinity().fp32()) == 0x7f800000);
+    CHECK(bits_of(half_limits::quiet_NaN().fp32()) == 0x7fc00000);
+
+    using bfloat16_limits = std::numeric_limits<rbfloat16>;
+    static_assert(bfloat16_limits::digits == 8 &&
+                      bfloat16_limits::digits10 == 2 &&
+                      bfloat16_limits::max_digits10 == 4,
+                  "");
+    static_assert(bfloat16_limits::min_exponent10 == -37 &&
+                      bfloat16_limits::max_exponent10 == 38,
+                  "");
+    CHECK(bits_of(bfloat16_limits::max().fp32()) == 0x7f7f0000);
+    CHECK(bfloat16_limits::min().fp32() == std::numeric_limits<float>::min());
+    CHECK(bfloat16_limits::epsilon().fp32() == 0x1p-7f);
+    CHECK(bits_of(bfloat16_limits::denorm_min().fp32()) == 0x00010000);
+}
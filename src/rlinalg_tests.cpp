@@ -0,0 +1,271 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <rfloat>
+#include <rlinalg>
+
+template <typename W>
+static std::vector<W> random_matrix(std::size_t rows, std::size_t columns,
+                                    unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<W> values(rows * columns);
+    for (auto &v : values) {
+        v = static_cast<typename W::underlying_type>(dis(gen));
+    }
+    return values;
+}
+
+template <typename W>
+static bool same_bits(const std::vector<W> &a, const std::vector<W> &b) {
+    return a.size() == b.size() &&
+           std::memcmp(a.data(), b.data(), a.size() * sizeof(W)) == 0;
+}
+
+// The unblocked algorithm lu_factor documents, written out directly
+template <typename W>
+static void reference_lu(std::size_t n, std::vector<W> &a,
+                         std::vector<std::size_t> &pivots) {
+    for (std::size_t k = 0; k < n; ++k) {
+        std::size_t pivot = k;
+        auto largest = std::abs(a[k * n + k].underlying_value());
+        for (std::size_t i = k + 1; i < n; ++i) {
+            if (std::abs(a[i * n + k].underlying_value()) > largest) {
+                largest = std::abs(a[i * n + k].underlying_value());
+                pivot = i;
+            }
+        }
+        pivots[k] = pivot;
+        if (largest == 0) {
+            continue;
+        }
+        for (std::size_t j = 0; j < n; ++j) {
+            std::swap(a[k * n + j], a[pivot * n + j]);
+        }
+        for (std::size_t i = k + 1; i < n; ++i) {
+            a[i * n + k] = a[i * n + k] / a[k * n + k];
+            for (std::size_t j = k + 1; j < n; ++j) {
+                a[i * n + j] = a[i * n + j] - a[i * n + k] * a[k * n + j];
+            }
+        }
+    }
+}
+
+template <typename W> static void check_matches_reference(std::size_t n) {
+    CAPTURE(n);
+    const auto a = random_matrix<W>(n, n, 12345 + unsigned(n));
+    auto expected = a;
+    std::vector<std::size_t> expected_pivots(n);
+    reference_lu(n, expected, expected_pivots);
+
+    auto lu = a;
+    std::vector<std::size_t> pivots(n);
+    CHECK_EQ(rstd::linalg::lu_factor(n, lu.data(), n, pivots.data()), 0);
+    CHECK(same_bits(lu, expected));
+    CHECK(pivots == expected_pivots);
+}
+
+TEST_CASE("LinalgTest.lu_matches_unblocked_algorithm") {
+    for (std::size_t n : {1, 2, 3, 5, 16, 63, 64, 65, 130, 257}) {
+        check_matches_reference<rdouble>(n);
+        check_matches_reference<rfloat>(n);
+    }
+}
+
+TEST_CASE("LinalgTest.lu_independent_of_blocking_and_threads") {
+    const std::size_t n = 300;
+    const auto a = random_matrix<rdouble>(n, n, 7);
+    auto expected = a;
+    std::vector<std::size_t> expected_pivots(n);
+    rstd::linalg::lu_factor(n, expected.data(), n, expected_pivots.data());
+
+    for (std::size_t block : {1, 7, 32, 100, 300}) {
+        CAPTURE(block);
+        auto lu = a;
+        std::vector<std::size_t> pivots(n);
+        rstd::linalg::detail::lu_factor(n, lu.data(), n, pivots.data(), block,
+                                        nullptr);
+        CHECK(same_bits(lu, expected));
+        CHECK(pivots == expected_pivots);
+    }
+    for (std::size_t threads : {1, 2, 3, 8}) {
+        CAPTURE(threads);
+        rstd::execution::thread_pool pool(threads);
+        auto lu = a;
+        std::vector<std::size_t> pivots(n);
+        rstd::linalg::lu_factor(rstd::execution::deterministic_par.on(pool),
+                                n, lu.data(), n, pivots.data());
+        CHECK(same_bits(lu, expected));
+        CHECK(pivots == expected_pivots);
+    }
+}
+
+TEST_CASE("LinalgTest.lu_leading_dimension") {
+    const std::size_t n = 70;
+    const std::size_t lda = 75;
+    auto padded = random_matrix<rdouble>(n, lda, 3);
+    std::vector<rdouble> packed(n * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            packed[i * n + j] = padded[i * lda + j];
+        }
+    }
+    const auto original = padded;
+    std::vector<std::size_t> pivots(n);
+    std::vector<std::size_t> packed_pivots(n);
+    rstd::linalg::lu_factor(n, padded.data(), lda, pivots.data());
+    rstd::linalg::lu_factor(n, packed.data(), n, packed_pivots.data());
+    CHECK(pivots == packed_pivots);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < lda; ++j) {
+            // The padding isn't touched
+            const rdouble expected =
+                j < n ? packed[i * n + j] : original[i * lda + j];
+            CHECK_EQ(padded[i * lda + j], expected);
+        }
+    }
+}
+
+TEST_CASE("LinalgTest.lu_solve") {
+    const std::size_t n = 150;
+    const std::size_t nrhs = 3;
+    const auto a = random_matrix<rdouble>(n, n, 11);
+    const auto x = random_matrix<rdouble>(n, nrhs, 13);
+    // b = a x
+    std::vector<rdouble> b(n * nrhs, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t k = 0; k < n; ++k) {
+            for (std::size_t j = 0; j < nrhs; ++j) {
+                b[i * nrhs + j] = b[i * nrhs + j] + a[i * n + k] * x[k * nrhs + j];
+            }
+        }
+    }
+
+    auto lu = a;
+    std::vector<std::size_t> pivots(n);
+    REQUIRE_EQ(rstd::linalg::lu_factor(n, lu.data(), n, pivots.data()), 0);
+    auto solution = b;
+    rstd::linalg::lu_solve(n, lu.data(), n, pivots.data(), nrhs,
+                           solution.data(), nrhs);
+    for (std::size_t i = 0; i < n * nrhs; ++i) {
+        CHECK(std::abs((solution[i] - x[i]).underlying_value()) < 1e-10);
+    }
+
+    // Every column is solved the same way on its own
+    for (std::size_t j = 0; j < nrhs; ++j) {
+        std::vector<rdouble> column(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            column[i] = b[i * nrhs + j];
+        }
+        rstd::linalg::lu_solve(n, lu.data(), n, pivots.data(), column.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK_EQ(column[i], solution[i * nrhs + j]);
+        }
+    }
+}
+
+TEST_CASE("LinalgTest.lu_singular") {
+    // The third column is twice the first
+    std::vector<rdouble> a = {1, 2, 2, 0, //
+                              2, 1, 4, 1, //
+                              3, 5, 6, 2, //
+                              4, 0, 8, 3};
+    std::vector<std::size_t> pivots(4);
+    CHECK_EQ(rstd::linalg::lu_factor(4, a.data(), 4, pivots.data()), 3);
+
+    std::vector<rfloat> zero(9, 0.0f);
+    std::vector<std::size_t> zero_pivots(3);
+    CHECK_EQ(rstd::linalg::lu_factor(3, zero.data(), 3, zero_pivots.data()),
+             1);
+    CHECK((zero_pivots == std::vector<std::size_t>{0, 1, 2}));
+}
+
+template <typename W>
+static std::vector<W> reference_multiply(std::size_t m, std::size_t n,
+                                         std::size_t depth,
+                                         const std::vector<W> &a,
+                                         const std::vector<W> &b) {
+    std::vector<W> c(m * n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            W sum = 0;
+            for (std::size_t k = 0; k < depth; ++k) {
+                sum += a[i * depth + k] * b[k * n + j];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+    return c;
+}
+
+template <typename W>
+static void check_multiply(std::size_t m, std::size_t n, std::size_t depth) {
+    CAPTURE(m);
+    CAPTURE(n);
+    CAPTURE(depth);
+    const auto a = random_matrix<W>(m, depth, unsigned(m * 7 + depth));
+    const auto b = random_matrix<W>(depth, n, unsigned(n * 13 + depth));
+    const auto expected = reference_multiply(m, n, depth, a, b);
+
+    std::vector<W> c(m * n, W(1));
+    rstd::linalg::multiply(m, n, depth, a.data(), depth, b.data(), n,
+                           c.data(), n);
+    CHECK(same_bits(c, expected));
+
+    for (std::size_t threads : {2, 5}) {
+        rstd::execution::thread_pool pool(threads);
+        std::vector<W> parallel(m * n);
+        rstd::linalg::multiply(rstd::execution::deterministic_par.on(pool), m,
+                               n, depth, a.data(), depth, b.data(), n,
+                               parallel.data(), n);
+        CHECK(same_bits(parallel, expected));
+    }
+}
+
+TEST_CASE("LinalgTest.multiply_matches_triple_loop") {
+    // Shapes smaller than, equal to and straddling the register and cache
+    // blocks, including the depth blocking
+    const std::size_t sizes[][3] = {{0, 3, 3},    {3, 0, 3},     {3, 3, 0},
+                                    {1, 1, 1},    {4, 16, 9},    {5, 17, 3},
+                                    {64, 64, 64}, {70, 530, 40}, {130, 33, 600},
+                                    {200, 200, 257}};
+    for (const auto &size : sizes) {
+        check_multiply<rdouble>(size[0], size[1], size[2]);
+        check_multiply<rfloat>(size[0], size[1], size[2]);
+    }
+}
+
+TEST_CASE("LinalgTest.multiply_add_and_leading_dimensions") {
+    const std::size_t m = 37, n = 45, depth = 300;
+    const std::size_t lda = 310, ldb = 50, ldc = 48;
+    const auto a = random_matrix<rdouble>(m, lda, 21);
+    const auto b = random_matrix<rdouble>(depth, ldb, 22);
+    const auto initial = random_matrix<rdouble>(m, ldc, 23);
+
+    auto expected = initial;
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t k = 0; k < depth; ++k) {
+                expected[i * ldc + j] = expected[i * ldc + j] +
+                                        a[i * lda + k] * b[k * ldb + j];
+            }
+        }
+    }
+
+    auto c = initial;
+    rstd::linalg::multiply_add(m, n, depth, a.data(), lda, b.data(), ldb,
+                               c.data(), ldc);
+    // Including the padding, which must be left alone
+    CHECK(same_bits(c, expected));
+
+    rstd::execution::thread_pool pool(3);
+    c = initial;
+    rstd::linalg::multiply_add(rstd::execution::deterministic_par.on(pool), m,
+                               n, depth, a.data(), lda, b.data(), ldb,
+                               c.data(), ldc);
+    CHECK(same_bits(c, expected));
+}
@@ -0,0 +1,341 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <rexecution>
+#include <rfloat>
+#include <rnumeric>
+
+#include "rcmath_tests.hh"
+
+template <typename T>
+static std::vector<T> wide_range_values(std::size_t count, unsigned seed) {
+    using U = typename T::underlying_type;
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<U> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(
+        std::numeric_limits<U>::min_exponent - 10,
+        std::numeric_limits<U>::max_exponent - 10);
+    std::vector<T> values(count);
+    for (auto &v : values) {
+        v = std::ldexp(mantissa(gen), exponent(gen));
+    }
+    return values;
+}
+
+template <typename T>
+static bool same_bits(const T &a, const T &b) {
+    auto x = a.underlying_value();
+    auto y = b.underlying_value();
+    return std::memcmp(&x, &y, sizeof(x)) == 0;
+}
+
+// std::isnan and std::signbit may be folded away under -ffast-math, so
+// special values are checked through their bit patterns instead
+static bool is_nan_bits(double x) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(x));
+    return (bits & 0x7FF0000000000000ull) == 0x7FF0000000000000ull &&
+           (bits & 0x000FFFFFFFFFFFFFull) != 0;
+}
+
+static bool sign_bit(double x) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(x));
+    return (bits >> 63) != 0;
+}
+
+TEST_CASE("ReproducibleSumTest.OrderIndependent") {
+    auto values = wide_range_values<rdouble>(10000, 1);
+    rdouble expected = rstd::reproducible_sum(values);
+
+    std::mt19937 gen(2);
+    for (int i = 0; i < 10; ++i) {
+        std::shuffle(values.begin(), values.end(), gen);
+        CHECK(same_bits(rstd::reproducible_sum(values), expected));
+    }
+
+    std::reverse(values.begin(), values.end());
+    CHECK(same_bits(rstd::reproducible_sum(values), expected));
+}
+
+TEST_CASE("ReproducibleSumTest.ChunkingIndependent") {
+    auto values = wide_range_values<rfloat>(10007, 3);
+    rfloat expected = rstd::reproducible_sum(values);
+
+    for (std::size_t chunk : {1u, 7u, 64u, 1000u, 5000u}) {
+        rstd::ReproducibleAccumulator<float> total;
+        for (std::size_t start = 0; start < values.size(); start += chunk) {
+            rstd::ReproducibleAccumulator<float> partial;
+            auto end = std::min(start + chunk, values.size());
+            for (std::size_t i = start; i < end; ++i) {
+                partial += values[i];
+            }
+            total += partial;
+        }
+        CHECK(same_bits(total.result(), expected));
+    }
+}
+
+TEST_CASE("ReproducibleSumTest.ThreadCountIndependent") {
+    auto values = wide_range_values<rdouble>(100000, 4);
+    rdouble expected = rstd::reproducible_sum(values);
+
+    for (std::size_t thread_count : {2u, 3u, 8u}) {
+        std::vector<rstd::ReproducibleAccumulator<double>> partials(
+            thread_count);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                // Strided rather than contiguous, to interleave the values
+                for (std::size_t i = t; i < values.size(); i += thread_count) {
+                    partials[t] += values[i];
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        rstd::ReproducibleAccumulator<double> total;
+        for (auto it = partials.rbegin(); it != partials.rend(); ++it) {
+            total += *it;
+        }
+        CHECK(same_bits(total.result(), expected));
+    }
+}
+
+TEST_CASE("ReproducibleSumTest.ExactCancellation") {
+    std::vector<rdouble> values = {1e308, 1.0, -1e308, 1e-300, -1e-300};
+    CHECK_EQ(rstd::reproducible_sum(values), 1.0);
+
+    // A naive sum loses the small terms entirely
+    std::vector<rdouble> naive = {1.0, 1e100, 1.0, -1e100};
+    CHECK_EQ(TestFunctions<rdouble>::naive_sum(naive), 0.0);
+    CHECK_EQ(rstd::reproducible_sum(naive), 2.0);
+}
+
+TEST_CASE("ReproducibleSumTest.CorrectlyRounded") {
+    // Every value is a multiple of 2^-23 in [1, 2), so the exact sum of up to
+    // 2^29 of them fits in a double and the conversion is the only rounding.
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dis(0, (1 << 23) - 1);
+    std::vector<rfloat> values(100000);
+    double exact = 0.0;
+    for (auto &v : values) {
+        float x = 1.0f + std::ldexp(static_cast<float>(dis(gen)), -23);
+        v = x;
+        exact += x;
+    }
+    CHECK_EQ(rstd::reproducible_sum(values), static_cast<float>(exact));
+}
+
+TEST_CASE("ReproducibleSumTest.Subnormals") {
+    const double tiny = std::numeric_limits<double>::denorm_min();
+    std::vector<rdouble> values(1000, tiny);
+    CHECK_EQ(rstd::reproducible_sum(values), 1000 * tiny);
+
+    std::vector<rfloat> halfway = {std::numeric_limits<float>::min(),
+                                   -std::numeric_limits<float>::denorm_min()};
+    CHECK_EQ(rstd::reproducible_sum(halfway),
+             std::numeric_limits<float>::min() -
+                 std::numeric_limits<float>::denorm_min());
+}
+
+TEST_CASE("ReproducibleSumTest.SpecialValues") {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double max = std::numeric_limits<double>::max();
+
+    std::vector<rdouble> overflow = {max, max, -max};
+    CHECK_EQ(rstd::reproducible_sum(overflow), max);
+
+    std::vector<rdouble> too_large = {max, max};
+    CHECK_EQ(rstd::reproducible_sum(too_large), inf);
+
+    std::vector<rdouble> infinite = {1.0, inf, -5.0};
+    CHECK_EQ(rstd::reproducible_sum(infinite), inf);
+
+    std::vector<rdouble> undefined = {1.0, inf, -inf};
+    CHECK(is_nan_bits(rstd::reproducible_sum(undefined).underlying_value()));
+
+    std::vector<rdouble> empty;
+    CHECK_FALSE(
+        sign_bit(rstd::reproducible_sum(empty).underlying_value()));
+
+    std::vector<rdouble> negative_zeros = {-0.0, -0.0};
+    CHECK(sign_bit(
+        rstd::reproducible_sum(negative_zeros).underlying_value()));
+
+    std::vector<rdouble> mixed_zeros = {-0.0, 0.0, 3.0, -3.0};
+    CHECK_FALSE(
+        sign_bit(rstd::reproducible_sum(mixed_zeros).underlying_value()));
+}
+
+TEST_CASE("ReproducibleSumTest.DirectedRounding") {
+    using up = rstd::ReproducibleWrapper<double, rmath::RoundingMode::ToPositive>;
+    using down =
+        rstd::ReproducibleWrapper<double, rmath::RoundingMode::ToNegative>;
+    using zero = rstd::ReproducibleWrapper<double, rmath::RoundingMode::ToZero>;
+
+    const double tiny = std::ldexp(1.0, -60);
+    std::vector<up> ups = {1.0, tiny};
+    std::vector<down> downs = {-1.0, -tiny};
+    std::vector<zero> zeros = {-1.0, -tiny};
+
+    CHECK_EQ(rstd::reproducible_sum(ups).underlying_value(),
+             std::nextafter(1.0, 2.0));
+    CHECK_EQ(rstd::reproducible_sum(downs).underlying_value(),
+             std::nextafter(-1.0, -2.0));
+    CHECK_EQ(rstd::reproducible_sum(zeros).underlying_value(), -1.0);
+
+    std::vector<down> cancelled = {2.0, -2.0};
+    CHECK(sign_bit(rstd::reproducible_sum(cancelled).underlying_value()));
+}
+
+// Input sizes around the block boundaries of the parallel algorithms
+static const std::size_t parallel_sizes[] = {0,    1,    2047,  2048,
+                                             2049, 6144, 10000, 100003};
+
+TEST_CASE("DeterministicParTest.ReduceIndependentOfThreadCount") {
+    rstd::execution::thread_pool pools[] = {
+        rstd::execution::thread_pool(1), rstd::execution::thread_pool(2),
+        rstd::execution::thread_pool(3), rstd::execution::thread_pool(8)};
+
+    for (std::size_t size : parallel_sizes) {
+        auto values = wide_range_values<rdouble>(size, 6);
+        rdouble expected = rstd::reduce(rstd::execution::deterministic_par,
+                                        values.begin(), values.end());
+        for (auto &pool : pools) {
+            auto policy = rstd::execution::deterministic_par.on(pool);
+            CHECK(same_bits(
+                rstd::reduce(policy, values.begin(), values.end()),
+                expected));
+        }
+    }
+}
+
+TEST_CASE("DeterministicParTest.ReduceShape") {
+    // A single block is reduced left to right, and init is added last
+    std::vector<rfloat> small = {1e8f, 1.0f, -1e8f, 1.0f};
+    CHECK_EQ(rstd::reduce(rstd::execution::deterministic_par, small.begin(),
+                          small.end(), rfloat(0.5f)),
+             TestFunctions<rfloat>::naive_sum(small) + 0.5f);
+
+    // Blocks are combined pairwise, so a sum of identical values is exact
+    // as long as every block sum is
+    std::vector<rfloat> ones(3 * 2048 + 5, 1.0f);
+    CHECK_EQ(rstd::reduce(rstd::execution::deterministic_par, ones.begin(),
+                          ones.end()),
+             static_cast<float>(ones.size()));
+
+    CHECK_EQ(rstd::reduce(rstd::execution::deterministic_par, ones.begin(),
+                          ones.begin(), rfloat(3.0f)),
+             3.0f);
+}
+
+TEST_CASE("DeterministicParTest.TransformReduce") {
+    rstd::execution::thread_pool single(1);
+    rstd::execution::thread_pool several(5);
+    auto xs = wide_range_values<rfloat>(50000, 7);
+    auto ys = wide_range_values<rfloat>(50000, 8);
+    for (auto &x : xs) {
+        x = x / 1e30f;
+    }
+
+    auto square = [](rfloat x) { return x * x; };
+    auto serial = rstd::execution::deterministic_par.on(single);
+    auto parallel = rstd::execution::deterministic_par.on(several);
+
+    CHECK(same_bits(rstd::transform_reduce(serial, xs.begin(), xs.end(),
+                                           rfloat(0.0f), std::plus<>(),
+                                           square),
+                    rstd::transform_reduce(parallel, xs.begin(), xs.end(),
+                                           rfloat(0.0f), std::plus<>(),
+                                           square)));
+
+    CHECK(same_bits(rstd::transform_reduce(serial, xs.begin(), xs.end(),
+                                           ys.begin(), rfloat(1.0f)),
+                    rstd::transform_reduce(parallel, xs.begin(), xs.end(),
+                                           ys.begin(), rfloat(1.0f))));
+
+    std::vector<rfloat> a = {1.0f, 2.0f, 3.0f};
+    std::vector<rfloat> b = {4.0f, 5.0f, 6.0f};
+    CHECK_EQ(rstd::transform_reduce(parallel, a.begin(), a.end(), b.begin(),
+                                    rfloat(0.0f)),
+             32.0f);
+}
+
+TEST_CASE("DeterministicParTest.InclusiveScan") {
+    rstd::execution::thread_pool single(1);
+    rstd::execution::thread_pool several(8);
+    auto serial = rstd::execution::deterministic_par.on(single);
+    auto parallel = rstd::execution::deterministic_par.on(several);
+
+    for (std::size_t size : parallel_sizes) {
+        auto values = wide_range_values<rdouble>(size, 9);
+        std::vector<rdouble> expected(size);
+        std::vector<rdouble> actual(size);
+
+        auto end = rstd::inclusive_scan(serial, values.begin(), values.end(),
+                                        expected.begin());
+        CHECK(end == expected.end());
+        rstd::inclusive_scan(parallel, values.begin(), values.end(),
+                             actual.begin());
+        CHECK(std::equal(expected.begin(), expected.end(), actual.begin(),
+                         same_bits<rdouble>));
+
+        rstd::inclusive_scan(serial, values.begin(), values.end(),
+                             expected.begin(), std::plus<>(), rdouble(2.5));
+        rstd::inclusive_scan(parallel, values.begin(), values.end(),
+                             actual.begin(), std::plus<>(), rdouble(2.5));
+        CHECK(std::equal(expected.begin(), expected.end(), actual.begin(),
+                         same_bits<rdouble>));
+    }
+
+    // A single block matches the sequential scan
+    auto values = wide_range_values<rdouble>(2048, 10);
+    std::vector<rdouble> expected(values.size());
+    std::vector<rdouble> actual(values.size());
+    std::inclusive_scan(values.begin(), values.end(), expected.begin());
+    rstd::inclusive_scan(parallel, values.begin(), values.end(),
+                         actual.begin());
+    CHECK(std::equal(expected.begin(), expected.end(), actual.begin(),
+                     same_bits<rdouble>));
+
+    // Block prefixes carry over into later blocks
+    std::vector<rdouble> ones(5000, 1.0);
+    rstd::inclusive_scan(parallel, ones.begin(), ones.end(), ones.begin());
+    for (std::size_t i = 0; i < ones.size(); ++i) {
+        CHECK_EQ(ones[i], static_cast<double>(i + 1));
+    }
+}
+
+TEST_CASE("DeterministicParTest.ExceptionsPropagate") {
+    rstd::execution::thread_pool pool(4);
+    std::vector<rdouble> values(10000, 1.0);
+    auto throwing = [](rdouble x) -> rdouble {
+        if (x > 0.0) {
+            throw std::runtime_error("transform failed");
+        }
+        return x;
+    };
+    CHECK_THROWS_AS(rstd::transform_reduce(
+                        rstd::execution::deterministic_par.on(pool),
+                        values.begin(), values.end(), rdouble(0.0),
+                        std::plus<>(), throwing),
+                    std::runtime_error);
+
+    // The pool is still usable afterwards
+    CHECK_EQ(rstd::reduce(rstd::execution::deterministic_par.on(pool),
+                          values.begin(), values.end()),
+             10000.0);
+}
@@ -0,0 +1,143 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <array>
+#include <random>
+#include <vector>
+
+#include <rfloat>
+#include <rsimd>
+
+#include "rcmath_tests.hh"
+
+template <typename V>
+static std::vector<typename V::value_type>
+random_values(std::size_t count, typename V::underlying_type min,
+              typename V::underlying_type max) {
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<typename V::underlying_type> dis(min, max);
+    std::vector<typename V::value_type> values(count);
+    for (auto &v : values) {
+        v = dis(gen);
+    }
+    return values;
+}
+
+// Every lane must produce exactly what the scalar wrapper produces
+template <typename V> static void check_lanes_match_scalar() {
+    using S = typename V::value_type;
+    constexpr std::size_t N = V::size();
+    auto lhs = random_values<V>(N * 16, -1e3, 1e3);
+    auto rhs = random_values<V>(N * 16, 1e-3, 1e3);
+
+    for (std::size_t i = 0; i < lhs.size(); i += N) {
+        V a = V::load(&lhs[i]);
+        V b = V::load(&rhs[i]);
+
+        V sum = a + b;
+        V difference = a - b;
+        V product = a * b;
+        V quotient = a / b;
+        V negated = -a;
+        V fused_like = a * b + a;
+
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            S x = lhs[i + lane];
+            S y = rhs[i + lane];
+            CHECK_EQ(sum[lane], x + y);
+            CHECK_EQ(difference[lane], x - y);
+            CHECK_EQ(product[lane], x * y);
+            CHECK_EQ(quotient[lane], x / y);
+            CHECK_EQ(negated[lane], -x);
+            CHECK_EQ(fused_like[lane], x * y + x);
+        }
+    }
+}
+
+TEST_CASE("SimdTest.rfloat4_matches_scalar") {
+    check_lanes_match_scalar<rfloat4>();
+}
+
+TEST_CASE("SimdTest.rfloat16_matches_scalar") {
+    check_lanes_match_scalar<rfloat16>();
+}
+
+TEST_CASE("SimdTest.rdouble2_matches_scalar") {
+    check_lanes_match_scalar<rdouble2>();
+}
+
+TEST_CASE("SimdTest.rdouble8_matches_scalar") {
+    check_lanes_match_scalar<rdouble8>();
+}
+
+TEST_CASE("SimdTest.compound_assignment") {
+    rdouble4 a(2.0);
+    rdouble4 b(0.5);
+
+    a += b;
+    CHECK_EQ(a, rdouble4(2.5));
+    a -= b;
+    CHECK_EQ(a, rdouble4(2.0));
+    a *= b;
+    CHECK_EQ(a, rdouble4(1.0));
+    a /= b;
+    CHECK_EQ(a, rdouble4(2.0));
+}
+
+TEST_CASE("SimdTest.mixed_scalar_operands") {
+    rfloat4 v(3.0f);
+    rfloat s(2.0f);
+
+    CHECK_EQ(v + s, rfloat4(5.0f));
+    CHECK_EQ(s - v, rfloat4(-1.0f));
+    CHECK_EQ(2.0f * v, rfloat4(6.0f));
+    CHECK_EQ(v / 2.0f, rfloat4(1.5f));
+}
+
+TEST_CASE("SimdTest.load_store_roundtrip") {
+    std::array<rdouble, 4> input = {1.0, -2.5, 3.25, 1e300};
+    std::array<rdouble, 4> output{};
+
+    rdouble4 v = rdouble4::load(input.data());
+    v.store(output.data());
+    CHECK_EQ(input, output);
+
+    v.set(2, rdouble(7.0));
+    CHECK_EQ(v[2], 7.0);
+}
+
+TEST_CASE("SimdTest.reduce_add_is_sequential") {
+    std::array<rfloat, 8> input = {1e8f, 1.0f, -1e8f, 1.0f,
+                                   0.5f, 0.25f, 3.0f, -2.0f};
+    rfloat expected = 0.0f;
+    for (const auto &x : input) {
+        expected += x;
+    }
+    CHECK_EQ(rfloat8::load(input.data()).reduce_add(), expected);
+}
+
+// Running independent trajectories in separate lanes must give the same
+// bits as running each of them with the scalar type.
+TEST_CASE("SimdTest.LorenzLanesMatchScalar") {
+    using Vector = rdouble4;
+    using VectorArray3 = typename TestFunctions<Vector>::Array3;
+    using ScalarArray3 = typename TestFunctions<rdouble>::Array3;
+
+    std::array<ScalarArray3, 4> inputs = {{{0.0, 1.0, 0.0},
+                                           {1.0, 1.0, 1.0},
+                                           {-3.5, 2.25, 17.0},
+                                           {10.0, -10.0, 25.0}}};
+    VectorArray3 packed;
+    for (std::size_t c = 0; c < 3; ++c) {
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            packed[c].set(lane, inputs[lane][c]);
+        }
+    }
+
+    auto result = TestFunctions<Vector>::lorenz(packed, 1000);
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+        auto expected = TestFunctions<rdouble>::lorenz(inputs[lane], 1000);
+        for (std::size_t c = 0; c < 3; ++c) {
+            CHECK_EQ(result[c][lane], expected[c]);
+        }
+    }
+}
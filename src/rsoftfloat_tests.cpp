@@ -0,0 +1,409 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <rcmath>
+#include <rexpr>
+#include <rfloat>
+#include <rfma>
+#include <rlinalg>
+#include <rsoftfloat>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define HAVE_FLUSH_CONTROL 1
+#endif
+
+#if defined(_MSC_VER)
+#define NOINLINE __declspec(noinline)
+#else
+#define NOINLINE __attribute__((noinline))
+#endif
+
+// Turns flush-to-zero and denormals-are-zero on or off for its lifetime.
+// With them off, the hardware is an IEEE-754 reference for the software;
+// with them on, it's an FPU that needs the software to be reproducible.
+// -ffast-math turns them on at startup, so every test sets them.
+class FlushSubnormals {
+  public:
+    explicit FlushSubnormals(bool flush) {
+#if defined(HAVE_FLUSH_CONTROL)
+        saved = _mm_getcsr();
+        _mm_setcsr(flush ? saved | 0x8040 : saved & ~0x8040u);
+#else
+        (void)flush;
+#endif
+    }
+
+    ~FlushSubnormals() {
+#if defined(HAVE_FLUSH_CONTROL)
+        _mm_setcsr(saved);
+#endif
+    }
+
+  private:
+    unsigned saved = 0;
+};
+
+template <typename T> using fields = rstd::detail::float_fields<T>;
+
+template <typename T> static bool is_nan(T x) { return fields<T>(x).is_nan(); }
+
+// NaN payloads differ between targets, so any NaN matches any other
+template <typename T> static bool same(T a, T b) {
+    if (is_nan(a) || is_nan(b)) {
+        return is_nan(a) && is_nan(b);
+    }
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// The hardware operations, through volatiles so that nothing is folded or
+// vectorized, and out of line so that nothing moves across fesetround
+template <typename T> struct Hardware {
+    NOINLINE static T add(T a, T b) {
+        volatile T x = a, y = b;
+        volatile T result = x + y;
+        return result;
+    }
+    NOINLINE static T sub(T a, T b) {
+        volatile T x = a, y = b;
+        volatile T result = x - y;
+        return result;
+    }
+    NOINLINE static T mul(T a, T b) {
+        volatile T x = a, y = b;
+        volatile T result = x * y;
+        return result;
+    }
+    NOINLINE static T div(T a, T b) {
+        volatile T x = a, y = b;
+        volatile T result = x / y;
+        return result;
+    }
+    NOINLINE static T sqrt(T a) {
+        volatile T x = a;
+        volatile T result = std::sqrt(T(x));
+        return result;
+    }
+    NOINLINE static T fma(T a, T b, T c) {
+        volatile T x = a, y = b, z = c;
+        volatile T result = std::fma(T(x), T(y), T(z));
+        return result;
+    }
+};
+
+// Operands from every part of the range, weighted towards the ones that
+// produce subnormal, overflowing and cancelling results
+template <typename T> class random_operands {
+    using bits_type = typename fields<T>::bits_type;
+    static constexpr int mask = fields<T>::exponent_mask;
+    std::mt19937_64 gen;
+
+    T make(int biased_exponent) {
+        const bits_type fraction =
+            static_cast<bits_type>(gen()) & (fields<T>::implicit_bit - 1);
+        return fields<T>::make(gen() & 1, biased_exponent, fraction);
+    }
+
+  public:
+    explicit random_operands(unsigned seed) : gen(seed) {}
+
+    T operator()() {
+        const int near_one = mask / 2;
+        switch (gen() % 6) {
+        case 0: {
+            const bits_type bits = static_cast<bits_type>(gen());
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+        case 1:
+            return make(0);
+        case 2:
+            return make(1 + static_cast<int>(gen() % (fields<T>::precision + 2)));
+        case 3:
+        case 4:
+            return make(near_one - 8 + static_cast<int>(gen() % 16));
+        default:
+            return make(mask - 8 + static_cast<int>(gen() % 8));
+        }
+    }
+};
+
+template <typename T> static std::vector<T> special_values() {
+    using limits = std::numeric_limits<T>;
+    const std::vector<T> magnitudes = {fields<T>::zero(false),
+                                       fields<T>::infinity(false),
+                                       fields<T>::default_nan(),
+                                       limits::denorm_min(),
+                                       limits::min() - limits::denorm_min(),
+                                       limits::min(),
+                                       limits::max(),
+                                       T(1),
+                                       T(1) + limits::epsilon(),
+                                       T(3)};
+    std::vector<T> values;
+    for (T value : magnitudes) {
+        values.push_back(value);
+        values.push_back(rstd::detail::negate(value));
+    }
+    return values;
+}
+
+template <rmath::RoundingMode R, typename T>
+static void check_operations(T a, T b, T c) {
+    using namespace rstd;
+    bool ok = same(softfloat::add<R>(a, b), Hardware<T>::add(a, b));
+    ok = ok && same(softfloat::sub<R>(a, b), Hardware<T>::sub(a, b));
+    ok = ok && same(softfloat::mul<R>(a, b), Hardware<T>::mul(a, b));
+    ok = ok && same(softfloat::div<R>(a, b), Hardware<T>::div(a, b));
+    ok = ok && same(softfloat::sqrt<R>(a), Hardware<T>::sqrt(a));
+    ok = ok && same(softfloat::fma<R>(a, b, c), Hardware<T>::fma(a, b, c));
+    if (!ok) {
+        CAPTURE(a);
+        CAPTURE(b);
+        CAPTURE(c);
+        CHECK(same(softfloat::add<R>(a, b), Hardware<T>::add(a, b)));
+        CHECK(same(softfloat::sub<R>(a, b), Hardware<T>::sub(a, b)));
+        CHECK(same(softfloat::mul<R>(a, b), Hardware<T>::mul(a, b)));
+        CHECK(same(softfloat::div<R>(a, b), Hardware<T>::div(a, b)));
+        CHECK(same(softfloat::sqrt<R>(a), Hardware<T>::sqrt(a)));
+        CHECK(same(softfloat::fma<R>(a, b, c), Hardware<T>::fma(a, b, c)));
+    }
+}
+
+template <rmath::RoundingMode R, typename T>
+static void check_against_hardware(int mode) {
+    FlushSubnormals ieee(false);
+    std::fesetround(mode);
+    const std::vector<T> specials = special_values<T>();
+    for (T a : specials) {
+        for (T b : specials) {
+            for (T c : specials) {
+                check_operations<R>(a, b, c);
+            }
+        }
+    }
+    random_operands<T> random(42);
+    for (int i = 0; i < 100000; ++i) {
+        const T a = random(), b = random();
+        check_operations<R>(a, b, random());
+        // Operands this close cancel
+        check_operations<R>(a, rstd::detail::negate(Hardware<T>::mul(
+                                   a, T(1) + std::numeric_limits<T>::epsilon())),
+                            rstd::detail::negate(Hardware<T>::mul(a, b)));
+    }
+    std::fesetround(FE_TONEAREST);
+}
+
+TEST_CASE("SoftFloatTest.float_matches_hardware") {
+    check_against_hardware<rmath::RoundingMode::ToEven, float>(FE_TONEAREST);
+}
+
+TEST_CASE("SoftFloatTest.double_matches_hardware") {
+    check_against_hardware<rmath::RoundingMode::ToEven, double>(FE_TONEAREST);
+}
+
+TEST_CASE("SoftFloatTest.directed_rounding") {
+    check_against_hardware<rmath::RoundingMode::ToPositive, double>(FE_UPWARD);
+    check_against_hardware<rmath::RoundingMode::ToNegative, float>(
+        FE_DOWNWARD);
+    check_against_hardware<rmath::RoundingMode::ToZero, double>(
+        FE_TOWARDZERO);
+}
+
+template <typename T> static void check_comparisons() {
+    FlushSubnormals ieee(false);
+    std::vector<T> values = special_values<T>();
+    random_operands<T> random(7);
+    for (int i = 0; i < 200; ++i) {
+        values.push_back(random());
+    }
+    for (T a : values) {
+        for (T b : values) {
+            // -ffast-math folds comparisons with NaN, so those are known
+            // to be false rather than asked of the hardware
+            const bool ordered = !is_nan(a) && !is_nan(b);
+            volatile T x = a, y = b;
+            const bool ok =
+                rstd::softfloat::equal(a, b) == (ordered && x == y) &&
+                rstd::softfloat::less(a, b) == (ordered && x < y) &&
+                rstd::softfloat::less_equal(a, b) == (ordered && x <= y);
+            if (!ok) {
+                CAPTURE(a);
+                CAPTURE(b);
+                CHECK(ok);
+            }
+        }
+    }
+}
+
+TEST_CASE("SoftFloatTest.comparisons") {
+    check_comparisons<float>();
+    check_comparisons<double>();
+}
+
+TEST_CASE("SoftFloatTest.conversions") {
+    FlushSubnormals ieee(false);
+    random_operands<float> random_float(11);
+    random_operands<double> random_double(12);
+    for (int i = 0; i < 100000; ++i) {
+        volatile float f = random_float();
+        volatile double widened = f;
+        CHECK(same(rstd::softfloat::convert<double>(float(f)), double(widened)));
+        volatile double d = random_double();
+        volatile float narrowed = static_cast<float>(d);
+        CHECK(same(rstd::softfloat::convert<float>(double(d)), float(narrowed)));
+    }
+    // Every subnormal float widens exactly
+    for (std::uint32_t bits = 1; bits < 0x800000; bits += 97) {
+        const float f = fields<float>::make(false, 0, bits);
+        CHECK(rstd::softfloat::convert<double>(f) == std::ldexp(double(bits), -149));
+    }
+}
+
+// With subnormals flushed, the checked FPU operations still give the IEEE
+// result
+template <typename T> static void check_hybrid() {
+    random_operands<T> random(5);
+    std::vector<T> a(100000), b(a.size()), c(a.size()), expected(6 * a.size());
+    {
+        FlushSubnormals ieee(false);
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            a[i] = random();
+            b[i] = random();
+            c[i] = random();
+            expected[6 * i] = Hardware<T>::add(a[i], b[i]);
+            expected[6 * i + 1] = Hardware<T>::sub(a[i], b[i]);
+            expected[6 * i + 2] = Hardware<T>::mul(a[i], b[i]);
+            expected[6 * i + 3] = Hardware<T>::div(a[i], b[i]);
+            expected[6 * i + 4] = Hardware<T>::sqrt(a[i]);
+            expected[6 * i + 5] = Hardware<T>::fma(a[i], b[i], c[i]);
+        }
+    }
+
+    FlushSubnormals flush(true);
+#if defined(HAVE_FLUSH_CONTROL)
+    // The hardware alone gets subnormals wrong now
+    volatile T smallest = std::numeric_limits<T>::min();
+    volatile T half = smallest / 2;
+    CHECK(half == 0);
+#endif
+    namespace hybrid = rstd::softfloat::hybrid;
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        mismatches += !same(hybrid::add(a[i], b[i]), expected[6 * i]);
+        mismatches += !same(hybrid::sub(a[i], b[i]), expected[6 * i + 1]);
+        mismatches += !same(hybrid::mul(a[i], b[i]), expected[6 * i + 2]);
+        mismatches += !same(hybrid::div(a[i], b[i]), expected[6 * i + 3]);
+        mismatches += !same(hybrid::sqrt(a[i]), expected[6 * i + 4]);
+        mismatches +=
+            !same(hybrid::fma(a[i], b[i], c[i]), expected[6 * i + 5]);
+    }
+    CHECK(mismatches == 0);
+}
+
+TEST_CASE("SoftFloatTest.hybrid_handles_flushed_subnormals") {
+    check_hybrid<float>();
+    check_hybrid<double>();
+}
+
+#if defined(RSTD_SOFT_ARITHMETIC)
+// The wrappers go through the software backend, so they keep subnormals
+// even on an FPU that flushes them
+TEST_CASE("SoftFloatTest.wrappers_use_the_backend") {
+    FlushSubnormals flush(true);
+    const float tiny = std::numeric_limits<float>::denorm_min();
+    const double tiny_double = std::numeric_limits<double>::denorm_min();
+
+    CHECK(same((rfloat(tiny) + rfloat(tiny)).underlying_value(),
+               fields<float>::make(false, 0, 2)));
+    CHECK(same((rfloat(std::numeric_limits<float>::min()) * rfloat(0.5f))
+                   .underlying_value(),
+               fields<float>::make(false, 0, 0x400000)));
+    CHECK(same((rdouble(tiny_double * 0) + rdouble(0.0)).underlying_value(),
+               0.0));
+    rdouble x = std::numeric_limits<double>::min();
+    x /= 4.0;
+    CHECK(same(x.underlying_value(), fields<double>::make(false, 0, 1ull << 50)));
+    x -= rdouble(x.underlying_value());
+    CHECK(same(x.underlying_value(), 0.0));
+
+    CHECK(rfloat(tiny) > rfloat(0.0f));
+    CHECK(rfloat(-tiny) < rfloat(0.0f));
+    CHECK(rfloat(tiny) != rfloat(0.0f));
+    CHECK(rfloat(0.0f) == rfloat(fields<float>::zero(true)));
+    CHECK(rfloat(tiny).fp64() == std::ldexp(1.0, -149));
+    CHECK(static_cast<rdouble>(rfloat(tiny)).underlying_value() ==
+          std::ldexp(1.0, -149));
+
+    CHECK(same(rstd::sqrt(rdouble(tiny_double)).underlying_value(),
+               std::ldexp(1.0, -537)));
+    CHECK(same(rstd::fma(rfloat(tiny), rfloat(2.0f), rfloat(tiny))
+                   .underlying_value(),
+               fields<float>::make(false, 0, 3)));
+    rfloat_fma product = rfloat_fma(tiny) * rfloat_fma(4.0f) + rfloat_fma(0.0f);
+    CHECK(same(product.underlying_value(), fields<float>::make(false, 0, 4)));
+}
+
+// So do the headers built on top of them
+TEST_CASE("SoftFloatTest.other_headers_use_the_backend") {
+    FlushSubnormals flush(true);
+    // Read through volatile so that nothing is folded at compile time,
+    // where subnormals are never flushed
+    volatile float tiny_input = std::numeric_limits<float>::denorm_min();
+    volatile double tiny_double_input =
+        std::numeric_limits<double>::denorm_min();
+    const float tiny = tiny_input;
+    const double tiny_double = tiny_double_input;
+
+    const rfloat_fma a = tiny;
+    CHECK(same((a + a).underlying_value(), fields<float>::make(false, 0, 2)));
+    CHECK(same((a - rfloat_fma(-tiny)).underlying_value(),
+               fields<float>::make(false, 0, 2)));
+    CHECK(same(((a + a + a) / rfloat_fma(3.0f)).underlying_value(), tiny));
+    const rfloat_fma rounded = a * rfloat_fma(3.0f);
+    CHECK(same(rounded.underlying_value(), fields<float>::make(false, 0, 3)));
+    CHECK(a > rfloat_fma(0.0f));
+    CHECK(a != rfloat_fma(0.0f));
+
+    const rdouble x = tiny_double;
+    const rdouble sum = rstd::lazy(x) * 2.0 + x - x / 1.0;
+    CHECK(same(sum.underlying_value(), fields<double>::make(false, 0, 2)));
+
+    // Large enough for the vector paths of update_product and of the
+    // elimination in lu_factor
+    constexpr std::size_t n = 32;
+    std::vector<rdouble> lhs(n * n, rdouble(tiny_double));
+    std::vector<rdouble> rhs(n * n, rdouble(1.0));
+    std::vector<rdouble> c(n * n);
+    rstd::linalg::multiply(n, n, n, lhs.data(), n, rhs.data(), n, c.data(), n);
+    for (const rdouble &element : c) {
+        CHECK(same(element.underlying_value(),
+                   fields<double>::make(false, 0, n)));
+    }
+
+    // The first elimination step leaves row 1 at -j * tiny for j > 1, and
+    // the later ones only subtract products that underflow to zero
+    std::vector<rdouble> lu(n * n, rdouble(0.0));
+    lu[0] = 2.0;
+    for (std::size_t j = 1; j < n; ++j) {
+        lu[j] = fields<double>::make(false, 0, 2 * j);
+        lu[j * n] = 1.0;
+        lu[j * n + j] = 1.0;
+    }
+    std::vector<std::size_t> pivots(n);
+    CHECK(rstd::linalg::lu_factor(n, lu.data(), n, pivots.data()) == 0);
+    for (std::size_t j = 2; j < n; ++j) {
+        CHECK(same(lu[n + j].underlying_value(),
+                   fields<double>::make(true, 0, j)));
+    }
+}
+#endif /* RSTD_SOFT_ARITHMETIC */
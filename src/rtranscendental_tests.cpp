@@ -0,0 +1,623 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <rcmath>
+#include <rfloat>
+#include <rtranscendental>
+
+using rmath::RoundingMode;
+
+template <typename T> static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// std::isnan and friends may be folded away under -ffast-math, so special
+// values are checked through their bit patterns instead
+template <typename T> static bool is_nan(T x) {
+    rstd::detail::float_fields<T> fields(x);
+    return !fields.is_finite() &&
+           (fields.significand &
+            ((std::uint64_t(1) << (std::numeric_limits<T>::digits - 1)) -
+             1)) != 0;
+}
+
+// -0.0 may be folded to +0.0 under -ffast-math, so it's kept opaque
+static double negative_zero() {
+    volatile std::uint64_t sign = std::uint64_t(1) << 63;
+    const std::uint64_t bits = sign;
+    double x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+template <typename T> static T infinity() {
+    return std::numeric_limits<T>::infinity();
+}
+
+template <typename T, RoundingMode R>
+static T evaluate(const std::string &function, T x, T y) {
+    namespace crmath = rstd::detail::crmath;
+    if (function == "exp") {
+        return crmath::exp<T, R>(x);
+    } else if (function == "exp2") {
+        return crmath::exp2<T, R>(x);
+    } else if (function == "expm1") {
+        return crmath::expm1<T, R>(x);
+    } else if (function == "log") {
+        return crmath::log<T, R>(x);
+    } else if (function == "log2") {
+        return crmath::log2<T, R>(x);
+    } else if (function == "log10") {
+        return crmath::log10<T, R>(x);
+    } else if (function == "log1p") {
+        return crmath::log1p<T, R>(x);
+    } else if (function == "sin") {
+        return crmath::sin<T, R>(x);
+    } else if (function == "cos") {
+        return crmath::cos<T, R>(x);
+    } else if (function == "tan") {
+        return crmath::tan<T, R>(x);
+    } else if (function == "atan") {
+        return crmath::atan<T, R>(x);
+    } else if (function == "atan2") {
+        return crmath::atan2<T, R>(x, y);
+    }
+    return crmath::pow<T, R>(x, y);
+}
+
+// Correctly rounded results in each mode, computed with at least 140
+// significant digits. Includes inputs that are too close to a rounding
+// boundary for the double-double approximations, and exact results.
+template <typename T> struct Reference {
+    const char *function;
+    T x;
+    T y;
+    // ToEven, ToZero, ToPositive, ToNegative
+    T expected[4];
+};
+
+// clang-format off
+static const Reference<double> double_references[] = {
+    {"exp", 0x1.3a67f3dbbdc14p+8, 0x0p+0, {0x1.81e585b64636ep+453, 0x1.81e585b64636ep+453, 0x1.81e585b64636fp+453, 0x1.81e585b64636ep+453}},
+    {"exp", 0x1.10e05b7c465a6p+9, 0x0p+0, {0x1.4762ad9b6389bp+787, 0x1.4762ad9b6389bp+787, 0x1.4762ad9b6389cp+787, 0x1.4762ad9b6389bp+787}},
+    {"exp", 0x1.29757e4b42568p+8, 0x0p+0, {0x1.1a96e9b6078fdp+429, 0x1.1a96e9b6078fdp+429, 0x1.1a96e9b6078fep+429, 0x1.1a96e9b6078fdp+429}},
+    {"exp", -0x1.845b27c233107p+8, 0x0p+0, {0x1.a5dbd0e8fb482p-561, 0x1.a5dbd0e8fb481p-561, 0x1.a5dbd0e8fb482p-561, 0x1.a5dbd0e8fb481p-561}},
+    {"exp", -0x1.bd4852aa7bp-43, 0x0p+0, {0x1.ffffffffff90bp-1, 0x1.ffffffffff90ap-1, 0x1.ffffffffff90bp-1, 0x1.ffffffffff90ap-1}},
+    {"exp", 0x1.d9b533ed2f0e8p-3, 0x0p+0, {0x1.429f209cd9eefp+0, 0x1.429f209cd9eeep+0, 0x1.429f209cd9eefp+0, 0x1.429f209cd9eeep+0}},
+    {"exp", 0x1.70e5c732b21ep+5, 0x0p+0, {0x1.7094ad59fc1c7p+66, 0x1.7094ad59fc1c7p+66, 0x1.7094ad59fc1c8p+66, 0x1.7094ad59fc1c7p+66}},
+    {"exp", -0x1.3e2fef170172bp+9, 0x0p+0, {0x1.df9999fc3797ap-919, 0x1.df9999fc37979p-919, 0x1.df9999fc3797ap-919, 0x1.df9999fc37979p-919}},
+    {"exp", 0x1.77e9fe9a6ab84p-1, 0x0p+0, {0x1.0abae967b3adfp+1, 0x1.0abae967b3adfp+1, 0x1.0abae967b3aep+1, 0x1.0abae967b3adfp+1}},
+    {"exp", 0x1.d24e0c77f1cacp-2, 0x0p+0, {0x1.93a6ee42e6b7cp+0, 0x1.93a6ee42e6b7cp+0, 0x1.93a6ee42e6b7dp+0, 0x1.93a6ee42e6b7cp+0}},
+    {"exp", -0x1.89e40740da914p+4, 0x0p+0, {0x1.65eb1acb0609ep-36, 0x1.65eb1acb0609dp-36, 0x1.65eb1acb0609ep-36, 0x1.65eb1acb0609dp-36}},
+    {"exp", -0x1.2191b44426b85p+4, 0x0p+0, {0x1.da69d21a1e8ecp-27, 0x1.da69d21a1e8ecp-27, 0x1.da69d21a1e8edp-27, 0x1.da69d21a1e8ecp-27}},
+    {"exp2", -0x1.0250740c83619p+10, 0x0p+0, {0x0.001ac6e2cac55p-1022, 0x0.001ac6e2cac55p-1022, 0x0.001ac6e2cac56p-1022, 0x0.001ac6e2cac55p-1022}},
+    {"exp2", 0x1.6036b540b8d26p-41, 0x0p+0, {0x1.00000000007a1p+0, 0x1.00000000007a1p+0, 0x1.00000000007a2p+0, 0x1.00000000007a1p+0}},
+    {"exp2", 0x1.1f68f99bd7dfp-18, 0x0p+0, {0x1.000031cdefe76p+0, 0x1.000031cdefe76p+0, 0x1.000031cdefe77p+0, 0x1.000031cdefe76p+0}},
+    {"exp2", -0x1.a37b2fcaba0d3p+9, 0x0p+0, {0x1.06c2a8fb11a1dp-839, 0x1.06c2a8fb11a1dp-839, 0x1.06c2a8fb11a1ep-839, 0x1.06c2a8fb11a1dp-839}},
+    {"exp2", 0x1.b509fb8f8c9a8p-49, 0x0p+0, {0x1.0000000000009p+0, 0x1.0000000000009p+0, 0x1.000000000000ap+0, 0x1.0000000000009p+0}},
+    {"exp2", -0x1.9014c2133ce98p+6, 0x0p+0, {0x1.f8db2921fb631p-101, 0x1.f8db2921fb63p-101, 0x1.f8db2921fb631p-101, 0x1.f8db2921fb63p-101}},
+    {"exp2", -0x1.2c5694cc6095ep+8, 0x0p+0, {0x1.9501001696129p-301, 0x1.9501001696128p-301, 0x1.9501001696129p-301, 0x1.9501001696128p-301}},
+    {"exp2", 0x1.e75fd7fa5bf8p+7, 0x0p+0, {0x1.9c32c22179cf7p+243, 0x1.9c32c22179cf6p+243, 0x1.9c32c22179cf7p+243, 0x1.9c32c22179cf6p+243}},
+    {"exp2", 0x1.d4aefcb96f2d8p+7, 0x0p+0, {0x1.446e91326172dp+234, 0x1.446e91326172dp+234, 0x1.446e91326172ep+234, 0x1.446e91326172dp+234}},
+    {"exp2", 0x1.9c6b931557f3cp+8, 0x0p+0, {0x1.568f5edc59ef1p+412, 0x1.568f5edc59ef1p+412, 0x1.568f5edc59ef2p+412, 0x1.568f5edc59ef1p+412}},
+    {"exp2", 0x1.93a26e7d268eap+4, 0x0p+0, {0x1.2ba78c418b543p+25, 0x1.2ba78c418b542p+25, 0x1.2ba78c418b543p+25, 0x1.2ba78c418b542p+25}},
+    {"exp2", 0x1.39e2c8be5f1dp+2, 0x0p+0, {0x1.df31bacbca00ap+4, 0x1.df31bacbca00ap+4, 0x1.df31bacbca00bp+4, 0x1.df31bacbca00ap+4}},
+    {"exp2", -0x1.8p+1, 0x0p+0, {0x1p-3, 0x1p-3, 0x1p-3, 0x1p-3}},
+    {"expm1", -0x1.323de39421772p-57, 0x0p+0, {-0x1.323de39421772p-57, -0x1.323de39421771p-57, -0x1.323de39421771p-57, -0x1.323de39421772p-57}},
+    {"expm1", -0x1.53f993d02cc98p+8, 0x0p+0, {-0x1p+0, -0x1.fffffffffffffp-1, -0x1.fffffffffffffp-1, -0x1p+0}},
+    {"expm1", 0x1.d9b9924001c9cp-2, 0x0p+0, {0x1.2d2cd9fa8ef36p-1, 0x1.2d2cd9fa8ef35p-1, 0x1.2d2cd9fa8ef36p-1, 0x1.2d2cd9fa8ef35p-1}},
+    {"expm1", -0x1.394ef900857p-7, 0x0p+0, {-0x1.37d0bee779528p-7, -0x1.37d0bee779528p-7, -0x1.37d0bee779528p-7, -0x1.37d0bee779529p-7}},
+    {"expm1", 0x1.23240131bd9c4p-50, 0x0p+0, {0x1.23240131bd9c7p-50, 0x1.23240131bd9c6p-50, 0x1.23240131bd9c7p-50, 0x1.23240131bd9c6p-50}},
+    {"expm1", -0x1.1b67ca570bef6p-1, 0x0p+0, {-0x1.b34873761b0e4p-2, -0x1.b34873761b0e4p-2, -0x1.b34873761b0e4p-2, -0x1.b34873761b0e5p-2}},
+    {"expm1", 0x1.14fe280d7451ep+8, 0x0p+0, {0x1.8863519cadb7bp+399, 0x1.8863519cadb7ap+399, 0x1.8863519cadb7bp+399, 0x1.8863519cadb7ap+399}},
+    {"expm1", 0x1.430145cd4567p-3, 0x0p+0, {0x1.5ddecd8ad3759p-3, 0x1.5ddecd8ad3759p-3, 0x1.5ddecd8ad375ap-3, 0x1.5ddecd8ad3759p-3}},
+    {"expm1", 0x1.69c139820107p-5, 0x0p+0, {0x1.71dc72c3133ebp-5, 0x1.71dc72c3133eap-5, 0x1.71dc72c3133ebp-5, 0x1.71dc72c3133eap-5}},
+    {"expm1", 0x1.cd6c56d11422ep-1, 0x0p+0, {0x1.766cded39048ep+0, 0x1.766cded39048dp+0, 0x1.766cded39048ep+0, 0x1.766cded39048dp+0}},
+    {"expm1", -0x1.4f9f86d15a7d5p+4, 0x0p+0, {-0x1.fffffff954d69p-1, -0x1.fffffff954d69p-1, -0x1.fffffff954d69p-1, -0x1.fffffff954d6ap-1}},
+    {"expm1", -0x1.3667b776d84fp+1, 0x0p+0, {-0x1.d2b376428c894p-1, -0x1.d2b376428c894p-1, -0x1.d2b376428c894p-1, -0x1.d2b376428c895p-1}},
+    {"log", 0x1.680221f740bp-448, 0x0p+0, {-0x1.3630617674e57p+8, -0x1.3630617674e57p+8, -0x1.3630617674e57p+8, -0x1.3630617674e58p+8}},
+    {"log", 0x1.944fb0fbd4948p-811, 0x0p+0, {-0x1.18d7b9bcde6e5p+9, -0x1.18d7b9bcde6e5p+9, -0x1.18d7b9bcde6e5p+9, -0x1.18d7b9bcde6e6p+9}},
+    {"log", 0x1.6ff5ddb0534dap+0, 0x0p+0, {0x1.73814c145e6ep-2, 0x1.73814c145e6dfp-2, 0x1.73814c145e6ep-2, 0x1.73814c145e6dfp-2}},
+    {"log", 0x1.a169c557997dep-1, 0x0p+0, {-0x1.a24cd1da93fbcp-3, -0x1.a24cd1da93fbcp-3, -0x1.a24cd1da93fbcp-3, -0x1.a24cd1da93fbdp-3}},
+    {"log", 0x1.13e4d30aa1af2p-79, 0x0p+0, {-0x1.b578661fb12d4p+5, -0x1.b578661fb12d4p+5, -0x1.b578661fb12d4p+5, -0x1.b578661fb12d5p+5}},
+    {"log", 0x1.80f58504c2d68p-465, 0x0p+0, {-0x1.41e7cd7fab32fp+8, -0x1.41e7cd7fab32ep+8, -0x1.41e7cd7fab32ep+8, -0x1.41e7cd7fab32fp+8}},
+    {"log", 0x1.7392455513e7cp+0, 0x0p+0, {0x1.7d814a49dcb2ep-2, 0x1.7d814a49dcb2dp-2, 0x1.7d814a49dcb2ep-2, 0x1.7d814a49dcb2dp-2}},
+    {"log", 0x1.b56f52d78d73bp+0, 0x0p+0, {0x1.124dded0eea69p-1, 0x1.124dded0eea68p-1, 0x1.124dded0eea69p-1, 0x1.124dded0eea68p-1}},
+    {"log", 0x1.fe9929619bcf3p+751, 0x0p+0, {0x1.049f395ed6084p+9, 0x1.049f395ed6084p+9, 0x1.049f395ed6085p+9, 0x1.049f395ed6084p+9}},
+    {"log", 0x1.4be056b1db777p+194, 0x0p+0, {0x1.0d75d4a499fc6p+7, 0x1.0d75d4a499fc6p+7, 0x1.0d75d4a499fc7p+7, 0x1.0d75d4a499fc6p+7}},
+    {"log", 0x1.0d34f1bfa9628p+5, 0x0p+0, {0x1.c20d8b92f2123p+1, 0x1.c20d8b92f2122p+1, 0x1.c20d8b92f2123p+1, 0x1.c20d8b92f2122p+1}},
+    {"log", 0x1.a59ca8f9b93fdp+2, 0x0p+0, {0x1.e29c9d9e213aap+0, 0x1.e29c9d9e213a9p+0, 0x1.e29c9d9e213aap+0, 0x1.e29c9d9e213a9p+0}},
+    {"log2", 0x1.175b002ba029dp+21, 0x0p+0, {0x1.5203ecd0af096p+4, 0x1.5203ecd0af096p+4, 0x1.5203ecd0af097p+4, 0x1.5203ecd0af096p+4}},
+    {"log2", 0x1.3bf5df9224e96p+820, 0x0p+0, {0x1.9a26dc5e8c6fbp+9, 0x1.9a26dc5e8c6fbp+9, 0x1.9a26dc5e8c6fcp+9, 0x1.9a26dc5e8c6fbp+9}},
+    {"log2", 0x1.c45c753ff21acp-1, 0x0p+0, {-0x1.6de9df6f2cefcp-3, -0x1.6de9df6f2cefbp-3, -0x1.6de9df6f2cefbp-3, -0x1.6de9df6f2cefcp-3}},
+    {"log2", 0x1.ace012fa07787p-1, 0x0p+0, {-0x1.05b83c4da6b15p-2, -0x1.05b83c4da6b14p-2, -0x1.05b83c4da6b14p-2, -0x1.05b83c4da6b15p-2}},
+    {"log2", 0x1.bd61ef362e4ccp+0, 0x0p+0, {0x1.99099580128f1p-1, 0x1.99099580128f1p-1, 0x1.99099580128f2p-1, 0x1.99099580128f1p-1}},
+    {"log2", 0x1.33d9655be1c1ep-1, 0x0p+0, {-0x1.77c45bf91c57ep-1, -0x1.77c45bf91c57dp-1, -0x1.77c45bf91c57dp-1, -0x1.77c45bf91c57ep-1}},
+    {"log2", 0x1.865d54a26d724p-1, 0x0p+0, {-0x1.90b6a190a5439p-2, -0x1.90b6a190a5439p-2, -0x1.90b6a190a5439p-2, -0x1.90b6a190a543ap-2}},
+    {"log2", 0x1.ec1e58baef8d2p-1, 0x0p+0, {-0x1.d412f030878bp-5, -0x1.d412f030878bp-5, -0x1.d412f030878bp-5, -0x1.d412f030878b1p-5}},
+    {"log2", 0x1.3e1590e7bf36dp+0, 0x0p+0, {0x1.40c8908b1cf54p-2, 0x1.40c8908b1cf53p-2, 0x1.40c8908b1cf54p-2, 0x1.40c8908b1cf53p-2}},
+    {"log2", 0x1.b01b1775d730ep+873, 0x0p+0, {0x1.b4e0abbba5041p+9, 0x1.b4e0abbba5041p+9, 0x1.b4e0abbba5042p+9, 0x1.b4e0abbba5041p+9}},
+    {"log2", 0x1.9ea2437538706p+3, 0x0p+0, {0x1.d90c80c59e25fp+1, 0x1.d90c80c59e25ep+1, 0x1.d90c80c59e25fp+1, 0x1.d90c80c59e25ep+1}},
+    {"log2", 0x1.80a130123aacp+5, 0x0p+0, {0x1.6596c057c8cf7p+2, 0x1.6596c057c8cf7p+2, 0x1.6596c057c8cf8p+2, 0x1.6596c057c8cf7p+2}},
+    {"log2", 0x1p-3, 0x0p+0, {-0x1.8p+1, -0x1.8p+1, -0x1.8p+1, -0x1.8p+1}},
+    {"log10", 0x1.9e5e8365d1804p+143, 0x0p+0, {0x1.5a0d2ec68e27p+5, 0x1.5a0d2ec68e27p+5, 0x1.5a0d2ec68e271p+5, 0x1.5a0d2ec68e27p+5}},
+    {"log10", 0x1.525086e6f0bfp-813, 0x0p+0, {-0x1.e93b8c6d7d313p+7, -0x1.e93b8c6d7d312p+7, -0x1.e93b8c6d7d312p+7, -0x1.e93b8c6d7d313p+7}},
+    {"log10", 0x1.8f0bc6b18507cp+0, 0x0p+0, {0x1.8ad1cfdfd378bp-3, 0x1.8ad1cfdfd378ap-3, 0x1.8ad1cfdfd378bp-3, 0x1.8ad1cfdfd378ap-3}},
+    {"log10", 0x1.699068f11ad6fp-697, 0x0p+0, {-0x1.a355ff1165a81p+7, -0x1.a355ff1165a81p+7, -0x1.a355ff1165a81p+7, -0x1.a355ff1165a82p+7}},
+    {"log10", 0x1.e8bf955000ac5p+0, 0x0p+0, {0x1.1f95ecf8c7713p-2, 0x1.1f95ecf8c7713p-2, 0x1.1f95ecf8c7714p-2, 0x1.1f95ecf8c7713p-2}},
+    {"log10", 0x1.d25f232e5bddap-250, 0x0p+0, {-0x1.2bfcef56db8d7p+6, -0x1.2bfcef56db8d7p+6, -0x1.2bfcef56db8d7p+6, -0x1.2bfcef56db8d8p+6}},
+    {"log10", 0x1.c0c8d682df1e7p-111, 0x0p+0, {-0x1.095d3fad9924p+5, -0x1.095d3fad9924p+5, -0x1.095d3fad9924p+5, -0x1.095d3fad99241p+5}},
+    {"log10", 0x1.20dba2c3c97e6p+676, 0x0p+0, {0x1.9718f203f8b15p+7, 0x1.9718f203f8b15p+7, 0x1.9718f203f8b16p+7, 0x1.9718f203f8b15p+7}},
+    {"log10", 0x1.bdee2034fe42ep-1, 0x0p+0, {-0x1.eb8b9cf46d731p-5, -0x1.eb8b9cf46d73p-5, -0x1.eb8b9cf46d73p-5, -0x1.eb8b9cf46d731p-5}},
+    {"log10", 0x1.e020c9d64ba09p-1, 0x0p+0, {-0x1.c952ffd873b01p-6, -0x1.c952ffd873b01p-6, -0x1.c952ffd873b01p-6, -0x1.c952ffd873b02p-6}},
+    {"log10", 0x1.ddb678125a795p+4, 0x0p+0, {0x1.799cabe960786p+0, 0x1.799cabe960786p+0, 0x1.799cabe960787p+0, 0x1.799cabe960786p+0}},
+    {"log10", 0x1.a7e62e830e928p+2, 0x0p+0, {0x1.a464ef396178bp-1, 0x1.a464ef396178bp-1, 0x1.a464ef396178cp-1, 0x1.a464ef396178bp-1}},
+    {"log10", 0x1.f4p+9, 0x0p+0, {0x1.8p+1, 0x1.8p+1, 0x1.8p+1, 0x1.8p+1}},
+    {"log1p", -0x1.c8e5585fb7788p-37, 0x0p+0, {-0x1.c8e5585fc4364p-37, -0x1.c8e5585fc4364p-37, -0x1.c8e5585fc4364p-37, -0x1.c8e5585fc4365p-37}},
+    {"log1p", 0x1.5602b35a19d1ap-485, 0x0p+0, {0x1.5602b35a19d1ap-485, 0x1.5602b35a19d19p-485, 0x1.5602b35a19d1ap-485, 0x1.5602b35a19d19p-485}},
+    {"log1p", -0x1.762a89ac7e584p-41, 0x0p+0, {-0x1.762a89ac7ee1p-41, -0x1.762a89ac7ee0fp-41, -0x1.762a89ac7ee0fp-41, -0x1.762a89ac7ee1p-41}},
+    {"log1p", 0x1.b0703a00db17cp+0, 0x0p+0, {0x1.fa7ec36f54703p-1, 0x1.fa7ec36f54703p-1, 0x1.fa7ec36f54704p-1, 0x1.fa7ec36f54703p-1}},
+    {"log1p", 0x1.bd2b5c3a220ecp-833, 0x0p+0, {0x1.bd2b5c3a220ecp-833, 0x1.bd2b5c3a220ebp-833, 0x1.bd2b5c3a220ecp-833, 0x1.bd2b5c3a220ebp-833}},
+    {"log1p", -0x1.2a90e991f449p-47, 0x0p+0, {-0x1.2a90e991f44a6p-47, -0x1.2a90e991f44a5p-47, -0x1.2a90e991f44a5p-47, -0x1.2a90e991f44a6p-47}},
+    {"log1p", 0x1.1ea56cf97ac32p+1, 0x0p+0, {0x1.2ce6b5a4b8a15p+0, 0x1.2ce6b5a4b8a14p+0, 0x1.2ce6b5a4b8a15p+0, 0x1.2ce6b5a4b8a14p+0}},
+    {"log1p", 0x1.a3377262ab34p-2, 0x0p+0, {0x1.5f64c4b3faf77p-2, 0x1.5f64c4b3faf76p-2, 0x1.5f64c4b3faf77p-2, 0x1.5f64c4b3faf76p-2}},
+    {"log1p", 0x1.ba4c8d28e3e74p+1, 0x0p+0, {0x1.7e7f57548bbdp+0, 0x1.7e7f57548bbcfp+0, 0x1.7e7f57548bbdp+0, 0x1.7e7f57548bbcfp+0}},
+    {"log1p", 0x1.14462ceb1c919p-276, 0x0p+0, {0x1.14462ceb1c919p-276, 0x1.14462ceb1c918p-276, 0x1.14462ceb1c919p-276, 0x1.14462ceb1c918p-276}},
+    {"log1p", 0x1.a294e425d527ep+0, 0x0p+0, {0x1.f015a7951c48bp-1, 0x1.f015a7951c48bp-1, 0x1.f015a7951c48cp-1, 0x1.f015a7951c48bp-1}},
+    {"log1p", 0x1.7e3cc1375c4fcp+0, 0x0p+0, {0x1.d3ba9087a2abbp-1, 0x1.d3ba9087a2abbp-1, 0x1.d3ba9087a2abcp-1, 0x1.d3ba9087a2abbp-1}},
+    {"log1p", 0x1.90ac9bdb0bfcp-8, 0x0p+0, {0x1.8f74539a9aad7p-8, 0x1.8f74539a9aad7p-8, 0x1.8f74539a9aad8p-8, 0x1.8f74539a9aad7p-8}},
+    {"log1p", 0x1.f6d209ce7757bp-8, 0x0p+0, {0x1.f4e6be80b4eebp-8, 0x1.f4e6be80b4eeap-8, 0x1.f4e6be80b4eebp-8, 0x1.f4e6be80b4eeap-8}},
+    {"log1p", 0x1.a6491836e7302p-10, 0x0p+0, {0x1.a5f21d7daf058p-10, 0x1.a5f21d7daf058p-10, 0x1.a5f21d7daf059p-10, 0x1.a5f21d7daf058p-10}},
+    {"pow", 0x1.ecf056647535cp+0, -0x1.62b3d016284fp+2, {0x1.b1df8ff1f32b7p-6, 0x1.b1df8ff1f32b6p-6, 0x1.b1df8ff1f32b7p-6, 0x1.b1df8ff1f32b6p-6}},
+    {"pow", 0x1.27a8f579ef8cap+2, -0x1.3fcff860b0067p+6, {0x1.6509d0efb5ca6p-177, 0x1.6509d0efb5ca6p-177, 0x1.6509d0efb5ca7p-177, 0x1.6509d0efb5ca6p-177}},
+    {"pow", 0x1.dfcccdded34fap+2, 0x1.c4f2fd53da9b8p+5, {0x1.76d9e700e687dp+164, 0x1.76d9e700e687cp+164, 0x1.76d9e700e687dp+164, 0x1.76d9e700e687cp+164}},
+    {"pow", 0x1.076c5e13d3925p+0, -0x1.9ffd4120e9cbap+10, {0x1.4d14cb4b305d7p-69, 0x1.4d14cb4b305d7p-69, 0x1.4d14cb4b305d8p-69, 0x1.4d14cb4b305d7p-69}},
+    {"pow", 0x1.dda1655094f5ap-1, 0x1.c1bed18577ebcp+9, {0x1.c62122579dadp-91, 0x1.c62122579dadp-91, 0x1.c62122579dad1p-91, 0x1.c62122579dadp-91}},
+    {"pow", 0x1.bc5b612a667c9p+2, 0x1.ecd12bad1081cp+5, {0x1.28cfa41fb55fap+172, 0x1.28cfa41fb55fap+172, 0x1.28cfa41fb55fbp+172, 0x1.28cfa41fb55fap+172}},
+    {"pow", 0x1.1861b01a6feccp+0, -0x1.e46b19ae5cc4ap+9, {0x1.cafa5feea4139p-128, 0x1.cafa5feea4139p-128, 0x1.cafa5feea413ap-128, 0x1.cafa5feea4139p-128}},
+    {"pow", 0x1.c08f06eaaf9bap+2, 0x1.2cd2fbf2d068p+3, {0x1.53b5afd968781p+26, 0x1.53b5afd968781p+26, 0x1.53b5afd968782p+26, 0x1.53b5afd968781p+26}},
+    {"pow", -0x1.33248d2fcb84fp+4, -0x1.4p+2, {-0x1.9be7f6cdd69e7p-22, -0x1.9be7f6cdd69e7p-22, -0x1.9be7f6cdd69e7p-22, -0x1.9be7f6cdd69e8p-22}},
+    {"pow", 0x1.6c6110e563074p+2, -0x1.0734695967b53p+6, {0x1.d8dfaee0e6115p-166, 0x1.d8dfaee0e6114p-166, 0x1.d8dfaee0e6115p-166, 0x1.d8dfaee0e6114p-166}},
+    {"pow", 0x1.101f6631db6f6p+5, 0x1.2e3d5cf8098p+2, {0x1.051fbafef7112p+24, 0x1.051fbafef7111p+24, 0x1.051fbafef7112p+24, 0x1.051fbafef7111p+24}},
+    {"pow", 0x1.3c393b4115e2bp+3, -0x1.d75402d581449p+4, {0x1.90e90dc873c15p-98, 0x1.90e90dc873c15p-98, 0x1.90e90dc873c16p-98, 0x1.90e90dc873c15p-98}},
+    {"pow", 0x1.8p+1, 0x1.4p+2, {0x1.e6p+7, 0x1.e6p+7, 0x1.e6p+7, 0x1.e6p+7}},
+    {"pow", 0x1p-1, -0x1.8p+1, {0x1p+3, 0x1p+3, 0x1p+3, 0x1p+3}},
+    {"pow", 0x1p+1, 0x1p-1, {0x1.6a09e667f3bcdp+0, 0x1.6a09e667f3bccp+0, 0x1.6a09e667f3bcdp+0, 0x1.6a09e667f3bccp+0}},
+    {"pow", 0x1.4p+3, -0x1p+1, {0x1.47ae147ae147bp-7, 0x1.47ae147ae147ap-7, 0x1.47ae147ae147bp-7, 0x1.47ae147ae147ap-7}},
+    {"sin", -0x1.1f9ac042bafep-21, 0x0p+0, {-0x1.1f9ac042baeeep-21, -0x1.1f9ac042baeedp-21, -0x1.1f9ac042baeedp-21, -0x1.1f9ac042baeeep-21}},
+    {"sin", 0x1.cf6c6aa1e7da8p+7, 0x0p+0, {-0x1.62fcaa71bf051p-1, -0x1.62fcaa71bf051p-1, -0x1.62fcaa71bf051p-1, -0x1.62fcaa71bf052p-1}},
+    {"sin", 0x1.45f8d3dc9d906p+2, 0x0p+0, {-0x1.db4cfe4a8e387p-1, -0x1.db4cfe4a8e386p-1, -0x1.db4cfe4a8e386p-1, -0x1.db4cfe4a8e387p-1}},
+    {"sin", 0x1.9e3762da0a97cp+2, 0x0p+0, {0x1.80a953d9337cdp-3, 0x1.80a953d9337cdp-3, 0x1.80a953d9337cep-3, 0x1.80a953d9337cdp-3}},
+    {"sin", 0x1.6f082c49ce6e8p+1, 0x0p+0, {0x1.153b5f1ae1489p-2, 0x1.153b5f1ae1489p-2, 0x1.153b5f1ae148ap-2, 0x1.153b5f1ae1489p-2}},
+    {"sin", -0x1.c495f40a46ep+1, 0x0p+0, {0x1.8951ae6a50d8bp-2, 0x1.8951ae6a50d8bp-2, 0x1.8951ae6a50d8cp-2, 0x1.8951ae6a50d8bp-2}},
+    {"sin", 0x1.6ac5b262ca1ffp+849, 0x0p+0, {0x1p+0, 0x1.fffffffffffffp-1, 0x1p+0, 0x1.fffffffffffffp-1}},
+    {"sin", 0x1.fffffffffffffp+1023, 0x0p+0, {0x1.452fc98b34e97p-8, 0x1.452fc98b34e96p-8, 0x1.452fc98b34e97p-8, 0x1.452fc98b34e96p-8}},
+    {"cos", -0x1.39cb67de40036p+2, 0x0p+0, {0x1.84178f47ed8b8p-3, 0x1.84178f47ed8b7p-3, 0x1.84178f47ed8b8p-3, 0x1.84178f47ed8b7p-3}},
+    {"cos", 0x1.99b908989c35p+0, 0x0p+0, {-0x1.e6428cdd48783p-6, -0x1.e6428cdd48782p-6, -0x1.e6428cdd48782p-6, -0x1.e6428cdd48783p-6}},
+    {"cos", -0x1.12740656efdcp+892, 0x0p+0, {-0x1.c110cc167b61fp-1, -0x1.c110cc167b61fp-1, -0x1.c110cc167b61fp-1, -0x1.c110cc167b62p-1}},
+    {"cos", -0x1.a1f3e4cb7aec7p+1, 0x0p+0, {-0x1.fc17110905854p-1, -0x1.fc17110905854p-1, -0x1.fc17110905854p-1, -0x1.fc17110905855p-1}},
+    {"cos", 0x1.9bb6be74a0d52p-19, 0x0p+0, {0x1.fffffffff5a77p-1, 0x1.fffffffff5a76p-1, 0x1.fffffffff5a77p-1, 0x1.fffffffff5a76p-1}},
+    {"cos", 0x1.4dbf1f4223aa4p+4, 0x0p+0, {-0x1.b30ec87268d18p-2, -0x1.b30ec87268d18p-2, -0x1.b30ec87268d18p-2, -0x1.b30ec87268d19p-2}},
+    {"cos", 0x1.6ac5b262ca1ffp+849, 0x0p+0, {-0x1.14ae72e6ba22fp-61, -0x1.14ae72e6ba22ep-61, -0x1.14ae72e6ba22ep-61, -0x1.14ae72e6ba22fp-61}},
+    {"cos", 0x1.fffffffffffffp+1023, 0x0p+0, {-0x1.fffe62ecfab75p-1, -0x1.fffe62ecfab75p-1, -0x1.fffe62ecfab75p-1, -0x1.fffe62ecfab76p-1}},
+    {"tan", -0x1.2ab22a9f62fdp+1, 0x0p+0, {0x1.0bdbae52e5db6p+0, 0x1.0bdbae52e5db6p+0, 0x1.0bdbae52e5db7p+0, 0x1.0bdbae52e5db6p+0}},
+    {"tan", -0x1.6b8e4d737321p-19, 0x0p+0, {-0x1.6b8e4d7376f2ap-19, -0x1.6b8e4d7376f29p-19, -0x1.6b8e4d7376f29p-19, -0x1.6b8e4d7376f2ap-19}},
+    {"tan", -0x1.b8a6adb88bb38p-15, 0x0p+0, {-0x1.b8a6adbf587aap-15, -0x1.b8a6adbf587aap-15, -0x1.b8a6adbf587aap-15, -0x1.b8a6adbf587abp-15}},
+    {"tan", -0x1.6e7361b2571dp-29, 0x0p+0, {-0x1.6e7361b2571dp-29, -0x1.6e7361b2571dp-29, -0x1.6e7361b2571dp-29, -0x1.6e7361b2571d1p-29}},
+    {"tan", -0x1.d9a2d1c1735dap-9, 0x0p+0, {-0x1.d9a358dca2878p-9, -0x1.d9a358dca2877p-9, -0x1.d9a358dca2877p-9, -0x1.d9a358dca2878p-9}},
+    {"tan", 0x1.8fa7dcf05ae18p+2, 0x0p+0, {-0x1.3c1448278a463p-5, -0x1.3c1448278a462p-5, -0x1.3c1448278a462p-5, -0x1.3c1448278a463p-5}},
+    {"tan", 0x1.6ac5b262ca1ffp+849, 0x0p+0, {-0x1.d9ba9a7975636p+60, -0x1.d9ba9a7975635p+60, -0x1.d9ba9a7975635p+60, -0x1.d9ba9a7975636p+60}},
+    {"tan", 0x1.fffffffffffffp+1023, 0x0p+0, {-0x1.4530cfe729484p-8, -0x1.4530cfe729483p-8, -0x1.4530cfe729483p-8, -0x1.4530cfe729484p-8}},
+    {"atan", 0x1.86a411434d8p-10, 0x0p+0, {0x1.86a3fe5014312p-10, 0x1.86a3fe5014312p-10, 0x1.86a3fe5014313p-10, 0x1.86a3fe5014312p-10}},
+    {"atan", -0x1.e69e9f65b8b9cp-13, 0x0p+0, {-0x1.e69e9ed332ad8p-13, -0x1.e69e9ed332ad7p-13, -0x1.e69e9ed332ad7p-13, -0x1.e69e9ed332ad8p-13}},
+    {"atan", -0x1.540d22bec9083p+1, 0x0p+0, {-0x1.35f61ee466ffp+0, -0x1.35f61ee466ffp+0, -0x1.35f61ee466ffp+0, -0x1.35f61ee466ff1p+0}},
+    {"atan", 0x1.5fbc9ebf50192p+47, 0x0p+0, {0x1.921fb54442d01p+0, 0x1.921fb54442dp+0, 0x1.921fb54442d01p+0, 0x1.921fb54442dp+0}},
+    {"atan", -0x1.87986cd98f1f8p+9, 0x0p+0, {-0x1.91cc07a893df4p+0, -0x1.91cc07a893df4p+0, -0x1.91cc07a893df4p+0, -0x1.91cc07a893df5p+0}},
+    {"atan", 0x1.40d35a834d58p-68, 0x0p+0, {0x1.40d35a834d58p-68, 0x1.40d35a834d57fp-68, 0x1.40d35a834d58p-68, 0x1.40d35a834d57fp-68}},
+    {"atan2", -0x1.a35b3d0fac108p-1, 0x1.a1b5235b9081p+0, {-0x1.dc640500196dcp-2, -0x1.dc640500196dcp-2, -0x1.dc640500196dcp-2, -0x1.dc640500196ddp-2}},
+    {"atan2", 0x1.2839f492c1406p+1, 0x1.61c72d33bedbcp+1, {0x1.64e8b9db8b326p-1, 0x1.64e8b9db8b326p-1, 0x1.64e8b9db8b327p-1, 0x1.64e8b9db8b326p-1}},
+    {"atan2", -0x1.4f74148fa5bdp+1, 0x1.4e9fed765a398p+1, {-0x1.92c1cfcfbedd7p-1, -0x1.92c1cfcfbedd7p-1, -0x1.92c1cfcfbedd7p-1, -0x1.92c1cfcfbedd8p-1}},
+    {"atan2", 0x1.00c13da3b7cfp+1, 0x1.2ca5af4806374p+1, {0x1.69e3c27fd0874p-1, 0x1.69e3c27fd0873p-1, 0x1.69e3c27fd0874p-1, 0x1.69e3c27fd0873p-1}},
+    {"atan2", -0x1.3ead5ad35af58p-1, -0x1.005f5b8679cd8p+1, {-0x1.6b8edd8932a32p+1, -0x1.6b8edd8932a32p+1, -0x1.6b8edd8932a32p+1, -0x1.6b8edd8932a33p+1}},
+    {"atan2", 0x1.e63de80347f42p-20, 0x1.e46d83e21bd82p-30, {0x1.91dff2655119p+0, 0x1.91dff2655118fp+0, 0x1.91dff2655119p+0, 0x1.91dff2655118fp+0}},};
+
+static const Reference<float> float_references[] = {
+    {"exp", 0x1.5375e8p-20f, 0x0p+0f, {0x1.000016p+0f, 0x1.000014p+0f, 0x1.000016p+0f, 0x1.000014p+0f}},
+    {"exp", -0x1.f1f08ep+5f, 0x0p+0f, {0x1.26b3c4p-90f, 0x1.26b3c2p-90f, 0x1.26b3c4p-90f, 0x1.26b3c2p-90f}},
+    {"exp", -0x1.6f2758p+6f, 0x0p+0f, {0x1.7df7p-133f, 0x1.7df7p-133f, 0x1.7df8p-133f, 0x1.7df7p-133f}},
+    {"exp", -0x1.724b62p+4f, 0x0p+0f, {0x1.870702p-34f, 0x1.870702p-34f, 0x1.870704p-34f, 0x1.870702p-34f}},
+    {"exp", 0x1.3c3cb2p+5f, 0x0p+0f, {0x1.053c7p+57f, 0x1.053c7p+57f, 0x1.053c72p+57f, 0x1.053c7p+57f}},
+    {"exp", -0x1.c14e76p-3f, 0x0p+0f, {0x1.9b2426p-1f, 0x1.9b2424p-1f, 0x1.9b2426p-1f, 0x1.9b2424p-1f}},
+    {"exp", -0x1.01c292p+6f, 0x0p+0f, {0x1.05df3p-93f, 0x1.05df2ep-93f, 0x1.05df3p-93f, 0x1.05df2ep-93f}},
+    {"exp", -0x1.52af9ap+5f, 0x0p+0f, {0x1.e53304p-62f, 0x1.e53302p-62f, 0x1.e53304p-62f, 0x1.e53302p-62f}},
+    {"exp", 0x1.fadbe2p+5f, 0x0p+0f, {0x1.530ce4p+91f, 0x1.530ce4p+91f, 0x1.530ce6p+91f, 0x1.530ce4p+91f}},
+    {"exp", -0x1.7cf45cp+6f, 0x0p+0f, {0x1.84p-138f, 0x1.83ep-138f, 0x1.84p-138f, 0x1.83ep-138f}},
+    {"exp2", 0x1.71e7a4p-18f, 0x0p+0f, {0x1.00004p+0f, 0x1.00004p+0f, 0x1.000042p+0f, 0x1.00004p+0f}},
+    {"exp2", -0x1.6p+6f, 0x0p+0f, {0x1p-88f, 0x1p-88f, 0x1p-88f, 0x1p-88f}},
+    {"exp2", -0x1.6ed366p+6f, 0x0p+0f, {0x1.39c4b6p-92f, 0x1.39c4b4p-92f, 0x1.39c4b6p-92f, 0x1.39c4b4p-92f}},
+    {"exp2", -0x1.a4p+6f, 0x0p+0f, {0x1p-105f, 0x1p-105f, 0x1p-105f, 0x1p-105f}},
+    {"exp2", -0x1.4e17aap-4f, 0x0p+0f, {0x1.e3db2ep-1f, 0x1.e3db2ep-1f, 0x1.e3db3p-1f, 0x1.e3db2ep-1f}},
+    {"exp2", 0x1.6f258ap+5f, 0x0p+0f, {0x1.db825ep+45f, 0x1.db825ep+45f, 0x1.db826p+45f, 0x1.db825ep+45f}},
+    {"exp2", -0x1.f9cc6p+6f, 0x0p+0f, {0x1.76e9ecp-127f, 0x1.76e9ecp-127f, 0x1.76e9fp-127f, 0x1.76e9ecp-127f}},
+    {"exp2", -0x1.0af8e4p-32f, 0x0p+0f, {0x1p+0f, 0x1.fffffep-1f, 0x1p+0f, 0x1.fffffep-1f}},
+    {"exp2", 0x1.6cp+6f, 0x0p+0f, {0x1p+91f, 0x1p+91f, 0x1p+91f, 0x1p+91f}},
+    {"exp2", -0x1.c4452p+4f, 0x0p+0f, {0x1.a9883p-29f, 0x1.a9883p-29f, 0x1.a98832p-29f, 0x1.a9883p-29f}},
+    {"exp2", -0x1.8p+1f, 0x0p+0f, {0x1p-3f, 0x1p-3f, 0x1p-3f, 0x1p-3f}},
+    {"expm1", -0x1.d7f6f2p+5f, 0x0p+0f, {-0x1p+0f, -0x1.fffffep-1f, -0x1.fffffep-1f, -0x1p+0f}},
+    {"expm1", 0x1.c7e19ap-1f, 0x0p+0f, {0x1.6fa366p+0f, 0x1.6fa366p+0f, 0x1.6fa368p+0f, 0x1.6fa366p+0f}},
+    {"expm1", 0x1.2ba0dap+4f, 0x0p+0f, {0x1.0309acp+27f, 0x1.0309acp+27f, 0x1.0309aep+27f, 0x1.0309acp+27f}},
+    {"expm1", 0x1.c92a34p-50f, 0x0p+0f, {0x1.c92a34p-50f, 0x1.c92a34p-50f, 0x1.c92a36p-50f, 0x1.c92a34p-50f}},
+    {"expm1", 0x1.1e18fap+3f, 0x0p+0f, {0x1.dd263p+12f, 0x1.dd263p+12f, 0x1.dd2632p+12f, 0x1.dd263p+12f}},
+    {"expm1", -0x1.5a1356p-1f, 0x0p+0f, {-0x1.f71b9cp-2f, -0x1.f71b9ap-2f, -0x1.f71b9ap-2f, -0x1.f71b9cp-2f}},
+    {"expm1", -0x1.4c0658p+6f, 0x0p+0f, {-0x1p+0f, -0x1.fffffep-1f, -0x1.fffffep-1f, -0x1p+0f}},
+    {"expm1", 0x1.f9404cp-26f, 0x0p+0f, {0x1.f9404cp-26f, 0x1.f9404cp-26f, 0x1.f9404ep-26f, 0x1.f9404cp-26f}},
+    {"expm1", 0x1.86b28cp-3f, 0x0p+0f, {0x1.ae7392p-3f, 0x1.ae739p-3f, 0x1.ae7392p-3f, 0x1.ae739p-3f}},
+    {"expm1", 0x1.6ac8dap-4f, 0x0p+0f, {0x1.7b55eap-4f, 0x1.7b55e8p-4f, 0x1.7b55eap-4f, 0x1.7b55e8p-4f}},
+    {"log", 0x1.d2d60ap+0f, 0x0p+0f, {0x1.339c28p-1f, 0x1.339c28p-1f, 0x1.339c2ap-1f, 0x1.339c28p-1f}},
+    {"log", 0x1.dcc592p-26f, 0x0p+0f, {-0x1.166644p+4f, -0x1.166642p+4f, -0x1.166642p+4f, -0x1.166644p+4f}},
+    {"log", 0x1.eeda9cp-82f, 0x0p+0f, {-0x1.c16e8ep+5f, -0x1.c16e8ep+5f, -0x1.c16e8ep+5f, -0x1.c16e9p+5f}},
+    {"log", 0x1.c6fc42p+48f, 0x0p+0f, {0x1.0ec4ecp+5f, 0x1.0ec4eap+5f, 0x1.0ec4ecp+5f, 0x1.0ec4eap+5f}},
+    {"log", 0x1.d94fdp-42f, 0x0p+0f, {-0x1.c7f63p+4f, -0x1.c7f63p+4f, -0x1.c7f63p+4f, -0x1.c7f632p+4f}},
+    {"log", 0x1.a8c4p+0f, 0x0p+0f, {0x1.0341a2p-1f, 0x1.0341ap-1f, 0x1.0341a2p-1f, 0x1.0341ap-1f}},
+    {"log", 0x1.20fb0cp+0f, 0x0p+0f, {0x1.f05cd8p-4f, 0x1.f05cd8p-4f, 0x1.f05cdap-4f, 0x1.f05cd8p-4f}},
+    {"log", 0x1.a47ddep-1f, 0x0p+0f, {-0x1.93404ap-3f, -0x1.934048p-3f, -0x1.934048p-3f, -0x1.93404ap-3f}},
+    {"log", 0x1.14ce5cp+0f, 0x0p+0f, {0x1.400f8p-4f, 0x1.400f8p-4f, 0x1.400f82p-4f, 0x1.400f8p-4f}},
+    {"log", 0x1.c9a49ep-115f, 0x0p+0f, {-0x1.3c8628p+6f, -0x1.3c8628p+6f, -0x1.3c8628p+6f, -0x1.3c862ap+6f}},
+    {"log2", 0x1.efa6b4p-2f, 0x0p+0f, {-0x1.0bfc4ep+0f, -0x1.0bfc4ep+0f, -0x1.0bfc4ep+0f, -0x1.0bfc5p+0f}},
+    {"log2", 0x1.7ae42p-1f, 0x0p+0f, {-0x1.bcc9p-2f, -0x1.bcc9p-2f, -0x1.bcc9p-2f, -0x1.bcc902p-2f}},
+    {"log2", 0x1.5b9496p-1f, 0x0p+0f, {-0x1.1e1aa4p-1f, -0x1.1e1aa4p-1f, -0x1.1e1aa4p-1f, -0x1.1e1aa6p-1f}},
+    {"log2", 0x1.8c34d4p+117f, 0x0p+0f, {0x1.d6853cp+6f, 0x1.d6853ap+6f, 0x1.d6853cp+6f, 0x1.d6853ap+6f}},
+    {"log2", 0x1.81c394p+53f, 0x0p+0f, {0x1.acbb8cp+5f, 0x1.acbb8ap+5f, 0x1.acbb8cp+5f, 0x1.acbb8ap+5f}},
+    {"log2", 0x1.ddf056p+41f, 0x0p+0f, {0x1.4f3498p+5f, 0x1.4f3498p+5f, 0x1.4f349ap+5f, 0x1.4f3498p+5f}},
+    {"log2", 0x1.b6614ap-121f, 0x0p+0f, {-0x1.e0e556p+6f, -0x1.e0e556p+6f, -0x1.e0e556p+6f, -0x1.e0e558p+6f}},
+    {"log2", 0x1.d5b2ccp+0f, 0x0p+0f, {0x1.c04d74p-1f, 0x1.c04d74p-1f, 0x1.c04d76p-1f, 0x1.c04d74p-1f}},
+    {"log2", 0x1.1d4714p-97f, 0x0p+0f, {-0x1.836008p+6f, -0x1.836006p+6f, -0x1.836006p+6f, -0x1.836008p+6f}},
+    {"log2", 0x1.97a1f4p+95f, 0x0p+0f, {0x1.7eaf3cp+6f, 0x1.7eaf3ap+6f, 0x1.7eaf3cp+6f, 0x1.7eaf3ap+6f}},
+    {"log2", 0x1p-3f, 0x0p+0f, {-0x1.8p+1f, -0x1.8p+1f, -0x1.8p+1f, -0x1.8p+1f}},
+    {"log10", 0x1.631db2p+0f, 0x0p+0f, {0x1.231532p-3f, 0x1.231532p-3f, 0x1.231534p-3f, 0x1.231532p-3f}},
+    {"log10", 0x1.838d1ap-99f, 0x0p+0f, {-0x1.d9f338p+4f, -0x1.d9f338p+4f, -0x1.d9f338p+4f, -0x1.d9f33ap+4f}},
+    {"log10", 0x1.c9cc1p+67f, 0x0p+0f, {0x1.46be3ap+4f, 0x1.46be3ap+4f, 0x1.46be3cp+4f, 0x1.46be3ap+4f}},
+    {"log10", 0x1.59015p+1f, 0x0p+0f, {0x1.b8f34ap-2f, 0x1.b8f34ap-2f, 0x1.b8f34cp-2f, 0x1.b8f34ap-2f}},
+    {"log10", 0x1.f01998p-67f, 0x0p+0f, {-0x1.3e1b5cp+4f, -0x1.3e1b5cp+4f, -0x1.3e1b5cp+4f, -0x1.3e1b5ep+4f}},
+    {"log10", 0x1.b530f2p+0f, 0x0p+0f, {0x1.dc0504p-3f, 0x1.dc0502p-3f, 0x1.dc0504p-3f, 0x1.dc0502p-3f}},
+    {"log10", 0x1.effd6ep+74f, 0x0p+0f, {0x1.6903e6p+4f, 0x1.6903e6p+4f, 0x1.6903e8p+4f, 0x1.6903e6p+4f}},
+    {"log10", 0x1.00a56ap-48f, 0x0p+0f, {-0x1.ce58d8p+3f, -0x1.ce58d6p+3f, -0x1.ce58d6p+3f, -0x1.ce58d8p+3f}},
+    {"log10", 0x1.e6e816p+45f, 0x0p+0f, {0x1.ba6af4p+3f, 0x1.ba6af2p+3f, 0x1.ba6af4p+3f, 0x1.ba6af2p+3f}},
+    {"log10", 0x1.94e686p-1f, 0x0p+0f, {-0x1.a1789ep-4f, -0x1.a1789cp-4f, -0x1.a1789cp-4f, -0x1.a1789ep-4f}},
+    {"log10", 0x1.f4p+9f, 0x0p+0f, {0x1.8p+1f, 0x1.8p+1f, 0x1.8p+1f, 0x1.8p+1f}},
+    {"log1p", 0x1.fcc694p+25f, 0x0p+0f, {0x1.203f86p+4f, 0x1.203f86p+4f, 0x1.203f88p+4f, 0x1.203f86p+4f}},
+    {"log1p", 0x1.8fff5p-14f, 0x0p+0f, {0x1.8ffa6ep-14f, 0x1.8ffa6ep-14f, 0x1.8ffa7p-14f, 0x1.8ffa6ep-14f}},
+    {"log1p", 0x1.3d3472p-93f, 0x0p+0f, {0x1.3d3472p-93f, 0x1.3d347p-93f, 0x1.3d3472p-93f, 0x1.3d347p-93f}},
+    {"log1p", 0x1.07d712p+1f, 0x0p+0f, {0x1.1e6b3ap+0f, 0x1.1e6b38p+0f, 0x1.1e6b3ap+0f, 0x1.1e6b38p+0f}},
+    {"log1p", 0x1.6b0a6cp+1f, 0x0p+0f, {0x1.5830fp+0f, 0x1.5830fp+0f, 0x1.5830f2p+0f, 0x1.5830fp+0f}},
+    {"log1p", 0x1.255f74p+67f, 0x0p+0f, {0x1.749df6p+5f, 0x1.749df4p+5f, 0x1.749df6p+5f, 0x1.749df4p+5f}},
+    {"log1p", -0x1.de697ep-21f, 0x0p+0f, {-0x1.de698cp-21f, -0x1.de698ap-21f, -0x1.de698ap-21f, -0x1.de698cp-21f}},
+    {"log1p", 0x1.bec6bap+44f, 0x0p+0f, {0x1.f0e2bep+4f, 0x1.f0e2bcp+4f, 0x1.f0e2bep+4f, 0x1.f0e2bcp+4f}},
+    {"log1p", 0x1.7b7edap-79f, 0x0p+0f, {0x1.7b7edap-79f, 0x1.7b7ed8p-79f, 0x1.7b7edap-79f, 0x1.7b7ed8p-79f}},
+    {"log1p", 0x1.eef096p+77f, 0x0p+0f, {0x1.b040b4p+5f, 0x1.b040b2p+5f, 0x1.b040b4p+5f, 0x1.b040b2p+5f}},
+    {"pow", -0x1.367d5ap+3f, 0x1.ep+4f, {0x1.46bfe6p+98f, 0x1.46bfe4p+98f, 0x1.46bfe6p+98f, 0x1.46bfe4p+98f}},
+    {"pow", 0x1.12436p+2f, 0x1.0e21aep+3f, {0x1.a66638p+17f, 0x1.a66638p+17f, 0x1.a6663ap+17f, 0x1.a66638p+17f}},
+    {"pow", 0x1.4e2f1p+0f, 0x1.3328f2p+5f, {0x1.b2608p+14f, 0x1.b2608p+14f, 0x1.b26082p+14f, 0x1.b2608p+14f}},
+    {"pow", 0x1.98584ap+2f, 0x1.1cb1ep+5f, {0x1.1b60f4p+95f, 0x1.1b60f4p+95f, 0x1.1b60f6p+95f, 0x1.1b60f4p+95f}},
+    {"pow", 0x1.97ee72p+0f, -0x1.dd875ap-32f, {0x1p+0f, 0x1.fffffep-1f, 0x1p+0f, 0x1.fffffep-1f}},
+    {"pow", 0x1.cc2c7ep+1f, -0x1.e7f638p+4f, {0x1.9ff8a4p-57f, 0x1.9ff8a2p-57f, 0x1.9ff8a4p-57f, 0x1.9ff8a2p-57f}},
+    {"pow", 0x1.b16c36p+2f, -0x1.4d6628p+3f, {0x1.300d7ep-29f, 0x1.300d7ep-29f, 0x1.300d8p-29f, 0x1.300d7ep-29f}},
+    {"pow", 0x1.d004d6p-1f, 0x1.35427ep+11f, {0x0p+0f, 0x0p+0f, 0x1p-149f, 0x0p+0f}},
+    {"pow", 0x1.a0aa82p+2f, -0x1.c42d1ap-1f, {0x1.878ca6p-3f, 0x1.878ca4p-3f, 0x1.878ca6p-3f, 0x1.878ca4p-3f}},
+    {"pow", 0x1.8p+1f, 0x1.4p+2f, {0x1.e6p+7f, 0x1.e6p+7f, 0x1.e6p+7f, 0x1.e6p+7f}},
+    {"pow", 0x1p-1f, -0x1.8p+1f, {0x1p+3f, 0x1p+3f, 0x1p+3f, 0x1p+3f}},
+    {"pow", 0x1p+1f, 0x1p-1f, {0x1.6a09e6p+0f, 0x1.6a09e6p+0f, 0x1.6a09e8p+0f, 0x1.6a09e6p+0f}},
+    {"pow", 0x1.4p+3f, -0x1p+1f, {0x1.47ae14p-7f, 0x1.47ae14p-7f, 0x1.47ae16p-7f, 0x1.47ae14p-7f}},
+    {"sin", -0x1.2993aap+6f, 0x0p+0f, {0x1.aff11ep-1f, 0x1.aff11ep-1f, 0x1.aff12p-1f, 0x1.aff11ep-1f}},
+    {"sin", -0x1.7ff06ap-19f, 0x0p+0f, {-0x1.7ff06ap-19f, -0x1.7ff068p-19f, -0x1.7ff068p-19f, -0x1.7ff06ap-19f}},
+    {"sin", 0x1.96e018p-19f, 0x0p+0f, {0x1.96e018p-19f, 0x1.96e016p-19f, 0x1.96e018p-19f, 0x1.96e016p-19f}},
+    {"sin", -0x1.dc581ap+1f, 0x0p+0f, {0x1.1885b6p-1f, 0x1.1885b4p-1f, 0x1.1885b6p-1f, 0x1.1885b4p-1f}},
+    {"sin", 0x1.fffffep+127f, 0x0p+0f, {-0x1.0b3366p-1f, -0x1.0b3366p-1f, -0x1.0b3366p-1f, -0x1.0b3368p-1f}},
+    {"cos", -0x1.bf65aep+95f, 0x0p+0f, {0x1.fffeecp-1f, 0x1.fffeecp-1f, 0x1.fffeeep-1f, 0x1.fffeecp-1f}},
+    {"cos", -0x1.8bfbbep+2f, 0x0p+0f, {0x1.fda52cp-1f, 0x1.fda52cp-1f, 0x1.fda52ep-1f, 0x1.fda52cp-1f}},
+    {"cos", -0x1.72e512p+2f, 0x0p+0f, {0x1.c43f1ap-1f, 0x1.c43f1ap-1f, 0x1.c43f1cp-1f, 0x1.c43f1ap-1f}},
+    {"cos", 0x1.136f08p+48f, 0x0p+0f, {-0x1.5f726cp-1f, -0x1.5f726cp-1f, -0x1.5f726cp-1f, -0x1.5f726ep-1f}},
+    {"cos", 0x1.fffffep+127f, 0x0p+0f, {0x1.b4bf2cp-1f, 0x1.b4bf2cp-1f, 0x1.b4bf2ep-1f, 0x1.b4bf2cp-1f}},
+    {"tan", 0x1.d4df42p-4f, 0x0p+0f, {0x1.d6ee4cp-4f, 0x1.d6ee4cp-4f, 0x1.d6ee4ep-4f, 0x1.d6ee4cp-4f}},
+    {"tan", 0x1.d590e2p-7f, 0x0p+0f, {0x1.d5991cp-7f, 0x1.d5991cp-7f, 0x1.d5991ep-7f, 0x1.d5991cp-7f}},
+    {"tan", -0x1.75c8ecp+23f, 0x0p+0f, {-0x1.e83032p+1f, -0x1.e83032p+1f, -0x1.e83032p+1f, -0x1.e83034p+1f}},
+    {"tan", -0x1.7d5d7p-21f, 0x0p+0f, {-0x1.7d5d7p-21f, -0x1.7d5d7p-21f, -0x1.7d5d7p-21f, -0x1.7d5d72p-21f}},
+    {"tan", 0x1.fffffep+127f, 0x0p+0f, {-0x1.393d94p-1f, -0x1.393d94p-1f, -0x1.393d94p-1f, -0x1.393d96p-1f}},
+    {"atan", 0x1.6d4888p+58f, 0x0p+0f, {0x1.921fb6p+0f, 0x1.921fb4p+0f, 0x1.921fb6p+0f, 0x1.921fb4p+0f}},
+    {"atan", -0x1.896402p+0f, 0x0p+0f, {-0x1.fcdf7p-1f, -0x1.fcdf7p-1f, -0x1.fcdf7p-1f, -0x1.fcdf72p-1f}},
+    {"atan", -0x1.e197fp-1f, 0x0p+0f, {-0x1.8275d2p-1f, -0x1.8275d2p-1f, -0x1.8275d2p-1f, -0x1.8275d4p-1f}},
+    {"atan", -0x1.d69e76p-2f, 0x0p+0f, {-0x1.b92376p-2f, -0x1.b92376p-2f, -0x1.b92376p-2f, -0x1.b92378p-2f}},
+    {"atan2", -0x1.75d95p+1f, 0x1.95f644p+0f, {-0x1.12c93p+0f, -0x1.12c93p+0f, -0x1.12c93p+0f, -0x1.12c932p+0f}},
+    {"atan2", -0x1.faa38ap+0f, -0x1.8ba0f6p-2f, {-0x1.c37ae2p+0f, -0x1.c37aep+0f, -0x1.c37aep+0f, -0x1.c37ae2p+0f}},
+    {"atan2", -0x1.142b78p-1f, -0x1.4b72b8p-2f, {-0x1.0e3e42p+1f, -0x1.0e3e4p+1f, -0x1.0e3e4p+1f, -0x1.0e3e42p+1f}},
+    {"atan2", 0x1.0fe616p-1f, -0x1.447d2p+0f, {0x1.5f5714p+1f, 0x1.5f5714p+1f, 0x1.5f5716p+1f, 0x1.5f5714p+1f}},};
+// clang-format on
+
+template <typename T, std::size_t N>
+static void check_references(const Reference<T> (&references)[N]) {
+    for (const auto &reference : references) {
+        const T x = reference.x;
+        const T y = reference.y;
+        const T results[4] = {
+            evaluate<T, RoundingMode::ToEven>(reference.function, x, y),
+            evaluate<T, RoundingMode::ToZero>(reference.function, x, y),
+            evaluate<T, RoundingMode::ToPositive>(reference.function, x, y),
+            evaluate<T, RoundingMode::ToNegative>(reference.function, x, y)};
+        for (int mode = 0; mode < 4; ++mode) {
+            if (!same_bits(results[mode], reference.expected[mode])) {
+                INFO(reference.function, "(", x, ", ", y, ") in mode ", mode);
+                CHECK_EQ(results[mode], reference.expected[mode]);
+            }
+        }
+    }
+}
+
+TEST_CASE("TranscendentalTest.double_correctly_rounded") {
+    check_references(double_references);
+}
+
+TEST_CASE("TranscendentalTest.float_correctly_rounded") {
+    check_references(float_references);
+}
+
+TEST_CASE("TranscendentalTest.directed_modes_bracket_nearest") {
+    std::mt19937_64 gen(3);
+    std::uniform_real_distribution<double> exponent(-700, 700);
+    std::uniform_real_distribution<double> positive(0x1p-20, 0x1p20);
+    std::uniform_real_distribution<double> power(-30, 30);
+    namespace crmath = rstd::detail::crmath;
+    for (int i = 0; i < 20000; ++i) {
+        const double x = exponent(gen);
+        const double up = crmath::exp<double, RoundingMode::ToPositive>(x);
+        const double down = crmath::exp<double, RoundingMode::ToNegative>(x);
+        const double nearest = crmath::exp<double, RoundingMode::ToEven>(x);
+        CHECK(same_bits(std::nextafter(down, infinity<double>()), up));
+        CHECK((same_bits(nearest, up) || same_bits(nearest, down)));
+
+        const double p = positive(gen);
+        const double y = power(gen);
+        const double log_up = crmath::log<double, RoundingMode::ToPositive>(p);
+        const double log_zero = crmath::log<double, RoundingMode::ToZero>(p);
+        CHECK(same_bits(log_zero,
+                        p < 1 ? log_up
+                              : crmath::log<double, RoundingMode::ToNegative>(
+                                    p)));
+        const double pow_up =
+            crmath::pow<double, RoundingMode::ToPositive>(p, y);
+        const double pow_down =
+            crmath::pow<double, RoundingMode::ToNegative>(p, y);
+        CHECK(same_bits(std::nextafter(pow_down, infinity<double>()), pow_up));
+    }
+}
+
+TEST_CASE("TranscendentalTest.special_cases") {
+    namespace crmath = rstd::detail::crmath;
+    const double inf = infinity<double>();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double max = std::numeric_limits<double>::max();
+    const double tiny = std::numeric_limits<double>::denorm_min();
+    const double minus_zero = negative_zero();
+
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToEven>(inf), inf));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToEven>(-inf), 0.0));
+    CHECK(is_nan(crmath::exp<double, RoundingMode::ToEven>(nan)));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToEven>(minus_zero),
+                    1.0));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToEven>(1000.0), inf));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToZero>(1000.0), max));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToEven>(-1000.0), 0.0));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToPositive>(-1000.0),
+                    tiny));
+    // Tiny arguments round like 1 + x
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToEven>(0x1p-60), 1.0));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToPositive>(0x1p-60),
+                    1.0 + 0x1p-52));
+    CHECK(same_bits(crmath::exp<double, RoundingMode::ToZero>(-0x1p-60),
+                    1.0 - 0x1p-53));
+    CHECK(same_bits(crmath::exp2<float, RoundingMode::ToEven>(-150.0f),
+                    0.0f));
+    CHECK(same_bits(crmath::exp2<float, RoundingMode::ToPositive>(-150.0f),
+                    std::numeric_limits<float>::denorm_min()));
+
+    CHECK(same_bits(crmath::expm1<double, RoundingMode::ToEven>(minus_zero),
+                    minus_zero));
+    CHECK(same_bits(crmath::expm1<double, RoundingMode::ToEven>(-inf), -1.0));
+    CHECK(same_bits(crmath::expm1<double, RoundingMode::ToZero>(-50.0),
+                    -1.0 + 0x1p-53));
+
+    CHECK(same_bits(crmath::log<double, RoundingMode::ToEven>(0.0), -inf));
+    CHECK(same_bits(crmath::log<double, RoundingMode::ToEven>(minus_zero),
+                    -inf));
+    CHECK(is_nan(crmath::log<double, RoundingMode::ToEven>(-1.0)));
+    CHECK(same_bits(crmath::log<double, RoundingMode::ToNegative>(1.0), 0.0));
+    CHECK(same_bits(crmath::log<double, RoundingMode::ToEven>(inf), inf));
+    CHECK(same_bits(crmath::log2<double, RoundingMode::ToEven>(tiny),
+                    -1074.0));
+    CHECK(same_bits(crmath::log10<float, RoundingMode::ToZero>(100.0f),
+                    2.0f));
+    CHECK(same_bits(crmath::log1p<double, RoundingMode::ToEven>(-1.0), -inf));
+    CHECK(is_nan(crmath::log1p<double, RoundingMode::ToEven>(-2.0)));
+    CHECK(same_bits(crmath::log1p<double, RoundingMode::ToEven>(minus_zero),
+                    minus_zero));
+
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(nan, 0.0), 1.0));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(1.0, nan), 1.0));
+    CHECK(is_nan(crmath::pow<double, RoundingMode::ToEven>(nan, 1.0)));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(-1.0, inf),
+                    1.0));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(0.5, inf), 0.0));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(0.5, -inf),
+                    inf));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(minus_zero, -3.0),
+                    -inf));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(minus_zero, 3.0),
+                    minus_zero));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(minus_zero, 2.0),
+                    0.0));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(-inf, 3.0),
+                    -inf));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(-inf, -3.0),
+                    minus_zero));
+    CHECK(is_nan(crmath::pow<double, RoundingMode::ToEven>(-2.0, 0.5)));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(-2.0, 3.0),
+                    -8.0));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(-1.0, 1e300),
+                    1.0));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToZero>(-10.0, 401.0),
+                    -max));
+    CHECK(same_bits(crmath::pow<double, RoundingMode::ToEven>(10.0, -400.0),
+                    0.0));
+}
+
+TEST_CASE("TranscendentalTest.trig_special_cases") {
+    namespace crmath = rstd::detail::crmath;
+    const double inf = infinity<double>();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double minus_zero = negative_zero();
+    const double half_pi = 0x1.921fb54442d18p+0;
+
+    CHECK(is_nan(crmath::sin<double, RoundingMode::ToEven>(inf)));
+    CHECK(is_nan(crmath::cos<double, RoundingMode::ToEven>(-inf)));
+    CHECK(is_nan(crmath::tan<double, RoundingMode::ToEven>(nan)));
+    CHECK(same_bits(crmath::sin<double, RoundingMode::ToEven>(minus_zero),
+                    minus_zero));
+    CHECK(same_bits(crmath::tan<double, RoundingMode::ToEven>(minus_zero),
+                    minus_zero));
+    CHECK(same_bits(crmath::cos<double, RoundingMode::ToEven>(minus_zero),
+                    1.0));
+    // sin(x) rounds like x - x^3/6 for tiny x, and cos(x) like 1 - x^2/2
+    CHECK(same_bits(crmath::sin<double, RoundingMode::ToEven>(0x1p-30),
+                    0x1p-30));
+    CHECK(same_bits(crmath::sin<double, RoundingMode::ToZero>(0x1p-30),
+                    0x1.fffffffffffffp-31));
+    CHECK(same_bits(crmath::tan<double, RoundingMode::ToPositive>(0x1p-30),
+                    0x1.0000000000001p-30));
+    CHECK(same_bits(crmath::cos<double, RoundingMode::ToNegative>(0x1p-30),
+                    1.0 - 0x1p-53));
+    CHECK(same_bits(crmath::sin<double, RoundingMode::ToEven>(
+                        std::numeric_limits<double>::denorm_min()),
+                    std::numeric_limits<double>::denorm_min()));
+    // The double closest to pi/2 is only 6e-17 away from it
+    CHECK(same_bits(crmath::cos<double, RoundingMode::ToEven>(half_pi),
+                    0x1.1a62633145c07p-54));
+    CHECK(same_bits(crmath::tan<double, RoundingMode::ToEven>(half_pi),
+                    0x1.d02967c31cdb5p+53));
+
+    CHECK(is_nan(crmath::atan<double, RoundingMode::ToEven>(nan)));
+    CHECK(same_bits(crmath::atan<double, RoundingMode::ToEven>(inf), half_pi));
+    CHECK(same_bits(crmath::atan<double, RoundingMode::ToPositive>(inf),
+                    0x1.921fb54442d19p+0));
+    CHECK(same_bits(crmath::atan<double, RoundingMode::ToEven>(minus_zero),
+                    minus_zero));
+    CHECK(same_bits(crmath::atan<double, RoundingMode::ToZero>(0x1p-30),
+                    0x1.fffffffffffffp-31));
+
+    const double pi = 0x1.921fb54442d18p+1;
+    CHECK(is_nan(crmath::atan2<double, RoundingMode::ToEven>(nan, 1.0)));
+    CHECK(is_nan(crmath::atan2<double, RoundingMode::ToEven>(1.0, nan)));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(0.0, 0.0),
+                    0.0));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(0.0, -0.0),
+                    pi));
+    CHECK(same_bits(
+        crmath::atan2<double, RoundingMode::ToEven>(minus_zero, minus_zero),
+        -pi));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(minus_zero,
+                                                                  2.0),
+                    minus_zero));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(1.0, 0.0),
+                    half_pi));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(-inf, 5.0),
+                    -half_pi));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(inf, inf),
+                    0x1.921fb54442d18p-1));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(inf, -inf),
+                    0x1.2d97c7f3321d2p+1));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(1.0, -inf),
+                    pi));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(-1.0, inf),
+                    minus_zero));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(1.0, 1.0),
+                    0x1.921fb54442d18p-1));
+    // The quotient underflows but the result is still rounded once
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(0x1p-1000,
+                                                                  0x1p+100),
+                    0.0));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToPositive>(
+                        0x1p-1000, 0x1p+100),
+                    std::numeric_limits<double>::denorm_min()));
+    CHECK(same_bits(crmath::atan2<double, RoundingMode::ToEven>(3.0, 0x1p-1070),
+                    half_pi));
+}
+
+TEST_CASE("TranscendentalTest.sincos_matches_sin_and_cos") {
+    std::mt19937_64 gen(8);
+    std::uniform_real_distribution<double> small(-10, 10);
+    std::uniform_int_distribution<int> exponent(-40, 1000);
+    namespace crmath = rstd::detail::crmath;
+    for (int i = 0; i < 5000; ++i) {
+        const double x = std::ldexp(small(gen), i % 2 ? exponent(gen) : 0);
+        double sine;
+        double cosine;
+        crmath::sincos<double, RoundingMode::ToEven>(x, sine, cosine);
+        CHECK(same_bits(sine, crmath::sin<double, RoundingMode::ToEven>(x)));
+        CHECK(same_bits(cosine, crmath::cos<double, RoundingMode::ToEven>(x)));
+        crmath::sincos<double, RoundingMode::ToNegative>(x, sine, cosine);
+        CHECK(same_bits(sine,
+                        crmath::sin<double, RoundingMode::ToNegative>(x)));
+        CHECK(same_bits(cosine,
+                        crmath::cos<double, RoundingMode::ToNegative>(x)));
+
+        float sine_float;
+        float cosine_float;
+        const float y = static_cast<float>(x);
+        crmath::sincos<float, RoundingMode::ToZero>(y, sine_float,
+                                                    cosine_float);
+        CHECK(same_bits(sine_float,
+                        crmath::sin<float, RoundingMode::ToZero>(y)));
+        CHECK(same_bits(cosine_float,
+                        crmath::cos<float, RoundingMode::ToZero>(y)));
+    }
+}
+
+TEST_CASE("TranscendentalTest.wrapper_overloads") {
+    const double x = 0.7;
+    namespace crmath = rstd::detail::crmath;
+    CHECK(same_bits(rstd::exp(rdouble(x)).underlying_value(),
+                    crmath::exp<double, RoundingMode::ToEven>(x)));
+    CHECK(same_bits(rstd::log(rfloat(3.0f)).underlying_value(),
+                    crmath::log<float, RoundingMode::ToEven>(3.0f)));
+
+    // The wrapper's rounding mode carries through
+    using rdouble_up =
+        rstd::ReproducibleWrapper<double, RoundingMode::ToPositive>;
+    using rdouble_down =
+        rstd::ReproducibleWrapper<double, RoundingMode::ToNegative>;
+    CHECK(same_bits(
+        rstd::pow(rdouble_up(2.0), rdouble_up(0.5)).underlying_value(),
+        0x1.6a09e667f3bcdp+0));
+    CHECK(same_bits(
+        rstd::pow(rdouble_down(2.0), rdouble_down(0.5)).underlying_value(),
+        0x1.6a09e667f3bccp+0));
+    CHECK_EQ(rstd::exp2(rdouble(10.0)), 1024.0);
+    CHECK_EQ(rstd::log2(rdouble(1024.0)), 10.0);
+    CHECK_EQ(rstd::log10(rdouble(1e22)), 22.0);
+    CHECK_EQ(rstd::expm1(rdouble(0.0)), 0.0);
+    CHECK_EQ(rstd::log1p(rdouble(0.0)), 0.0);
+
+    rdouble sine;
+    rdouble cosine;
+    rstd::sincos(rdouble(x), &sine, &cosine);
+    CHECK_EQ(sine, rstd::sin(rdouble(x)));
+    CHECK_EQ(cosine, rstd::cos(rdouble(x)));
+    CHECK(same_bits(rstd::atan2(rfloat(1.0f), rfloat(-1.0f)).underlying_value(),
+                    crmath::atan2<float, RoundingMode::ToEven>(1.0f, -1.0f)));
+    CHECK_EQ(rstd::tan(rdouble(0.0)), 0.0);
+    CHECK_EQ(rstd::atan(rdouble(0.0)), 0.0);
+}
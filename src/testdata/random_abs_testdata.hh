@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_abs_testdata = R"(
-186524368.06984448 186524368.06984448 
-528170144.61931562 528170144.61931562 
--561302232.69210458 561302232.69210458 
--897198906.54561675 897198906.54561675 
-155308940.56538606 155308940.56538606 
--482269901.21375811 482269901.21375811 
-357307639.86513567 357307639.86513567 
--572381500.88763392 572381500.88763392 
-111846801.97051334 111846801.97051334 
--852046348.92523241 852046348.92523241 
--805846064.16784346 805846064.16784346 
--187880505.72357786 187880505.72357786 
--198685171.93863952 198685171.93863952 
--361067174.8941201 361067174.8941201 
-84415706.517957687 84415706.517957687 
-290196291.64537263 290196291.64537263 
-121096917.41021562 121096917.41021562 
-311404722.15596819 311404722.15596819 
-460166642.52197051 460166642.52197051 
-3903582.7237976789 3903582.7237976789 
-456704252.99179602 456704252.99179602 
--332666581.87596571 332666581.87596571 
-831049993.94288182 831049993.94288182 
--590760676.29166245 590760676.29166245 
--47507951.67819047 47507951.67819047 
--343223082.99577689 343223082.99577689 
--421485201.9930954 421485201.9930954 
--942823323.75958979 942823323.75958979 
-529522480.57456565 529522480.57456565 
--29606599.695330024 29606599.695330024 
--627697674.6004858 627697674.6004858 
-660056356.33150315 660056356.33150315 
--169403916.91778874 169403916.91778874 
-398088320.94605684 398088320.94605684 
--474234799.9639045 474234799.9639045 
--172980941.11014223 172980941.11014223 
--955943338.44800293 955943338.44800293 
-189463421.97269201 189463421.97269201 
-650471339.78492498 650471339.78492498 
--383380678.94837523 383380678.94837523 
--574505539.28119016 574505539.28119016 
--642949110.08725643 642949110.08725643 
--550626648.33415556 550626648.33415556 
-842725417.39890933 842725417.39890933 
--145894007.89443862 145894007.89443862 
-355709259.11395979 355709259.11395979 
-60347475.173524857 60347475.173524857 
--529392329.86871845 529392329.86871845 
-624284915.63553596 624284915.63553596 
--466703918.26547652 466703918.26547652 
-780269677.85986924 780269677.85986924 
-756420886.68977213 756420886.68977213 
--657157575.15334368 657157575.15334368 
--111245028.14536059 111245028.14536059 
--459501269.35321176 459501269.35321176 
--984909719.11943722 984909719.11943722 
--834494483.47623158 834494483.47623158 
-674645438.91003346 674645438.91003346 
-78778678.383159637 78778678.383159637 
-424324759.38556147 424324759.38556147 
--256997105.59824324 256997105.59824324 
--428693219.1610719 428693219.1610719 
--921621140.69570613 921621140.69570613 
-19130164.720265031 19130164.720265031 
-409680777.5202229 409680777.5202229 
--46467586.802205563 46467586.802205563 
-6824881.087757349 6824881.087757349 
-346358878.64823556 346358878.64823556 
--554673919.92330956 554673919.92330956 
-998663903.89340401 998663903.89340401 
-231340914.54703808 231340914.54703808 
--374827451.00149465 374827451.00149465 
--706005943.22924113 706005943.22924113 
-777510798.86342502 777510798.86342502 
--22569315.053704977 22569315.053704977 
-335980085.93290329 335980085.93290329 
-402708294.3375144 402708294.3375144 
-287782876.94477201 287782876.94477201 
--658475255.51932168 658475255.51932168 
-211471494.06367159 211471494.06367159 
-12128046.099303007 12128046.099303007 
--450316492.8393687 450316492.8393687 
--141945654.06701267 141945654.06701267 
--880581686.59890139 880581686.59890139 
--498742689.85199291 498742689.85199291 
-183039301.94295526 183039301.94295526 
-261811966.82097864 261811966.82097864 
-168440003.24390674 168440003.24390674 
-728033635.6008203 728033635.6008203 
-266791298.05681133 266791298.05681133 
-463498664.28230429 463498664.28230429 
--102976342.82833385 102976342.82833385 
--18368010.179926872 18368010.179926872 
--976819993.70155656 976819993.70155656 
-828126254.22990632 828126254.22990632 
--47821494.420538425 47821494.420538425 
-743905725.53357458 743905725.53357458 
-927772881.19118214 927772881.19118214 
--895503951.89087594 895503951.89087594 
-595285566.22029305 595285566.22029305 
-)";
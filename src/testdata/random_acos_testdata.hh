@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_acos_testdata = R"(
--0.84708748694352076 2.5812771674024053 
-0.82671193020752387 0.59755814106122229 
-0.62400790866587763 0.89693504230006937 
-0.75878395931145715 0.70935222371267059 
--0.12191162856487647 1.6930119772598378 
--0.86546492348490411 2.6168740032575126 
-0.081815892938542634 1.4888888807210201 
-0.7179046662988311 0.77000862373441847 
-0.90612253555234346 0.4367704495343907 
-0.93970007046208215 0.3490440683511068 
--0.37220269732060696 1.95217743039438 
--0.72630903590914431 2.3837332269792308 
--0.0826469434387892 1.6535376475085741 
--0.99152195692313172 3.0112849426122477 
-0.27094820367122119 1.2964183811500976 
--0.14938005056979142 1.7207375855479927 
--0.17644649050461902 1.7481714493364382 
-0.20148672156184744 1.3679207915173677 
-0.47277549886919479 1.078358458456014 
-0.71609957844847116 0.77259815908643659 
-0.94326323748572016 0.33847168545652229 
-0.53146586491028014 1.0104662066988535 
--0.64423397293787121 2.2708176198753449 
-0.45142121379028999 1.1024388945227139 
--0.6775358621262062 2.3152034328128313 
-0.52400644129979046 1.0192481727588887 
-0.76525366084826074 0.69936103939515915 
--0.72324099956014332 2.3792802351529723 
-0.11813793337945744 1.4523818529882813 
--0.70086836293517896 2.3474105005232602 
-0.11590005109666102 1.4546352171034385 
-0.024779476003128131 1.5460143142318132 
-0.81262741157072016 0.62214989598750814 
--0.67890663505190618 2.3170687919252186 
-0.82625230045152787 0.59837458880360883 
-0.97495222029548301 0.2242902094308678 
-0.96523444307308726 0.26445750597917539 
--0.82588994936222393 2.5425751033309134 
--0.67840094003935314 2.3163802640287505 
--0.46124051471806682 2.0501891353465895 
--0.71163303825801871 2.3626162478823507 
--0.18347250080933686 1.7553140866212573 
-0.93817379323456485 0.35347985431061718 
--0.36230401036616533 1.941534991299726 
-0.46348953422696071 1.0888670946660743 
--0.31865093897015806 1.8951022208310202 
-0.78778430423991086 0.66359284396886675 
--0.63268462778633872 2.2558113268664637 
--0.26978528139864144 1.8439663644540747 
-0.64897298840746243 0.86456255831858997 
-0.81683567360064813 0.61489213877821203 
--0.069691919898268728 1.6405447855412669 
--0.52734865674188836 2.1262733432621577 
--0.69351971662569933 2.3371594898906585 
-0.57494817235344864 0.95825552443718842 
-0.46553792523461701 1.0865540067299784 
-0.31954643388615178 1.2455455402273297 
--0.43750387944599312 2.0236172357865265 
--0.15958883163258242 1.7310704592186579 
--0.38253529897065186 1.9633350753862244 
--0.019554802060516741 1.5903523753309643 
--0.983415036847469 2.9592138692407683 
--0.63086386184102328 2.2534624118575 
-0.79010898590893786 0.65980954896437327 
--0.6802504509551266 2.3189005960773339 
-0.015131376267909058 1.5556643730578321 
-0.33721629930433861 1.2268378954269108 
--0.84411510146401803 2.5757089120279848 
--0.72331461745439873 2.3793868416688224 
--0.78281408899863947 2.4699717673094188 
-0.55835622035630816 0.9783932602079759 
--0.52528147703483441 2.1238421942338515 
--0.74743197626781677 2.4149844177426596 
-0.31349325803608918 1.2519268174810871 
--0.2430570434244208 1.8163124918334859 
--0.87764950825719013 2.6417323101575185 
--0.83749760164401765 2.5634838999603193 
-0.99359477780533956 0.11324373457320108 
--0.26799034533967081 1.8421027956356462 
-0.21873071588875526 1.3502828285767272 
-0.28381255603535416 1.2830284918141879 
--0.13246833087191434 1.703655171896556 
-0.82848191841057828 0.59440488665611835 
-0.67832266150895104 0.82531893038720117 
--0.39925636934410036 1.9815019488149763 
--0.41608135042532057 1.9999279828131271 
--0.38778579747489839 1.9690245283431407 
--0.91523065430464012 2.7268763179885411 
--0.26777116662023992 1.8418753025140582 
-0.44630937634453094 1.1081594103403729 
-0.89068656368312782 0.47194318491965376 
-0.11838222292477663 1.4521358370637996 
--0.29901012884808875 1.874451482961645 
-0.83342316972517061 0.58552300339439056 
-0.50056989164357346 1.0465393719073679 
--0.87800300204340109 2.6424703252559532 
--0.72739639850879767 2.385316473336542 
-0.57003584847772593 0.96424684077566813 
-0.54112320473705777 0.99902414191489974 
-0.12764767621865847 1.4427994369050248 
-)";
@@ -1,48 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_acosh_testdata = R"(
-3.5957090199906592 1.9529659585004999 
-1.8549992158632449 1.2288730870879681 
-3.246152023310712 1.8460009093675105 
-4.225930731532074 2.1200843146875115 
-5.2407131418168369 2.340375437855974 
-3.502884850544195 1.9257070107627505 
-3.0964733985431856 1.7962539419995063 
-3.8822823006462919 2.0325548655133745 
-1.2150607735610199 0.64461761197022194 
-3.8161916483426346 2.0147740476736855 
-2.0245117189317199 1.330995511998343 
-2.0374534160585256 1.3383166184634214 
-2.9464156506648607 1.7436091675566812 
-5.0006354658354706 2.2925613748961107 
-1.7085953760942942 1.129459174895816 
-5.6063602712728589 2.4089984264101192 
-5.7380650248098863 2.4325883382756261 
-2.4190964649707745 1.5307903710800823 
-1.0028137537525303 0.074999136084334173 
-5.4732118981196578 2.3845607954018502 
-2.1821040326491357 1.4162372718670682 
-5.5643233131222072 2.4013484783156405 
-3.1003350702157224 1.7975707530042155 
-5.4926983467394042 2.3881754307449139 
-1.5638713816757379 1.0174895091075524 
-4.5120104951263524 2.1873774019632699 
-6.2174823904956344 2.5139814729372207 
-3.4374482961068953 1.9060140329448378 
-3.3359354372956194 1.874638215581186 
-2.0625748167301374 1.3523546375728226 
-3.3283370810735153 1.8722476983807343 
-2.3846924280602106 1.5150359250010259 
-6.1778769236913433 2.5075062354254514 
-4.1399825214247912 2.0989226236387912 
-3.7697084649866888 2.0020692040999126 
-5.4063633342629682 2.3720587473171189 
-2.6550924989137581 1.6321126702992668 
-5.2998622734345737 2.3518063546740993 
-3.2499313773330272 1.8472238941998187 
-1.5274172437740496 0.98655343501373571 
-3.5633508126503379 1.9435512401128876 
-3.9169324005605102 2.041747873511389 
-4.657171977518038 2.2198245728297712 
-)";
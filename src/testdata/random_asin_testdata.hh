@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_asin_testdata = R"(
-0.14577791410713092 0.14629924106994685 
-0.59510331864928356 0.63739420445793837 
-0.54083860237924264 0.5714337894470447 
--0.86049043384029489 -1.0362315331136795 
-0.44083388824283753 0.45652749324747666 
--0.49786472218740185 -0.52113491909283527 
--0.44992067791162527 -0.4666765173484313 
-0.30313195772374457 0.30797754043680331 
--0.4823707670557329 -0.50335915847342871 
--0.71160937589259932 -0.79178624104209028 
--0.5064332873781956 -0.53104336361064197 
-0.24992401547061704 0.25260177945254991 
-0.52484498339435026 0.55253298703181042 
--0.48192350785877747 -0.50284864120329853 
-0.86981636066614909 1.0548299883460899 
--0.9250576634511013 -1.181187381103274 
--0.03521989348444543 -0.035227178917940562 
--0.47173403668750558 -0.49125635152262143 
-0.74372055295947304 0.8386188637754256 
-0.51278392274900941 0.53842437030954826 
--0.49558133622630174 -0.51850401312958772 
-0.030180449482249516 0.03018503305291978 
-0.53730976655658824 0.56724405142242662 
--0.88644425198153098 -1.0896051910294202 
--0.033338965324232972 -0.033345144384224944 
--0.28659276066149797 -0.29066851405821559 
-0.69453727742408189 0.76777654542909546 
--0.72396969828444602 -0.8095396663125829 
-0.58005941678948125 0.61880163092609919 
--0.041141072391025935 -0.041152687052803352 
-0.89751798110806646 1.1141084281377551 
-0.63277801018901481 0.68513559130446466 
-0.50840007219132555 0.5333258097049367 
-0.049994199514894033 0.050015049057278667 
-0.43405462645730108 0.44898862981479026 
-0.06839439506569156 0.068447830096965118 
--0.59159737604105045 -0.63303868595709423 
-0.27233051215303461 0.27581426100033896 
-0.53412791388504832 0.56347584879944357 
-0.36519012555699426 0.37383702609820907 
--0.088621806229120303 -0.088738221490281863 
--0.42428669164013544 -0.43817401357524838 
--0.53369555830027382 -0.5629645122756709 
--0.30871581117424141 -0.31384259888666177 
--0.9040570520930753 -1.1291683665348637 
--0.68852679539658124 -0.75945567319122498 
--0.45442158477514782 -0.47172277575300053 
--0.85997809909833933 -1.0352267558319388 
-0.16420269947780053 0.16494968533936474 
-0.48378753851347378 0.50497725975108199 
-0.018577968143194346 0.018579036978649016 
--0.93415607571200199 -1.2058868673188681 
--0.41736766329883135 -0.43054669077443797 
--0.18269438697193829 -0.18372626767302627 
--0.55583826333697295 -0.58937101459957919 
--0.80494945447478572 -0.93559027564479624 
-0.87256240125056328 1.0604234177375076 
--0.28524212980016783 -0.28925904366146438 
--0.806456514286224 -0.93813461498651329 
-0.20224507503448885 0.20364982902466425 
--0.87781238580512688 -1.0712759108542103 
-0.38086765938899192 0.39073450127231024 
-0.0093757125528313168 0.0093758499186824378 
-0.76887820305770549 0.87708483059347853 
-0.70563339519689872 0.78331664580214044 
--0.56149102806377726 -0.59618658476163444 
-0.013670276232299328 0.013670702043562612 
-0.53126153696928702 0.56008892380545827 
-0.83077466059014271 0.98049799257051296 
--0.17410421882199234 -0.17499602044824614 
--0.2374415878905759 -0.23973126762943178 
--0.84079818206937973 -0.99875597092421353 
--0.3591682105482813 -0.36737647966585441 
--0.44291788673759336 -0.45885059502584785 
--0.82159692551283903 -0.9642066756723674 
--0.65638241142442011 -0.71601355908789566 
--0.99832182867385222 -1.5128542710354931 
-0.33968628684707647 0.34658333121605378 
-0.20985263403739762 0.21142423523227702 
-0.61174815623227619 0.65826861910002976 
-0.49885835664449707 0.52228102029793244 
-0.015977842492791883 0.015978522405335489 
--0.39183055944610556 -0.40262040939079569 
--0.5423374331364178 -0.57321674526844713 
--0.95778110099030345 -1.2791823277653598 
-0.12933912727046804 0.12970247987749717 
--0.36277493929666982 -0.37124397018847277 
-0.30176490734164552 0.30654331922643552 
-0.49743400596238074 0.52063834656477914 
-0.58776215213288241 0.62828997764657657 
-0.16453302119934321 0.16528456167844402 
--0.86042419495648437 -1.0361015312390573 
-0.780627961321676 0.8956699323093561 
-0.6336336995916636 0.68624115701018362 
--0.15381757384048589 -0.1544306741938028 
-0.20598659025202926 0.2074718120039864 
-0.92405183739990759 1.178547744465622 
--0.0082666979219027104 -0.0082667920801378809 
--0.93937796279304964 -1.2208116376416318 
-0.91894317030969663 1.1653924072352937 
-)";
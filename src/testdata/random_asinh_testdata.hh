@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_asinh_testdata = R"(
--1.979943167414393 -1.434629637144047 
--4.8625298791662974 -2.2851155916441068 
--2.6560432122781084 -1.7036747640146859 
-1.8985596446368422 1.397327325552663 
--0.84725733709474405 -0.76914627611710873 
--0.54861125349836026 -0.5242632495024806 
-4.6481316488952853 2.2409880197942362 
--4.1024108381198383 -2.1192561438585504 
--5.8869227886749727 -2.4730175522117261 
-1.1220503045724506 0.96509852431638987 
-2.8993037455572139 1.7861132030009006 
-1.7770812215139138 1.3392559518294509 
--3.8463908152297317 -2.0567674498841004 
--0.83780941382503382 -0.76192097423729688 
-3.639551982940473 2.0033679749692594 
-4.6217711209126264 2.2354285906709648 
-3.5307848909026749 1.9741435227992565 
-3.0598878446022457 1.8372164352140701 
-2.6954573615539523 1.7174729594625162 
-4.850659896730777 2.282721714856601 
--1.0185252881158293 -0.89441246511329986 
-1.9414681829289258 1.4171485844810838 
--6.1145956001558961 -2.510446316235162 
--0.73742319173196336 -0.6830553514832558 
--2.1098124420105204 -1.4916935187250535 
-1.0292977256047511 0.90193921876494865 
--2.746855688752655 -1.735202496997108 
-2.2283343229457433 1.5413231434340882 
-0.26065010378339348 0.25778548374508564 
-2.3621365025490828 1.5947763392010363 
--3.6337494567818078 -2.0018295101883834 
-1.1878122482875977 1.0081472809638892 
--3.9183309249655642 -2.074712178410226 
-5.3623327614690997 2.3811292916494216 
--5.8275762213045423 -2.4630298320457653 
--4.6891226764358613 -2.249573433254505 
--3.2183463318384615 -1.8853215923577724 
-0.060121867211660351 0.060085706193066572 
-3.1438859291024919 1.8629910965349614 
--0.96654435677844752 -0.85751792338218824 
-0.92603432545330566 0.82809326701057828 
-0.58001689525254196 0.55161417644413435 
--0.77663119840411721 -0.71431611602797362 
--1.3510469376390253 -1.1091954519360754 
--1.1478363523296595 -0.98214565340949234 
--0.5528517438086844 -0.52797768600451267 
-0.64284065333540763 0.60521179066854081 
--5.5028417970234411 -2.4065673543167563 
--2.7941916760604748 -1.7512735512846 
--6.1157941243569081 -2.5106397383081429 
--2.0904737838264813 -1.4833796074164605 
-1.9550338345248566 1.4233432295079302 
--1.2905818304698045 -1.07269560344272 
-1.3578310372317919 1.1132249771727931 
--5.652426781922629 -2.4329666210081768 
--4.5858071819430259 -2.2277947538702976 
-3.6174147704344293 1.997486285438745 
-1.5718074630945855 1.2339460029661291 
-4.3364074104397687 2.1732305847442728 
--0.52230030706270991 -0.50106835421750118 
--5.1061335602820943 -2.3330432213266459 
--1.8654608905935088 -1.381796458110073 
--0.40708148817857381 -0.39660226119343628 
-5.2829715174521077 2.3664753257547653 
--5.4570715865487287 -2.3983507027751183 
-1.208592458636133 1.0214622909815683 
-1.7336207465810496 1.3177425997191168 
-5.0161824889222597 2.31560706025284 
--5.5817529074585659 -2.4205793005698948 
--2.3128475493544136 -1.5753891982258481 
--5.881852935306779 -2.4721681531695281 
-4.1074892182956528 2.1204581278103021 
-1.6328084043373128 1.2662445565599119 
--5.8788245529458054 -2.471660440957848 
-0.39513490111351146 0.38551440889024496 
--5.1418924777822301 -2.339892720474229 
-6.2023312341415515 2.5245087102958874 
-5.6870158208429 2.438974565132392 
--0.95688698170564734 -0.85055717820952581 
--0.83366726803923097 -0.75874265187599854 
--6.173515777741307 -2.5199116200658311 
-5.5787959331057468 2.4200577117645818 
-4.744002537928333 2.2609560895837024 
--4.7856730258392179 -2.2695150928004306 
--3.4289834685380836 -1.9460255138573828 
-6.1453708479034042 2.5154012734283304 
-4.4781533860615017 2.2045975169965142 
--1.1364729233749795 -0.97466016520304177 
--5.8421977773863683 -2.4654997080907024 
-0.72201922737374336 0.67061211462844217 
-2.6184853398222199 1.6903585228289955 
--3.6947870859427447 -2.0178996661818811 
-4.0321702912967208 2.1024856023534744 
-5.541492432870033 2.4134545447797833 
--2.414668947166505 -1.6150651703614221 
--1.7363209562841053 -1.319090999401606 
--1.3942049380683761 -1.1346091125613698 
--2.5531713262751023 -1.6667994610022221 
-6.0947555518956325 2.5072390832399218 
--3.662365664314577 -2.0093946951145334 
-)";
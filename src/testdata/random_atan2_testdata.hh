@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_atan2_testdata = R"(
--0.496307445220324 -0.22781775457749598 -2.0011304306598112 
--0.50658776716942433 0.44544422609598255 -0.84953432855439392 
-0.15967346977588015 -0.84023730294932775 2.953798105396908 
-0.61247694070240133 0.028346586542172147 1.5245474461453343 
-1.1782384700220114 0.016517673136563715 1.5567782891858566 
-0.63717837301391711 0.35912444155969925 1.0575588939514122 
--1.0119418936046078 1.2915335439014912 -0.66461084630776612 
-1.3963059537395357 1.185109738433217 0.86703045613148344 
--0.21798395786807023 -0.028946841255543809 -1.702817366065231 
-0.35493470944122074 0.6352395520976124 0.5095297648147421 
-1.4994534029157185 -1.142413767844213 2.2218616888985916 
--1.5097142932778362 -1.1247104235665575 -2.2110783642928591 
--0.36794330766336536 -0.28368842714878406 -2.2276095787792953 
--1.3790284679389133 0.71895314989187753 -1.0902168700936485 
-1.3709964478435208 -1.5411917916231199 2.4145705145279641 
-1.1043750227481377 -1.3968983205068763 2.4726153921627256 
--0.23502799228338089 -1.3269932810524498 -2.9662973440833524 
--0.021792350120213078 0.059144630982028712 -0.35302348004178263 
-0.3348954439486993 -0.21249621479425973 2.1362087167950943 
--0.22315150200106859 1.274356416742267 -0.17335159627623517 
--0.36784948847068155 -1.0297607209897628 -2.7985017077246552 
-0.46427978954902871 -1.0468895788825092 2.7241698230060893 
--0.093922153011155363 1.1706200858583884 -0.080061322869512522 
--0.40477173385755871 0.0056331283399564391 -1.5568804224933446 
-0.58081092918915722 -0.15076888984961023 1.8247741474499444 
-0.7130183260351437 -0.32680229774563063 2.000561192399668 
--1.082777250200345 1.5501876487873636 -0.60970604723710908 
-1.3217386113697915 0.39398972409914257 1.2810978448610906 
-0.69135091531090342 0.73319706168940257 0.75603157340724214 
-1.2018203167004544 1.5555682907523787 0.65780418277965613 
--0.078957486186808756 0.84643839180304559 -0.093012862026296744 
-1.0376713796023465 -0.45276250146401509 1.9822205480310178 
-0.98188643916261009 0.53392348749160412 1.072746369185763 
-0.25702716120162883 -1.265221179411903 2.9411720043679357 
--0.88860932966364115 -1.5583492262945671 -2.6233544907469151 
-1.4007003261538551 -0.77906488977420296 2.078384623882465 
-0.091788819866211346 -1.5268372658553395 3.0815479555482397 
-1.1630728910621859 0.60433570698462979 1.0915898945883329 
--0.66510986701103736 0.69490571443909843 -0.7634932072605074 
-0.29335196521755735 0.031975782672297504 1.4622235420157195 
-1.0973843127302425 -1.405778109860113 2.478778433726172 
-0.60889601893219991 0.99697532766177499 0.54828157170884051 
-0.23252145788872269 -1.1365207445201504 2.9397869798357625 
-0.5740230078596027 0.042783299000453079 1.4964015029973341 
--0.44523569097504323 0.0035713098274325894 -1.5627753318227178 
-1.0769881378221848 1.1644620158675933 0.74639238359062343 
--0.28396220885519519 0.2281397265319276 -0.89397604452136648 
--1.4676688179163682 0.49135203120640547 -1.2477407449679114 
-0.30792572659597717 0.40515542552358097 0.64988234466870676 
--0.67189983526208519 -0.90565771743046608 -2.5033011624581403 
--0.40186609188212019 0.55048012484640241 -0.63059624496189304 
-1.4124337178421742 -0.29041739476853912 1.7735849376948247 
--0.11431166353313182 -0.0055870308525869383 -1.6196328870042007 
-0.26159097854345492 1.2539051862460076 0.2056710927116569 
-0.65095485737391412 -1.5158574856927221 2.7359756492677647 
-1.4432339673118819 -1.2616071092785019 2.2891463324094015 
-0.19258853461954151 0.35645538697682388 0.49535614312549425 
-0.76979564548080326 0.51006532567297569 0.98561554014955066 
--0.86225201883926472 1.0570377549592798 -0.68425602044185363 
-1.5502056571848 -0.56237243829403716 1.9188044045749033 
--0.54819326303538674 -0.41090940463287806 -2.2140223895503266 
-0.59840849674784291 -0.82460161749611105 2.5138296756376808 
-0.82674492987558734 -0.5309086461489998 2.1416456078819088 
--1.2673255720840748 0.81223204984748998 -1.0008431888828182 
-0.64950719576177596 0.31038826320936042 1.1249985814238146 
-0.053028602495581278 0.095312951203222251 0.50771532655828033 
--1.1755189102322512 0.76001516067607922 -0.99686019140297899 
--1.1077332603466905 -0.83034722783696113 -2.2140358238772335 
-0.24708132635728997 0.20380113032932012 0.88109493864271737 
--0.92029423132193389 0.60016366300011681 -0.99291590914198247 
--0.87230552146524654 -0.86919570424637782 -2.3544087814788095 
--1.3757367169834529 -0.13368732141639539 -1.6676672506150392 
-0.70227858140969834 0.006127596905145527 1.5620712402346268 
--1.413233986500527 -0.040562177131856059 -1.599490120489147 
--0.72072937269757886 1.4014320025604348 -0.47500675773749035 
-1.5150664411359225 -0.78078308961801302 2.0466450525326776 
--0.86131528952744441 -1.2897029256065684 -2.5527781351651804 
--0.3871597411904919 -1.5615235336656486 -2.8985564086094948 
--1.4666290559912498 -1.5341455379032658 -2.3786903792277174 
--0.19135167926051388 -0.079401250510476862 -1.9641232593942137 
--1.4879694618498469 -1.2813630270254339 -2.2817273065154891 
-0.25660818195662838 1.1858057967642202 0.2131137635826757 
-0.85320329249975524 0.75274128997047152 0.84787308603980804 
-1.384058404202646 0.51605066724534021 1.2139090701743254 
-0.41100993744200132 -0.24599976634971554 2.1101306404459312 
--1.1367736188798476 -0.79397597708814072 -2.1804791619464865 
--0.46997812952553186 -1.5041643542976382 -2.8387521399998152 
-0.29269486269640788 -0.10561205273970176 1.9170833588630332 
-0.5699017918042526 1.2431924640429073 0.42983223785943331 
--1.4954628305786242 1.0492398751924412 -0.95898696873996769 
-0.74847561362483939 -1.0302772452888092 2.5133151759649652 
--0.99629981160200498 -0.68681276529271984 -2.1743480001872739 
--0.40272853155239119 0.67239620763038044 -0.53964360636943876 
-0.51566885236874205 0.29963509256199838 1.0444189262311991 
-0.029071354254530224 -0.17961763807630327 2.981132792135285 
--0.28344094101912942 0.60049484405910825 -0.44100780470813034 
-1.5702009512127426 -1.1521210795528192 2.203810320466105 
--1.557744044840067 0.81726669414753239 -1.0876256121597381 
-0.32818351766725762 1.153330130466852 0.27722566363972967 
-0.7758488080299526 -1.4700182415944407 2.6559674492483745 
-)";
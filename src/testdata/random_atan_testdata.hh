@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_atan_testdata = R"(
--1.2386484765384544 -0.89160088502972523 
--0.64808977492627728 -0.57503118351410054 
--0.11899972742235954 -0.1184427365187725 
--0.59949939795066287 -0.54005132923306665 
-1.1431590229952215 0.85209721136837313 
--1.0306048623608501 -0.80046881837988593 
-1.3002836243445302 0.91520612266232693 
-0.93590041346991093 0.75229926195311925 
-1.5667988244383091 1.0027298493432695 
-0.17176136863221614 0.17010155229282467 
-1.5509078976447679 0.99809690610478907 
-1.5383865243431463 0.99439882532398516 
-0.63726576433905269 0.56737105802539411 
--0.050515322191488021 -0.050472419564044656 
-0.14161812538514362 0.14068260741757727 
-1.2392915802691369 0.89185457019267722 
-0.96861726643645962 0.76945800273038145 
-0.78785590880040779 0.66729201849480513 
-0.6715536813972931 0.59137829456282587 
-0.96364341762056993 0.76688541889320616 
--0.58353726559648489 -0.52822659163572172 
--1.0682331100598685 -0.81837721723244894 
--0.94052165543603561 -0.75475705772265311 
--0.30480870429364715 -0.29586259019254474 
-0.14215520555742467 0.14120908855170231 
-1.1439756346312002 0.85245106815224103 
-0.33313402577659867 0.32157116687151832 
--0.8232677465321766 -0.68876844808503412 
--0.06075140322953132 -0.060676829230187863 
--1.2145376580865137 -0.88197374245706295 
-1.4452486647148617 0.96551213251748336 
--1.3905927299800962 -0.94735451596405096 
--0.3737145897107732 -0.35764325925532869 
-0.94416022602853511 0.75668426113300324 
--1.235518528223531 -0.89036393437380845 
--0.67624161749287948 -0.59460215463105381 
--0.35550557376201342 -0.341571117684764 
--0.17013388624595827 -0.16852027988396981 
--1.3716768539062336 -0.94084859182810066 
-1.4849928607465825 0.97814396929088931 
-0.49341981839649307 0.45836962055047237 
--1.1720873388152695 -0.86445973195606141 
-0.99519581413940328 0.78299029117663677 
--0.85022262498155055 -0.70462329531667667 
--0.68515853686955841 -0.60069564854928681 
--0.30564325305197571 -0.29662601596431937 
-1.4732855937836091 0.97447148479875656 
--1.4201160954099243 -0.95727866724811872 
--1.0298929824899103 -0.8001234824666551 
--0.82876566039948241 -0.69203653774996521 
-0.34185226085089604 0.329397895557617 
-0.13513631332793929 0.13432259901587862 
--0.99019928872359619 -0.78047371582639902 
--1.3135808035196832 -0.92011636518283313 
-1.0822081516186364 0.82485890462100853 
-1.0430023939388815 0.8064436820388422 
--0.71451483038986896 -0.62040118155796997 
--0.9129017243011146 -0.73989757146254198 
-0.0036753968567251327 0.0036753803071082674 
-0.5755832686650777 0.5222725112123775 
-0.43389122950118741 0.40937743076423616 
-0.03113284360611579 0.031122790907748693 
-1.5423967677993269 0.99558781924877426 
--0.72647712519187546 -0.62827572268945098 
-0.9085550994552829 0.73752162003389132 
--1.2369107566532309 -0.89091460832549796 
--0.3477445498092897 -0.3346640982913488 
--1.0151336311564805 -0.79290801109201314 
--0.55286630862712594 -0.5050411679326049 
-0.56162170140211476 0.51172201573292686 
-0.34958181247746589 0.33630222068844112 
-0.71316671806401333 0.61950813679821137 
-0.14167891547706501 0.14074220178991773 
-0.42214922460900528 0.39945353924943555 
-1.1010377913589462 0.83345061305034485 
-1.5266699657632739 0.99089990606896039 
--0.29230380212578333 -0.2843811926349003 
-0.0085561659889288322 0.0085559572049001987 
-0.56632714123045158 0.5152919701217813 
-0.64661507022320075 0.57399197490000409 
-1.0891316235069901 0.82803674143473927 
--0.087936913481013734 -0.087711290251250296 
--0.68983713499253141 -0.60387263518219314 
-0.5733241547746144 0.52057392559799165 
-0.4086497251628014 0.38794072519832346 
-0.67919707016899888 0.5966274036896928 
--1.3450145857331166 -0.93147699711241949 
--1.4096194523076702 -0.95378192564563402 
--0.16798035967893754 -0.16642659227869738 
--0.51613890538391205 -0.47647521572330448 
-0.24618071993540847 0.24138082889696205 
--0.73790983512180308 -0.63571839423273591 
--0.75147205786208693 -0.64444256032853309 
--0.47945989868057315 -0.44708091866373889 
--1.5660595259114007 -1.0025157895037857 
-0.97625528903576164 0.773383739655081 
--0.31458699304038062 -0.30478505457168553 
--0.26091985863010003 -0.25522947891902609 
-0.94220490859607597 0.75564947885132649 
-0.62207494433645438 0.55649313879297424 
-)";
@@ -1,83 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_atanh_testdata = R"(
--0.86850222901791385 -1.3269512705511695 
--0.27489999220539429 -0.28215671495146816 
-0.59941281317875772 0.69223020567794546 
--0.34986061358718024 -0.36528491818577263 
-0.085384678180449036 0.08559309083802738 
-0.56979172348970364 0.64721438697294764 
--0.10454046919728333 -0.10492381686501712 
--0.6202333508513036 -0.7253842393403932 
-0.47787193261407745 0.52022277551573293 
-0.45958465204435006 0.49678459127138358 
--0.073519224564010832 -0.073652114808188104 
-0.47537727586263401 0.5169948163721545 
-0.61774187781889545 0.7213452301639719 
--0.6825737821359561 -0.83391725329570965 
-0.951407175654301 1.8464150735260461 
-0.25074076535806822 0.25620311787778716 
-0.45318110190348415 0.48869631514012857 
--0.15437225096378637 -0.15561635986576949 
-0.64670590739465483 0.7696156590125578 
-0.094790374227722518 0.095075818648542393 
--0.052403591728755305 -0.05245164005936713 
-0.90082064619129154 1.4765555626256639 
--0.75489367864617196 -0.98423573548901677 
-0.80272510653059381 1.1062282963482251 
-0.47835573518365493 0.52084994443539978 
-0.32633249441659173 0.33871810760809529 
--0.010225728497958331 -0.010226084939872071 
-0.33563607621860125 0.34916642081447541 
--0.95435223943268921 -1.8784297664627312 
-0.48038125910409324 0.52347979450540083 
-0.32037501119619161 0.33206495781543433 
-0.7207662035424458 0.90923776337282747 
-0.72081152858672848 0.90933209947287741 
-0.33254282234385046 0.34568452873733285 
-0.92937521610428675 1.6537851888428023 
-0.38745487180700477 0.4088018509403416 
-0.82532956305798866 1.1733074256226146 
--0.32045081928693242 -0.33214943913308465 
--0.24067326169383674 -0.24548864710852358 
-0.73893783583789885 0.94813560540586395 
-0.06214894852469155 0.062229151077331124 
-0.69051694968887922 0.84894316132697334 
-0.3703805731785037 0.38886410922199199 
-0.10330123382119005 0.10367105203345815 
--0.76080323392814675 -0.99811943230816313 
-0.77167059290124529 1.0244444319860109 
-0.63383408401540597 0.74779908872503909 
-0.88646060187270015 1.4051538790941087 
-0.58328588990558083 0.66742862213433796 
--0.052670828170541473 -0.052719616159256716 
-0.0045204577041848548 0.0045204884957170746 
-0.69037226720000877 0.84866667308915511 
--0.2396683323835842 -0.2444222030476999 
--0.63227125328974854 -0.74519108289556379 
-0.94269417019152568 1.7617143378786333 
-0.50003985064075751 0.54935927993344003 
--0.1400911387255046 -0.14101853803694436 
--0.27258535440760667 -0.27965457790710119 
--0.77404242997042338 -1.0303344209262923 
-0.440540186553946 0.4729008762196007 
--0.38556320411382838 -0.40657795617762965 
--0.47349055975094267 -0.51456006693108813 
-0.10484988980706045 0.10523666664910343 
-0.75384193469026251 0.98179509015942246 
-0.88184456897699581 1.3840033793780973 
--0.98076567689339456 -2.3172712047842512 
-0.48916700761064291 0.53496473779997755 
-0.16841961637397329 0.17003969623567217 
--0.86636024920333643 -1.3182988348087483 
--0.29906413770559426 -0.30849150093364508 
--0.076709656418605388 -0.076860652591206377 
--0.70083658867722542 -0.86894278486061471 
--0.59076577334456193 -0.67884156214822655 
--0.39492206143284636 -0.4176182744711992 
--0.92149986910073078 -1.5988805247939142 
-0.072085138615944233 0.072210387224292016 
-0.054826938816574078 0.054881974581794862 
--0.86973724607185743 -1.3319997975901554 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_cbrt_testdata = R"(
-75941669.833744496 423.47396389417491 
-862111391.47297239 951.74614825587184 
-542592726.37831199 815.62649026772317 
-242452045.52651101 623.55574401944875 
-43949059.320151806 352.8985397514291 
-883051877.45039725 959.39048311836348 
-458439098.26266867 771.07013641634546 
-101634309.48831719 466.67382960573258 
-254290384.39568451 633.54380135446411 
-372418700.7756322 719.46636177013488 
-666228403.82549679 873.38899384464617 
-787514061.30527437 923.46287149429838 
-986665513.22619176 995.53526690017191 
-630402417.80817688 857.44437713278535 
-776040132.20430279 918.95601970397058 
-712898969.76048851 893.32467293671618 
-241519850.08848095 622.75555500367534 
-420713988.98343146 749.31136136763064 
-616873168.25366211 851.26601113026788 
-945490722.64598215 981.48972464877511 
-459878288.42977792 771.87617392451659 
-485784756.06267929 786.1063314325163 
-443992080.79699785 762.88382692185064 
-531465986.18075824 810.0126940960148 
-709701166.95745671 891.98696204368093 
-834982354.56255352 941.65633525705516 
-434680179.65036744 757.5127481509362 
-780306492.23252094 920.63696132153905 
-667928961.29397678 874.13147507737267 
-29360565.074159201 308.49974064252604 
-572660284.14804924 830.42233509413995 
-529469197.4198553 808.99697897912245 
-950552219.90763712 983.23801224195961 
-913693097.70563066 970.36125620359746 
-693805864.16241908 885.27728728561408 
-582232288.73933589 835.02362333602366 
-992718412.92815578 997.56688908200817 
-693798796.91110075 885.27428140234395 
-196614266.76156083 581.48476773389712 
-892899991.04413736 962.94379616540141 
-468481690.03874391 776.65988461244399 
-777140644.21155417 919.39020878434167 
-510887479.04127395 799.42014180780609 
-762957775.47551501 913.7628578896298 
-827800243.01015019 938.94866727961755 
-912871777.94752622 970.0704160974085 
-970393999.96034431 990.03230856038374 
-284839676.67794627 657.96101421653225 
-737851088.88115513 903.6277806571793 
-75603922.887857944 422.84523749121126 
-904872309.19147527 967.22853249573677 
-342396239.32139075 699.58903722513855 
-724935964.52476311 898.32443990720765 
-524850653.04261833 806.63782031018548 
-436487100.13444829 758.56093110495988 
-231932555.33179703 614.40381586371393 
-192794114.63242477 577.69408930187444 
-70700746.456796303 413.49919305656681 
-681585720.05476177 880.04894702552645 
-590589202.04891896 838.99975520395424 
-551845503.91378796 820.23664789562667 
-352116253.34951419 706.14738858894577 
-716331530.08687139 894.75614387219264 
-861317333.03303277 951.45385261344063 
-273264906.70142132 648.92517175099124 
-983812228.32463574 994.57469540763691 
-143460550.06927821 523.49294187640101 
-810180960.15075254 932.23916455096787 
-938539978.81399715 979.07867694631113 
-694112904.94996083 885.4078599055839 
-97533385.791145489 460.31073175223207 
-373622660.67884898 720.2408277965161 
-370849341.87116045 718.454337168797 
-979782900.94157088 993.21503535222018 
-445562477.15008903 763.78220651485628 
-766352462.427688 915.1160780911764 
-954002303.22260523 984.4261486817702 
-399217158.50721627 736.32531702748895 
-643648305.2502265 863.40828167820564 
-488207938.60318214 787.41124447437528 
-278670156.27964842 653.17590205627448 
-791750378.76277101 925.11578925984702 
-600729872.46530545 843.77452576375663 
-254482255.33493713 633.70310490542045 
-19121410.866053566 267.40733211290024 
-542680850.86549044 815.67064418021846 
-400738206.64215297 737.25928393266474 
-815134544.13624501 934.13526162453525 
-677691968.44380355 878.36990260031041 
-994048685.90056229 998.01228022144937 
-743421410.42534256 905.89602675146637 
-1823078.8540101887 122.16172348916444 
-233795834.29055917 616.04474351949978 
-288140637.26727349 660.49292627365162 
-210771510.08640635 595.11920977156183 
-769291937.44695997 916.28461303469646 
-950187329.17672694 983.11218350539741 
-172639485.83336362 556.81814346584179 
-999021365.44269466 999.67368200904957 
-461301819.61707187 772.67178878554603 
-)";
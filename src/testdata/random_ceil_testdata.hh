@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_ceil_testdata = R"(
--356057685.19556725 -356057685 
--261324489.51990616 -261324489 
-370035027.44817591 370035028 
-736302476.04279089 736302477 
-741914887.75250959 741914888 
--992285617.51788938 -992285617 
-394783739.30592203 394783740 
--846953393.49066722 -846953393 
--981360218.83325887 -981360218 
-362278895.30402517 362278896 
--472813230.26945454 -472813230 
-182754097.27242374 182754098 
--670978940.49031186 -670978940 
--11262220.25492847 -11262220 
-25053663.809399486 25053664 
--462846423.35238445 -462846423 
--219326507.12304842 -219326507 
--878471585.63844049 -878471585 
-744205023.40151572 744205024 
-44971007.416319013 44971008 
--946663478.57523501 -946663478 
--434249254.45751393 -434249254 
--274568871.49291039 -274568871 
-905845979.50306582 905845980 
-109800939.47659922 109800940 
-678574653.56829047 678574654 
--580941530.52636695 -580941530 
--945013866.1884259 -945013866 
--86387518.771200538 -86387518 
-13113104.440644979 13113105 
-316568896.58759046 316568897 
-39279139.271688461 39279140 
--125819753.07285678 -125819753 
-734695568.72978473 734695569 
-610435963.78013015 610435964 
--827014058.20136285 -827014058 
--168864605.81820309 -168864605 
-592810413.72235394 592810414 
--18452785.085138559 -18452785 
--620282278.83422732 -620282278 
-651640676.69247198 651640677 
--860668004.12936974 -860668004 
-915672505.44849253 915672506 
--932507064.50430262 -932507064 
--389666602.68220854 -389666602 
--157835780.40444863 -157835780 
-334035233.79406023 334035234 
-77492782.111276627 77492783 
--906551469.5409987 -906551469 
-265245682.64325881 265245683 
--791173062.7181381 -791173062 
-806457606.38215947 806457607 
-992803194.59279418 992803195 
-287245149.79556513 287245150 
--658196927.49899197 -658196927 
--385368174.92011786 -385368174 
-381491104.83293438 381491105 
--172764380.40470624 -172764380 
--777542402.44099879 -777542402 
--546891564.25963044 -546891564 
--813768660.10163951 -813768660 
-226701003.52248049 226701004 
-991591549.71567488 991591550 
--618023968.32196236 -618023968 
--213767624.53568578 -213767624 
-745462933.1003952 745462934 
--895536907.93247855 -895536907 
--302239739.40305948 -302239739 
-238013210.09058714 238013211 
--836508212.13695061 -836508212 
-315857472.27046871 315857473 
-175393290.1851511 175393291 
--627346441.10768712 -627346441 
--527394136.094935 -527394136 
-640207753.11688614 640207754 
--882660494.21603835 -882660494 
--356723262.9997766 -356723262 
-642083337.01721835 642083338 
--126382621.29522216 -126382621 
--748488028.09755421 -748488028 
--757132230.61890626 -757132230 
--388730100.62022245 -388730100 
-622041116.75435781 622041117 
-342950017.90364742 342950018 
-139295423.75675726 139295424 
--926282476.54111636 -926282476 
--701601911.18239713 -701601911 
-58966629.473916173 58966630 
--38560317.406785727 -38560317 
-741563667.12940359 741563668 
--207367199.39496303 -207367199 
--14436266.863169789 -14436266 
-741757762.69839334 741757763 
-98718069.108910561 98718070 
--157199026.80178142 -157199026 
-383253141.22681999 383253142 
-198530374.55720901 198530375 
--962589207.75106144 -962589207 
-695592575.84822035 695592576 
-859048787.1937511 859048788 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_cos_testdata = R"(
-2.6522917694647612 -0.88266166498708887 
-1.5465747828034804 0.024219175665427462 
-2.1294667856870086 -0.53005926827037053 
-2.3481924838713946 -0.70142592999181452 
-3.0571732037083041 -0.99643879394852797 
-0.28057039208457984 0.96089765090653834 
-1.2299995928510752 0.33423811085777727 
-0.3051150041816193 0.95381241128917071 
-1.9034738043268293 -0.32657487097439025 
-1.0426737639104433 0.50391258519456861 
-3.0468564161625999 -0.995515877897307 
-1.3975980536360206 0.17233364772064641 
-1.6054966822583523 -0.034693392014867902 
-1.2229834309945677 0.34084248297544745 
-2.2050098826522695 -0.59254418706251966 
-2.576112469484912 -0.84433140489762704 
-1.0136535334813515 0.52876325004396241 
-1.4578908251086651 0.11266577452193435 
-0.68176757257374376 0.7764600673359735 
-0.61425531295769265 0.81720287392216906 
-0.95200399257881163 0.58005184390460185 
-2.1474663437669754 -0.54523549705442353 
-0.13516597180127052 0.99087897936029856 
-1.0048541327953262 0.53621134455267172 
-0.7698995340363961 0.71798060388528973 
-1.4809049312691254 0.089770383745242543 
-2.1559090413879356 -0.55229335034077065 
-1.6678862363395799 -0.096937445883683512 
-1.9865320768005088 -0.40386311803381197 
-0.22796528837433508 0.9741282476890637 
-0.40731561204323669 0.91818753925478314 
-2.3110625335923887 -0.67448447308382786 
-1.1200264531004218 0.43565863567689034 
-1.1662539661149034 0.39359810172899479 
-1.6914592504770585 -0.12037033729244555 
-2.3475355663196549 -0.7009575657156627 
-0.58428417525119014 0.83410715023828885 
-1.7818412578447071 -0.20948176072390925 
-2.6747326557552014 -0.8929859545194726 
-1.3291301516257388 0.23932071494509491 
-1.1407333256073191 0.41692806752355838 
-0.9983752537417907 0.54166876895562011 
-2.0185551816667027 -0.43294641080685059 
-0.38436663056275866 0.92703611444061262 
-1.9288219285805304 -0.35042571483214696 
-1.726301593281315 -0.15487928867842449 
-2.4009025689071737 -0.73800306717144415 
-2.037782176899801 -0.45019691172888232 
-3.1278407969299322 -0.99990544470935805 
-0.49743701634436077 0.87880843799666619 
-2.2449208418255013 -0.62421358013005845 
-3.0409029905036875 -0.9949350772317832 
-2.7235241022097152 -0.91387480505118635 
-1.5040335338370501 0.06671320737176864 
-0.20186271135363287 0.97969481417228388 
-2.0673801406600067 -0.47642476153144098 
-0.45250329144321011 0.89935543668022189 
-1.5166493102888421 0.054120561450360975 
-1.4377582494911716 0.13264598141461983 
-1.5790157310894091 -0.0082193117462410464 
-0.39252324952704687 0.92394680628814785 
-1.3104917140925532 0.2573749146232493 
-0.29259435929734973 0.9574987887068116 
-0.18179253226390393 0.98352119604438348 
-1.2345991410141568 0.32989956859289654 
-2.2838161472405902 -0.65412091210251788 
-2.5794868314095369 -0.84613464959249551 
-1.9942044614242074 -0.41087000892796677 
-2.5214562059525343 -0.81379916821158294 
-2.9486941821398096 -0.98145270879552737 
-1.1726543829551019 0.38770628803110796 
-1.6412158185485393 -0.070361305589666051 
-1.662829189331773 -0.091902997090132874 
-2.7016840144476126 -0.90479057363892335 
-2.0729127241786918 -0.48128177694957919 
-2.8762639724680636 -0.96500636412074503 
-1.3936175107944067 0.17625326056878463 
-2.0750791334408039 -0.48317964663392082 
-0.36978314434806947 0.93240574203367965 
-1.1801745206236482 0.3807634557487875 
-2.154767049591753 -0.55134096913457697 
-2.1636315017507846 -0.55871464588601616 
-1.935696352499654 -0.35685590432854608 
-0.6807732301885967 0.77708628460133511 
-2.364137877371316 -0.71270123687638998 
-0.46093347375803589 0.89563769327986487 
-1.4367904692829927 0.13360514754565736 
-2.8815118440837693 -0.96636920042678065 
-0.7885649531690756 0.7048639807796625 
-0.73263822134750911 0.74341246139434591 
-2.8787443348650457 -0.96565381165547393 
-0.17393407049762821 0.98491156644435107 
-2.0863189466091381 -0.49298961397288471 
-2.146761092294089 -0.54464416124540427 
-1.0548650703615023 0.49334510104295298 
-2.167684066771852 -0.5620710838947417 
-0.53382881446100905 0.86086515758614757 
-1.3371716610388025 0.23150523344138507 
-2.2969904393769802 -0.66402876224442264 
-0.84365724028530165 0.66473502930739881 
-)";
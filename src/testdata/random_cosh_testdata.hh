@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_cosh_testdata = R"(
-4.1733255405169203 32.473212586014718 
-4.9998179163730434 74.196438565194271 
-6.0315266363099127 208.17628077402472 
-1.4890320240009922 2.3291967557871418 
-2.1831115344741061 4.4932825290687797 
--6.1487082274154838 234.05721882614813 
-3.8962647115674542 24.619289291605263 
--3.7681127567660284 21.660684457874012 
--2.9044148933610034 9.1546702483412723 
--5.5333394316045901 126.49564431594777 
--4.0743806402758533 29.415522499268484 
--2.3240675035925182 5.1575114287799835 
-1.278863073493774 1.9354532611782886 
-1.4048824459111833 2.1602217883213908 
--4.849111894469706 63.817414296973972 
-1.9311112335149048 3.5210786730426427 
-6.1039690083183942 223.81656685984498 
--6.1060880969032185 224.29135214113899 
--5.5729836011455145 131.61103314412713 
--4.4826873748556011 44.241707106794969 
--5.8770769567987564 178.38383995465284 
--2.0970374058773107 4.1324162110908382 
--3.7376672815008174 21.011855717347402 
-1.4791066971489402 2.3084321654460855 
-2.984669641150413 9.9152614361671443 
-6.2531748172779906 259.83097924015368 
--0.40173363936673834 1.0817860931820094 
-0.12248612171212692 1.0075108082603217 
-3.8202039912391559 22.8177177285007 
--5.4504804841267998 116.43716181240218 
-0.83202454880351517 1.3665668776854976 
-4.3676803037835192 39.436583805006613 
--0.87267177252111328 1.4055651816324954 
-4.1881045100607359 32.956469488630724 
-6.1344959396637684 230.75428756090935 
--0.44193760065399879 1.0992542027210241 
--2.0793799124438559 4.0622573425981932 
--2.9200127842998396 9.2977287482203437 
--1.8340491884635473 3.2094726754940113 
--5.1118053481998933 82.987871445978541 
-4.5038541158361838 45.187901720875175 
-4.4889513338397649 44.519634318619659 
-5.2102020264673659 91.568256173301378 
-4.1137968636002977 30.597454701714458 
-5.192584651936281 89.969287139171954 
--4.8198471469926307 61.97710590562221 
-4.0263720660813274 28.037504556554776 
--2.882598086057 8.9583027396439103 
--1.8389105686705216 3.2243364456229262 
--2.4003948665375767 5.5591060312432488 
--0.0016567340532187558 1.0000013723841754 
--2.3910393649015376 5.5081887195647496 
--2.502813870004597 6.1493382683751445 
-4.2292466300843756 34.340022766174066 
-0.96965364050391489 1.5081226501535108 
-4.8474605586355377 63.712130216971673 
--1.143757220310297 1.7285790330774895 
-1.91150015343886 3.4555427401656522 
-2.7910984654872255 8.1801337740817317 
-5.6227935525940094 138.33239339064005 
--5.0394780095756824 77.197940663254329 
-5.546420338047799 128.16113998289151 
-0.28394326746176546 1.0405834598993222 
-2.2694943695017944 4.8889361410088759 
--2.6824774859482545 7.3448329789501114 
--5.0619326545714616 78.950856082416152 
-1.4121008547891689 2.1741001844158987 
-1.0709766093779471 1.6304508866449736 
-0.82715601513259163 1.362048505578197 
-2.6671218862224961 7.2339604482025504 
-5.6178014076916227 137.64355694379617 
-0.46534401702371486 1.1102405081358369 
-6.1922933645448044 244.48412210429666 
--2.6024399897858754 6.7853610508908684 
--1.0775261224905295 1.6389202306788815 
--5.5425316423113919 127.66374324426157 
-0.37355883794775746 1.0705882672719307 
-4.0624680396822139 29.067388596039624 
-1.137509988682555 1.7198043644216761 
--2.2720289106989107 4.9010810856701976 
-5.6140529073522938 137.12857946596043 
-3.6220620416453713 18.720683191395953 
--1.3762191904560828 2.1062165896961242 
-4.6439641022831193 51.982621043395234 
--6.0930699485848923 221.3904464421224 
-5.307406623283784 100.91554632636603 
--0.29338545273720129 1.0433471035990463 
--3.6475185334749876 19.202683258749072 
--4.549674815134944 47.30610546607641 
-4.6882559976206473 54.336353884630547 
--3.7063114239984531 20.363979856297753 
--4.1799382248438643 32.688557402803163 
-4.2018752495780376 33.413234682197043 
--0.18610668514633755 1.0173678915219637 
-4.6949603205895603 54.701804538891508 
--0.1800891096762971 1.0162599177980847 
-3.5814710413356963 17.977092932071887 
--1.2005719817216383 1.8115192478661108 
-3.2771488793276085 13.268922785354091 
--5.6646556875469329 144.24605006311307 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_erf_testdata = R"(
--4.4304276643227842 -0.99999999962853803 
--4.7168686659954533 -0.99999999997453437 
--1.5467711889175346 -0.97129138934903092 
-2.9434729907248354 0.99996854927461687 
-3.7731885140998109 0.99999990503001313 
--0.95245608247515889 -0.82201213723766486 
-1.7055279567993109 0.98413388156287018 
--2.8723409379576612 -0.99995136749713942 
--4.0794818137743132 -0.99999999203789136 
--0.31220027945130102 -0.34116187212880217 
--3.5191425481606795 -0.99999935362328585 
-1.3479004015410165 0.94337820556674512 
-4.6200917944751705 0.99999999993587696 
--1.4902022969182696 -0.96492264683686313 
-1.7346905543522464 0.98584174276038283 
--4.4168469868986024 -0.99999999957988495 
--1.3831825651484904 -0.94954845541251087 
-3.4970832083650016 0.9999992409907924 
-0.84499758815707349 0.76791572408267084 
--1.7924623116679816 -0.98875284398421492 
-3.905158843367353 0.99999996662248947 
-0.52542553814324755 0.54255701900059128 
-2.513886006027322 0.99962226764231354 
--0.54584307919678121 -0.55984925658127693 
--4.8234121199541908 -0.9999999999909801 
-1.1195676495330602 0.88664866354426963 
-4.3544998257819181 0.99999999926420213 
--4.571622755233701 -0.99999999989886912 
--4.0192979361633299 -0.99999998685318003 
-1.3004655348100513 0.93410481436249593 
-3.5748330713494365 0.99999957090947234 
--0.15128928555437593 -0.16941813098010147 
--1.0459038863433534 -0.86089481679498869 
--0.49441139557268787 -0.51557501205678224 
-2.1071533719298632 0.99711718563965612 
--3.3650022358770428 -0.99999805283393273 
-2.6669000371620051 0.99983777389555106 
--2.7120300628377763 -0.99987463463938731 
--4.4446183922289038 -0.9999999996734934 
-0.64154207456015211 0.63573993199284906 
-3.3664495923522324 0.99999807248092809 
--0.60828232696258144 -0.61034385595321561 
--4.9868889015417235 -0.99999999999824296 
--1.8949393929870868 -0.99263446200231664 
--4.4965482142783832 -0.99999999979703358 
--2.7449911982365403 -0.99989640073384467 
-0.93003223464936013 0.81157887452584687 
-3.4910675920773588 0.9999992071333339 
-0.36256002944427124 0.39186491333750811 
-2.9596808829827275 0.99997156122820663 
--2.5854864876300083 -0.99974424784769389 
-3.8658742178072512 0.99999995427270605 
--3.0121267486155259 -0.99997953813982643 
--0.58490459046023258 -0.59186495676600415 
--1.832943617912512 -0.9904628401549822 
-4.8381963806279273 0.99999999999220368 
--4.3820257428151335 -0.99999999942494433 
--3.4812694456409208 -0.99999914885085384 
--0.69391640512760411 -0.6735778499832914 
--0.36940041130480594 -0.39861585107208092 
-1.3050947401730912 0.93506170674438405 
--1.708915274422246 -0.98434114172703058 
--2.4397708559634306 -0.99944015439251088 
-1.3040194673298569 0.93484046788085107 
--2.5546266971049123 -0.99969707731328761 
-0.77603420661919476 0.72756755090621672 
--1.3598252193436395 -0.94553040664659027 
-0.55183388165010605 0.56485098101484288 
-1.2532151469708763 0.92365752779548072 
-0.25238557246296001 0.27885361836894706 
--3.5460459046127268 -0.99999946929619177 
-4.0205035945831842 0.99999998698369341 
--2.8434230832630587 -0.9999420994242616 
--1.6423329131932212 -0.9797998590014918 
--4.6856646598515388 -0.99999999996563316 
-2.6723092409044158 0.99984267706980889 
-2.7852765862372317 0.9999181698593711 
-2.9022054320227699 0.99995945262118846 
-1.8551019868784548 0.99129712092575395 
--3.916845350659182 -0.99999996962403437 
--4.2661450720532264 -0.9999999983929575 
-2.6749189882596056 0.99984499247811798 
-1.2377843727289175 0.9199664513080601 
-0.71853033022905421 0.69044457941401571 
--3.7478274927230837 -0.99999988434214293 
--2.0070884146876922 -0.99546670141883919 
-1.6797831288778484 0.9824782303244628 
--4.0818697402610233 -0.99999999219588809 
--2.5303141484829799 -0.99965430197404304 
--0.015979632307244529 -0.018029549573240964 
--3.1037395060154447 -0.99998863102976998 
--1.1494724367937903 -0.89596512040678677 
--1.056838981332012 -0.86498009467775072 
-2.8772982092108892 0.99995280777661688 
-3.8174189457398082 0.99999993285415401 
--4.2098175809610243 -0.99999999737662271 
-1.9026710348464748 0.99287154930917998 
-1.2468991202864474 0.92216385688740843 
--1.4680922040495266 -0.96212416420198155 
-1.8981281206108394 0.99273308696957985 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_erfc_testdata = R"(
--0.39585904176501074 1.4244040729881349 
--1.7939157082249757 1.9888186634032905 
-2.8757012240650077 4.7651734460119135e-05 
--0.15771865798669005 1.1765017462846281 
--4.8335356212563063 1.9999999999918368 
-4.3323603757032245 8.9617433094034458e-10 
--3.497530759369528 1.9999992434532805 
--2.2423810873277339 1.9984819241946297 
-2.9671535818988044 2.714439526486268e-05 
-4.7359142504856688 2.1187870307086716e-11 
-1.7562668291658206 0.013001201902259611 
-4.4477074319251777 3.1744926001862778e-10 
-3.7500211871126528 1.137085830503497e-07 
-3.6952087196667609 1.7339032585865152e-07 
--1.2197690037803794 1.9154750266974889 
-0.97211788538481425 0.16919894784692247 
--3.490818102694083 1.9999992056981801 
-0.88446242656380658 0.21100060918171415 
--1.6641757618529045 1.9814023887560073 
--4.8271079211136376 1.9999999999913025 
--2.6365565471853425 1.9998074947686437 
-0.82111373952353972 0.24554830180518938 
--4.1414624275118967 1.9999999952844811 
--3.7579907690111094 1.999999893109019 
--3.4747467313642493 1.9999991077871198 
-1.3852253519981064 0.050112262159695477 
--3.9276134969877408 1.9999999721567423 
-4.8708783202915313 5.6398722543560518e-12 
-1.3046082100158998 0.065038320620839779 
-4.0468405057351973 1.0459967056909379e-08 
--0.49719611358816707 1.5180324201236906 
--0.67386212200088913 1.6594023049284847 
--1.9033487474271285 1.9928920008680211 
--3.6112338477862593 1.9999996727830021 
-2.610375893174588 0.00022282234084158468 
--2.2706105365787685 1.9986778507046015 
-4.8583989776581706 6.38367065415611e-12 
--1.8125220873242238 1.9896315587387148 
--3.0111699888088239 1.9999794139184457 
--2.6225511677533015 1.9997917951688948 
--0.33817551391795408 1.3675294277120156 
-0.88374937000407527 0.21136883624430486 
-4.3596514449574872 7.0270450803994507e-10 
-1.2913957916164058 0.06780366365244872 
-4.4686701169475622 2.6214978291747147e-10 
-1.670920559795527 0.018125785621758116 
-2.9875985730985839 2.3883213016758128e-05 
--2.8925972169039142 1.9999570019963566 
-0.20113784639064125 0.77606411314929769 
--4.0240711884799802 1.9999999873625571 
-0.57353248293408043 0.41730972976371683 
--2.2518910939823202 1.9985507328856218 
-4.0865795297104057 7.5013762392235311e-09 
--0.6049354207488884 1.6077299541046264 
-2.6103575411095221 0.0002228450840194148 
-1.5337519485161586 0.030078675023271776 
-3.5938217632625467 3.7263375383284592e-07 
-4.2224634520463571 2.3513239321418105e-09 
-4.4254215052753541 3.8872004641781644e-10 
--0.03294248835863911 1.0371581756461072 
-0.27340843353357158 0.69900947646451927 
--3.6006248723832219 1.999999645792065 
-0.1548549308051852 0.82665164985685036 
--1.3395140605396358 1.9418226189357097 
-1.5042082716635941 0.033397511534824099 
-2.991540648685989 2.3298865672453239e-05 
--2.9871981419053073 1.9999760566556688 
-1.9999366213547223 0.0046790449926257319 
-3.0729686344528435 1.3874752270917627e-05 
-1.2114929349765546 0.086655571574101253 
-4.0346506164953322 1.1575873364524346e-08 
--3.389771360812559 1.9999983639804875 
-3.7714386625656928 9.6274044837947387e-08 
-0.79369361825412188 0.26167018678759579 
-3.340594756082595 2.308929629622846e-06 
-3.9117851420227794 3.164201327881546e-08 
--0.91308326366069892 1.8033985043992491 
--3.1974198387490844 1.9999938694014729 
--4.5234917694153829 1.9999999998417308 
-1.3524944103993732 0.055784427665494414 
--3.8075669204724729 1.9999999274395783 
-1.8052765134533857 0.010678522980939967 
--3.8688135132380586 1.999999955332564 
--0.58700505380090817 1.5935463067416578 
-0.4291008074511371 0.54395697917577857 
-0.28968940394135689 0.68203873411473492 
-4.9719338034949985 2.0450625084583495e-12 
-2.127279476678579 0.0026260346176430571 
--3.9285651806105069 1.9999999723704571 
--1.8178487025753491 1.9898543797288273 
-3.0588801848721161 1.519035473131411e-05 
--0.65741055781355939 1.6474833677774157 
--1.5203382461630524 1.9684513473384806 
--0.06696233170627508 1.0754461176255761 
-1.2522338092594261 0.076573002074950353 
-2.3907097630968908 0.00072229332210631411 
-1.7977443696061126 0.01100958420119851 
-3.7415257402885924 1.2143903292207762e-07 
--3.3930883455766025 1.999998401828281 
-2.1689913737720854 0.0021591740152166546 
-)";
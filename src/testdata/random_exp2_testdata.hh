@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_exp2_testdata = R"(
-0.25106896912990173 1.1900885880337519 
-0.45208911289636511 1.3680198016226572 
-9.2416696947228942 605.36845704554196 
--5.6877957302509641 0.019400051194504518 
-4.0319402345558295 16.358178817731268 
-6.5283014469635532 92.302732148069865 
-2.7751031907948924 6.8452498040850349 
--4.2331489780484546 0.053173491918368843 
-4.712829863074063 26.224254637509478 
--8.6683754677798106 0.0024578703496016202 
--8.625623915537906 0.0025317946050843003 
--6.4570302713016918 0.011382566740486743 
-5.6358772627685383 49.724234734651965 
--0.29624689970437323 0.81436818193715421 
-1.9047137094698741 3.7443458824935032 
--3.8268568988265352 0.070469515295985302 
--9.9200738797993289 0.0010321913208038306 
-6.8696255541627274 116.94007035380565 
-1.3829389459589052 2.6079910994681295 
-0.6955755096847227 1.619530355828533 
-5.0414273895940749 32.932209173486577 
--5.139333238312215 0.028373083591296602 
-5.375129455159275 41.502589670492682 
--9.8162392383871513 0.0011092196246199454 
--7.8349474099147569 0.0043797146416785348 
-7.2204030867709861 149.12755925802065 
-1.2228088852753451 2.3340069957737817 
--1.0285034017266153 0.49021841950566358 
-1.8566444483736753 3.6216432695159781 
--4.5480239203420334 0.042747269477770931 
--3.1714331488608813 0.11099501978620768 
-5.9334350087637038 61.114169583028463 
--9.0959774999007834 0.0018274181441744089 
--8.772368824235663 0.0022869351566719271 
-5.3498185632765427 40.780811060935662 
--2.610707869463889 0.16371882586549974 
--2.5976852077552941 0.1652033437078412 
-6.4703845817380561 88.670639896312011 
-4.1301413426066489 17.51041465298789 
--2.7432370650638669 0.14934935735781033 
-4.733759081933739 26.60746355198971 
-8.6120373819457114 391.27452757326813 
-0.90397038742927371 1.8712085870845876 
--4.7634060180307261 0.036818993057350459 
-2.5322438343279678 5.7847067866596475 
--9.6965096463886749 0.0012052017210768516 
--8.4347161795154548 0.0028899972204088887 
--7.5884934515097342 0.0051956016876328051 
--9.0410137163587017 0.0018983823182801296 
-2.0469193298394561 4.132226485484007 
-8.2354617694317831 301.38457471213422 
-1.0814700740824197 2.1161913346490882 
-3.3263315082174554 10.030568762810168 
-3.8002719642042813 13.931434997043754 
-2.5703347357319739 5.9394722057023106 
-3.9166680826674103 15.10200382547011 
--9.5491177860047252 0.0013348396987210333 
-0.11401986535008035 1.082239546441113 
--5.2892217436500362 0.02557323099181194 
-3.3784077562199339 10.399251277479577 
-3.1583105961083504 8.9278364350578396 
--4.4628652772311934 0.045346490875193046 
-3.4582777681845567 10.991205847129415 
-8.9717822001267429 502.083046164292 
-5.9633178851400537 62.39324266381422 
-5.5621173091059912 47.245902506983668 
-3.1471177709572569 8.8588398165469435 
-8.0390908974853623 263.03134033684881 
--6.6637559995655415 0.009863011973413157 
-0.18822574480559062 1.1393616441764114 
-7.3691264049560168 165.32102517590417 
-8.1935502936993032 292.75505945928109 
-3.9682344949904547 15.651559365701445 
-9.5386364812986919 743.73068248894594 
--0.95138466705026303 0.51713588797811527 
-0.37172997612608327 1.2939034567123457 
-6.9122183771872088 120.44397168871259 
--5.2522890110424116 0.026236352773218046 
-7.2616966045003295 153.45763377885058 
--6.2656087813589352 0.012997619400988087 
-3.2222797650155748 9.3326045459505327 
-2.6647354359284279 6.341110141806209 
-1.8827993513448238 3.6878995264201611 
--8.7069031366879841 0.0023931007700404992 
-0.88578600617125502 1.8477710461294625 
-0.58344792977492332 1.4984260954315485 
--8.609477991213847 0.0025602883356935571 
-4.0340345343338804 16.381942542882612 
--8.3911343791001798 0.0029786320229208008 
-7.2260447982160159 149.71186974309111 
--2.034348841188077 0.24411809776601087 
-4.8960213038188432 29.77482871867652 
--6.4269126441642737 0.011622686256610991 
--9.9099685009030516 0.0010394467008245441 
-3.7183469846050272 13.162366417919911 
--4.0671148812773863 0.059659062565293658 
--1.73825712558825 0.29973155376819083 
--0.35657502062414359 0.78101652530596988 
-7.0248284263756453 130.22191292643706 
--4.4287819019533083 0.046430547333830646 
-)";
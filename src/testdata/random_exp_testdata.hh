@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_exp_testdata = R"(
-7.3145150467873137 1501.9432471960013 
--5.4272425940522391 0.0043951984553996428 
-2.178901143862916 8.8365907797324255 
-7.0478987335746304 1150.4388227527329 
--7.5047143433417087 0.00055048307704225706 
--9.4646906054229607 7.7542017640197731e-05 
--6.4739592994044353 0.0015431040112669368 
-9.3557498039009843 11565.129866837069 
--5.6125135197049678 0.003651878742993408 
--5.8336466723882392 0.0029273822878965474 
-9.0775457062523834 8756.448735568134 
-2.0408826487663383 7.6974003022393855 
--4.4099156424337576 0.012156203754426642 
-2.4723454685101522 11.850208572844325 
-7.4829169967248461 1777.4179436909201 
--9.9320422087793645 4.8592458753480175e-05 
-9.2212458520927179 10109.651616193283 
-4.2839387961427473 72.525541483482542 
-8.4164245022613287 4520.7107329190376 
--3.1164047103401007 0.044316211963208563 
--1.1617928502182409 0.31292465063501901 
--8.5882726155744145 0.00018627758289775612 
--1.4257871067393086 0.2403192318584951 
-3.528887548857341 34.086027475177815 
--9.4758161942075336 7.6684098316537948e-05 
-6.0892555581212022 441.09292084745374 
-6.202202717288845 493.8356242034971 
--0.3286615292587296 0.71988663607908598 
--7.974089420964579 0.00034426824552382453 
--8.0971332062532078 0.00030441057069378067 
--1.2029347432915074 0.30031158000187896 
-6.9096380948145928 1001.884589443138 
-7.7057856231677775 2221.1616930716082 
-2.9379224552973948 18.87658858991059 
--1.4149371894292848 0.24294087222436569 
-3.3840293040347973 29.489353621896431 
--5.9952117544018257 0.00249064951181544 
-7.0914228765812801 1201.6163365496582 
--4.3906493140837464 0.012392679865874294 
-1.2771575357082181 3.5864309215330037 
-7.6740303773568144 2151.7363016313466 
-7.455347505482365 1729.0847573099761 
--3.9737057077977065 0.018803623134432543 
-4.4097021919997541 82.244966647655161 
-3.2728226253109316 26.385711308378177 
-4.7547036767785773 116.12923627599469 
-0.54857756842902816 1.7307893366786498 
-2.9195047813877366 18.532107742272554 
-7.5404854690778897 1882.7438172407028 
-4.6880876952510029 108.64521826102791 
--2.2238853090222168 0.10818794757515487 
--4.1159162302111829 0.016310988940151771 
-6.8736235532885424 966.44419072109042 
--0.42650806736217461 0.65278459930452615 
-6.2371767012464403 511.41260022753966 
-8.1355090966859862 3413.5534552402364 
-4.8969641956833456 133.8827203809067 
-2.3499269637088283 10.484803925569963 
-7.9093297270810794 2722.5649930416294 
--6.0587454479500806 0.0023373313527741526 
-0.53306306923973423 1.7041442340827282 
--0.003988807742569378 0.99601913698419464 
-4.7755884769934873 118.58007573876181 
--2.7457439063832947 0.064200523996306311 
-6.1068646246586908 448.9289454982806 
-6.6549388962840865 776.61046785147892 
-7.1351697319073821 1255.3500436364557 
--7.9432374884166368 0.00035505512870572257 
-7.2598126862560761 1421.9901539537771 
--5.4890403670137395 0.004131807290951816 
-4.0303416002563139 56.280133271767667 
--9.0305801239082761 0.00011969303623517353 
-6.0761082618961133 435.33169679993199 
--3.8361059591609017 0.021577461477929914 
--0.077083895300694039 0.92581217905712787 
-8.8065437408792562 6677.7991312896756 
-9.6367724363256819 15317.824607700535 
--3.5367007943017441 0.0291092060915507 
--6.8993440127720422 0.0010084467403006414 
-2.2859655940534331 9.8351784302776153 
--1.3826454334905609 0.25091389826763089 
--7.7621505368766677 0.00042554045551614723 
--4.9192648273280035 0.0073044989413128866 
--3.5725849990684573 0.028083164815565633 
--6.1434473559861846 0.0021475076196005283 
-0.92698273701103417 2.5268734222150324 
--4.896457233329798 0.0074730113642310228 
--2.8220917186877053 0.059481394150361834 
-5.6736582853846524 291.09750663236645 
-6.3749999157769395 586.98538150400145 
-3.2560729997854914 25.947441201168186 
-3.6402114952799884 38.099893821061343 
-7.8553175791904799 2579.4141518142333 
--9.3624660909925126 8.5888029636741671e-05 
-7.9755668888032645 2909.00648797339 
-8.9244927991957148 7513.7713754645592 
--6.9592635938201797 0.00094979575253151076 
-9.8707443236195971 19355.740548231734 
--4.0685794247560416 0.017101665462367899 
-6.3642132118433068 580.68777027628391 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_expm1_testdata = R"(
-7.2785195995689129 1447.8415710143745 
-2.366332077173336 9.6582269463942403 
--3.5606467171352492 -0.97157956121517586 
--0.17061262400340027 -0.15685187443626322 
-9.0116037506047135 8196.6577368773214 
--3.1586264419618679 -0.95751594466196344 
-6.9669726201829505 1060.0058159606147 
-9.755790064602003 17252.841004526948 
-4.430632943912439 82.984557605430226 
--3.7233107084195876 -0.97584613109042229 
--7.4138964797669553 -0.99939718275277423 
-1.3026109864766884 2.6788896697469449 
--2.1038593989756196 -0.87801526914106331 
--6.3807848269769298 -0.99830620689968053 
-1.3683994197101761 2.92905688892876 
--6.5056198379652193 -0.99850498619484573 
--1.2174791473902964 -0.70402466250124929 
-7.9202531992202267 2751.4678802282951 
--7.9452471211503006 -0.99964565768521618 
--4.0663542919695956 -0.98286023869267047 
--3.5299179967612702 -0.97069268093641381 
--9.4011141792540567 -0.99991736805255349 
-4.8484221574918465 126.53899455572926 
-2.6350945115480968 12.944630329485166 
-0.48684341577914125 0.62717180000103556 
-9.6324056580769088 15250.080897935037 
-2.9978574043377613 19.042547809492476 
--8.2273199648701443 -0.99973274838495285 
-1.510874123946266 3.5306894480247988 
-7.224008720280672 1370.9779274344746 
-4.0541618165490831 56.636832504914771 
--1.678619711718305 -0.81336859652428384 
--6.2124615246539197 -0.99799570224138578 
-6.8877991152232489 979.24164247393242 
--2.9355689646658254 -0.94689950159742797 
--5.3686492413573719 -0.99533957783386795 
--8.5888454219103512 -0.99981382908752836 
-4.0640592686038239 57.210122667236917 
--4.9561032158544496 -0.99295969098679582 
--5.9098283202853015 -0.99728734744517067 
--6.3259315785228729 -0.9982107013982594 
--4.3672929638437727 -0.98731446567007142 
--5.8166177775004142 -0.99702234076132157 
--6.9984403117045666 -0.99908669467310551 
-6.2082258085123847 495.81901682125948 
--6.3033009037825902 -0.99816974669519709 
--2.3256560573460741 -0.90228068645649862 
-4.4500477865822887 84.631035918974845 
--2.7557990622784621 -0.93644178759762708 
--4.9928781119626233 -0.99321389481172317 
--2.5469210679088032 -0.92167755537135176 
--0.50084405366280293 -0.39398106871879013 
-5.3568154675329431 211.04859445505568 
--0.59558062259281286 -0.44875759086515238 
-1.1070027891061258 2.025277398028722 
--6.9176381341885653 -0.999009834180274 
-1.5182269754900481 3.5641257102206003 
-4.638080676931903 102.34580312482282 
-8.7261234405613735 6160.7951871799969 
--2.7797024520914739 -0.93794303044796901 
-6.8834094637367187 974.94815364497993 
-7.9008863251146835 2698.6740571055398 
--5.5905060650860658 -0.99626686182431656 
--3.450301142631905 -0.96826392214711055 
-3.4845368017136167 31.607319956598332 
-3.3489627529503156 27.47318459486851 
--3.5039109739049623 -0.96992048711171008 
--3.4812110847058122 -0.96922987676767636 
-6.5813337938074348 720.50102135143982 
--5.7145734121068585 -0.99670244308048428 
--3.9369804934046009 -0.9804929724938477 
-7.3901352309064947 1618.9251620703744 
--4.6447518057859618 -0.99038808501466946 
-1.5270062650291329 3.6043718992960891 
--7.8213704943928999 -0.99959892836045927 
-6.4281800402285505 618.04628283991337 
--0.69164092280969669 -0.49924630363688116 
-0.33552645342220444 0.39867652947813442 
-6.5856977784649224 723.65652100714965 
--6.4603844342263024 -0.99843580573501856 
--9.0852469025179072 -0.99988667456272107 
-2.8338150329050684 16.010231788298267 
--8.4216985005623695 -0.99977995940382403 
-1.2913883152282608 2.6378335112211153 
-0.11638769002248317 0.12343133083421312 
-6.2950056039749462 540.85888294819131 
-1.0009374723924509 1.7208313374885706 
-4.7199528111755225 111.16295970470745 
-7.7318371687093155 2278.786708591897 
--4.0500950062325245 -0.98257928051605636 
-3.0235857818850871 19.564900881107384 
--9.5675220448417058 -0.99993003546203929 
-5.2275034387359316 185.32704548114762 
--0.17443621884843097 -0.16006957574948999 
--4.6638766757043024 -0.99057016496101291 
--7.8594568320290268 -0.99961391647736741 
-3.493388601553896 31.897234666669902 
-6.9804515638706945 1074.4038709040153 
-1.1987895950859375 2.3161006680355629 
--0.070018595874257628 -0.067623518611072395 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_fdim_testdata = R"(
-949626088.58840704 797372100.38247943 152253988.20592761 
--284752733.29391384 -317612449.43753839 32859716.143624544 
--626070267.16017079 220650485.51293588 0 
-521112846.6289351 -724195104.95354652 1245307951.5824816 
--165111333.77398849 -645273526.96751189 480162193.19352341 
-960661967.23698163 764056644.92470741 196605322.31227422 
-927331056.58390999 992446968.37931108 0 
--8240221.0090721846 -367390564.42852676 359150343.41945457 
--802997275.6734091 722181474.60001016 0 
--436328218.9441874 113154834.93198681 0 
--147239592.62834632 -272913806.28609204 125674213.65774572 
--116759516.36904812 401902949.61968398 0 
-160102685.90908432 186827990.69552159 0 
-324220484.89466238 -235026547.66286016 559247032.55752254 
-405454230.01188326 100632650.1886456 304821579.82323766 
-369689418.89643359 725026375.15958977 0 
-947406480.90986967 -359719310.84273922 1307125791.7526088 
-980508547.7420094 -638103046.43972397 1618611594.1817334 
-870096598.44920182 -597313576.29477692 1467410174.7439787 
-755442360.63794446 880040414.04542232 0 
-731197502.45690393 456772086.78241563 274425415.67448831 
-24905363.923371792 -329928830.01077342 354834193.93414521 
--389928262.20066011 -153967744.17301059 0 
--7500833.1851917505 -668317879.98356843 660817046.79837668 
--882984384.32704628 584433459.30543709 0 
-844247113.91200638 -583619230.90421844 1427866344.8162248 
-155404235.84963536 -276793886.55751693 432198122.4071523 
--454122218.84267569 -729043762.42247844 274921543.57980275 
--493194723.88566202 886269335.00607085 0 
--813872589.93076837 23596195.342110038 0 
-203984552.8439362 829864213.35390687 0 
--394326571.61955714 522284875.98543072 0 
--895606679.80225337 -918572756.76716638 22966076.964913011 
--226448629.73847914 -194914389.97486424 0 
-611939453.25376439 657116393.26796722 0 
--14562250.79089272 290823463.53261232 0 
-908408419.10446072 32804972.146302462 875603446.95815825 
--494075385.29887176 -570103232.26683307 76027846.967961311 
-700422033.77440453 923368541.45314884 0 
-445496860.77114558 -236310695.00674522 681807555.7778908 
-476596694.15754557 -458348600.15305829 934945294.31060386 
--1730142.4434278011 118852407.19642329 0 
--690026026.38080859 392396185.04004669 0 
--905459434.85016894 -254521183.69744492 0 
--358447673.07934105 496242611.50003576 0 
--386521687.54296649 -491339910.83672047 104818223.29375398 
-73814128.819424152 -379436751.03420675 453250879.8536309 
--970856915.67545092 -33856310.151632786 0 
-264907886.29920626 -519676898.12272024 784584784.4219265 
-578222477.21052527 141736868.77827573 436485608.43224955 
--655801594.4351182 720020040.49640489 0 
--978285492.71873844 521558681.24080276 0 
-604889117.29391289 781325213.19799209 0 
--989989354.48664701 -161446453.23415613 0 
--894190598.23965836 409919092.18072414 0 
--499126952.17004657 -72667062.171422958 0 
--810629228.68871927 -630132525.16320443 0 
--724995383.22072649 789359682.30830169 0 
-140894307.59487319 -329168166.09818637 470062473.69305956 
-170501062.54555297 7711390.95809412 162789671.58745885 
--333764127.38953137 -193881961.86594427 0 
--710734452.1173768 -545647339.85393441 0 
--3295904.5109378099 -78114506.395124793 74818601.884186983 
-101096030.75702477 703584696.39016962 0 
--621450846.67614913 -514291696.71777016 0 
-925346815.61552191 -386882607.16555595 1312229422.7810779 
--220340620.33577585 158993984.19428468 0 
--597903655.65509129 193404534.50140738 0 
--678257475.80625939 206123338.90164328 0 
--30162937.587770343 -915093646.76911521 884930709.18134487 
-977365762.92902899 -717122561.02001047 1694488323.9490395 
-22327839.618311524 63513266.983111501 0 
-313496573.53582478 852730543.50852823 0 
-70756139.730823636 106012522.8153429 0 
-327078977.35620379 -583086534.25673676 910165511.61294055 
-286288620.60739326 -760050426.04740071 1046339046.654794 
-435543203.47304893 671361554.94138455 0 
--507696824.21018243 -489262839.78091043 0 
-861500350.64079046 -291842220.34563458 1153342570.9864249 
--247758754.28781736 -806914011.02328038 559155256.73546302 
-800985254.36741662 -313091397.97110927 1114076652.3385258 
--851325176.89106798 -975462578.08829832 124137401.19723034 
--388598217.99877679 98793339.792119026 0 
-506537087.66944408 270213445.29499316 236323642.37445092 
-515965776.78738093 51977137.210186958 463988639.57719398 
--692942152.56475163 -728642336.67200553 35700184.107253909 
-280133237.04180598 -167398216.69620931 447531453.73801529 
-348080911.88409686 634261391.17509317 0 
--175226576.57433093 -516686957.0554536 341460380.48112267 
--774567312.52000785 271355727.11262918 0 
--918323384.5308063 620832941.0304029 0 
-19409386.634647012 234105768.90520597 0 
-17654336.416274428 195733446.47710109 0 
--682883059.11053157 -586674012.56291437 0 
--114490343.68764389 527526813.73529744 0 
-41782962.243692279 660840684.54780293 0 
--95498981.225456715 51784299.221956372 0 
-178458739.93292451 -546055530.32058573 724514270.25351024 
-871091884.56542993 -332210158.14947844 1203302042.7149084 
--117990205.14883614 -282926747.13981116 164936541.99097502 
-)";
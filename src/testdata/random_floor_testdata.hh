@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_floor_testdata = R"(
--551058794.29160762 -551058795 
--588010832.48695803 -588010833 
--591664095.68824005 -591664096 
--264764365.73793042 -264764366 
--130743487.57993746 -130743488 
-279773453.3164649 279773453 
--209967416.30618811 -209967417 
-891651454.43891525 891651454 
-891527441.01587939 891527441 
--779610250.90870237 -779610251 
-934102867.88296413 934102867 
--252048994.92209888 -252048995 
-863732070.96251893 863732070 
--253288405.31400168 -253288406 
-751724112.87651348 751724112 
-25120208.843754053 25120208 
--37726793.200571775 -37726794 
--63973718.778861403 -63973719 
-34688051.018694401 34688051 
--624564941.26046371 -624564942 
--110840497.69462383 -110840498 
--68522146.543190837 -68522147 
-668784178.0855906 668784178 
--794595964.03552508 -794595965 
-631702512.34536624 631702512 
-434570458.93731976 434570458 
--696924600.41271603 -696924601 
--487861367.27491349 -487861368 
--390263587.94393361 -390263588 
--455166734.50994027 -455166735 
--417648080.65584588 -417648081 
-621519059.31693435 621519059 
-955313346.68926287 955313346 
--237689119.34473443 -237689120 
--519109552.0385142 -519109553 
-898430485.13516426 898430485 
-31036334.313474059 31036334 
-307781955.91866422 307781955 
-700767588.93765998 700767588 
-820825531.73781443 820825531 
--961715161.32674229 -961715162 
-479841550.83407879 479841550 
-248419553.20245457 248419553 
-695164501.43754387 695164501 
--93524529.54497087 -93524530 
-426247261.32108569 426247261 
--905099678.47391975 -905099679 
-293546951.38776612 293546951 
--501902859.95207381 -501902860 
-161224332.09102368 161224332 
--436760204.09602773 -436760205 
-340493125.84775591 340493125 
-177551008.55034876 177551008 
--271915212.8285569 -271915213 
-899669094.47843075 899669094 
-784376680.35743999 784376680 
--348597147.65907705 -348597148 
--56219942.819437265 -56219943 
--462966507.05461431 -462966508 
--56008172.905933499 -56008173 
-461100215.78325033 461100215 
-565641784.00488186 565641784 
-500294817.70239949 500294817 
-550140528.87955403 550140528 
--768171784.39360714 -768171785 
--538089449.16001391 -538089450 
-249661868.18366742 249661868 
--230588508.49169707 -230588509 
-200977260.1523788 200977260 
--923432823.34231734 -923432824 
--442877986.18628395 -442877987 
--412372254.72010815 -412372255 
-368928871.63511944 368928871 
-230692636.36136913 230692636 
--987586350.64079547 -987586351 
--484025743.17874479 -484025744 
--613571446.23266733 -613571447 
--858939945.41615415 -858939946 
--51368577.849547267 -51368578 
-607766557.18846893 607766557 
--417242585.35383356 -417242586 
--438665826.61562252 -438665827 
-243308233.5167408 243308233 
--65494026.720868826 -65494027 
--445879426.08146274 -445879427 
--687622288.17898953 -687622289 
-850278521.63986874 850278521 
--69959618.453480363 -69959619 
-202532411.65589261 202532411 
-369116853.06910014 369116853 
--794746915.93699908 -794746916 
-422096374.39563537 422096374 
--467337903.99161959 -467337904 
--192660672.51128173 -192660673 
-148798965.56425595 148798965 
--321341270.68447983 -321341271 
--217918062.49601042 -217918063 
--543785158.94097447 -543785159 
--489776013.03610164 -489776014 
-682965845.5019021 682965845 
-)";
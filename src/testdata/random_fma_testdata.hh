@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_fma_testdata = R"(
-2082.8093228616499 1758.7760855848314 77.533175618810688 3663272.7610578248 
-411.87309898591081 4106.8026349712154 -1573.4755721292697 1689908.0526169694 
-2842.7712814461779 3380.516735984932 176.66368153237383 9610212.557187669 
-353.64989221747533 1122.194209638471 769.81268528670591 397633.67397100688 
-3323.5028584194761 -5783.3340376665665 -1933.1602918283218 -19222860.365671311 
-39.584758055722283 -3415.1474170479278 498.99651609457408 -134688.78771237252 
-1937.6009213139589 1052.8567600946087 2612.7203828813986 2042628.9487538252 
--1360.7701211920225 -62.692547101774593 -1473.5424284664796 83836.602489051918 
-1012.0245266548649 -4411.5590508790647 -2477.6849248244798 -4467083.6452006949 
-610.49503704416622 -47.179591638026679 -2931.631388494025 -31734.537933279757 
-2782.7415941848744 2478.7839112104607 -896.37913741574835 6896918.7135841995 
-713.8955250776645 -368.80418236080334 438.73457071123607 -262848.92084659322 
-552.8197040985491 -1819.4199958481561 1496.9861864507091 -1004314.2375493103 
-7205.953503937837 4023.6376222390559 595.21415932061575 28994740.836708952 
-827.0607959264911 -3008.6348099894526 4281.6147151755904 -2484042.2858868483 
-3426.4491409636566 1476.3998688851955 3161.5448168198536 5061970.6072773533 
--776.43184825949629 1353.1181892414156 4547.6946878849822 -1046056.3618983702 
--6679.5830859846119 -1863.1977184570155 -2236.6494904872861 12443147.316560112 
-464.87263120088159 -1103.8974812803756 4274.9664845290654 -508896.76021430508 
--2560.0688858976973 -4739.9565039346435 2534.6173748722344 12137149.78360638 
--7843.7825194722782 -1773.1990772958295 -3898.5768627923185 13904689.349174608 
--2419.0842366955085 -3370.1059467586019 980.65281082869058 8153550.8246083548 
-118.52270717178673 -6209.4964809196954 1975.4755201149549 -733990.85757217032 
-873.73456491756417 -2070.2651156921215 -1349.1766006609707 -1810211.3667239274 
-386.82227942868712 1988.0436383663614 731.8607650954084 769751.43256167183 
--1396.4627120183413 2680.0629685810359 1143.5795568875699 -3741464.4219277124 
--2903.0861567213888 2079.9330031673858 6.7663019869758436 -6038217.9421011955 
--619.17391803425346 2581.9765975748192 1234.6942447487429 -1597457.8719484031 
-467.74919433140536 632.5651288115605 -2759.9656101698888 293121.86375357921 
-1486.6523068398446 -4674.5239019249493 4574.8516678047017 -6944816.890506913 
-888.77438201173777 1304.1171715906869 -1728.388910787276 1157337.5443406207 
-1686.7261525023146 1967.0283457624625 111.93503233411842 3317950.0885432451 
--2281.959105460046 -2019.4883369361628 -8.7931011646777595 4608381.005740677 
-3431.8414040260441 1782.5598996375359 -3521.5594271693726 6113941.309305436 
--4053.3598492853162 6250.9617797859719 616.44107397299297 -25336781.056527566 
-3972.1278855772257 -3639.6594073023189 -2235.0139684065493 -14459427.639717424 
-1479.1024107442486 2499.5526835770752 -1649.0981472003948 3695445.3019139073 
-3880.9318809560582 281.1381660150227 -103.17385672826822 1090974.8975844902 
-1927.3766436817648 -2043.8118932733776 -2835.5828079475273 -3942030.8899820633 
-2312.4772881988265 540.26416045586359 2694.2818723537457 1252042.8825543448 
--912.24025550290719 -2953.4310404665844 5316.4688434593536 2699555.1558089135 
--3072.9121277146774 89.009969120667535 -6929.0918083732431 -280448.90540678147 
-3020.5373904966805 -463.79413216803516 3443.3042287031849 -1397464.2134778062 
-1971.7254491683304 2557.1434770604737 -2675.3562373286481 5039309.5146575999 
--4816.3411259576142 -2025.0476264930908 1986.6101094463115 9755306.7756109741 
-1392.8333181992393 -1078.612053775975 3450.1991257698114 -1498876.6067847179 
-3053.8601559699136 -1946.1559375876277 -3973.1693654532214 -5947261.2444685791 
-2419.5648236456905 -2680.5208553673619 -3312.232138043606 -6489006.2028335705 
-1608.752450544795 5031.3368937502828 1609.8648207169019 8095785.4221579209 
--4493.8352715004521 3331.2699972225278 -1157.4329968508889 -14971336.04540666 
--843.2829596683124 -1933.8628956614734 -1115.7930038633201 1629677.8332422769 
-841.88623576554448 -822.65794525346212 945.91384063900148 -691638.48701141565 
--1954.02762263979 2667.3659235316491 -5034.0698260800491 -5217140.7640950158 
-5380.5350010492384 4712.3496562707423 -1307.7842454859979 25353654.478501592 
--5257.1309576197636 -5049.6865411965546 -13.293506997117923 26546850.148493279 
-4872.1933044275138 40.297590896118585 947.34142624494132 197284.99397487304 
--4844.0423209724422 -332.47587748051933 -3454.6024346137078 1607072.6187834705 
--3115.2396040180665 6528.6475065752247 6554.653967125475 -20331746.619189814 
-2360.489706641923 -6032.1602200879424 -167.37459956300924 -14239019.482932027 
-7024.2215566318173 -1389.1559170601085 505.84736117648032 -9757233.0907750782 
-619.54113259378585 -3787.0870090703734 -4756.6615181174202 -2351012.8363487893 
--1530.5974244484541 -1283.7040230531486 1653.0343210064018 1966487.1057602747 
--3675.369325896243 -3220.0709935019822 126.8624242721488 11835077.019149698 
-959.0533565445528 -3228.5963623001553 -1200.098485599588 -3097596.2766770967 
--3685.7513553969679 1547.3149392814205 799.48581209316228 -5702218.6488703797 
--249.96173762923948 -1475.5261255694049 1350.1627023656295 370175.23696703347 
--379.22951255555074 -3052.4546908960906 -1122.7500122820161 1156458.1545141467 
-3216.7736221759692 -1459.0438344876802 623.22019682734276 -4692790.5001816228 
-347.91873172913307 5760.803271727279 4356.6152996072633 2008647.9833400026 
--2044.2989127273427 5109.6782130227002 2573.2009946735684 -10443136.414274223 
-4775.1815635412977 -2501.246800090471 1216.0035733246218 -11942691.602085358 
--4494.6893638999745 591.95672290336768 -3812.9771371982501 -2664474.5634600492 
-610.57280243063451 -2289.8471744701478 -531.50074977393592 -1398649.9072038822 
-1998.0790484362035 -1506.1679806477628 2640.8063949095899 -3006801.8791628503 
-1057.8130310636127 2227.2005851728882 -2227.5049639673507 2353734.2968244175 
-6634.7479157111684 -884.79728457851047 5493.3607910434148 -5864913.5788931306 
--8839.2448178689119 -205.03253156320375 1533.2209474135525 1813865.9630620063 
--1614.7289641637544 2452.5135396802179 439.1871343538038 -3959705.4603910674 
--5146.3925604279802 -21.217604934434473 -1272.0183325409282 107922.10585213265 
--4122.3349425048555 -1513.8824620573416 -248.54983620859636 6240482.0223480519 
-1446.8181699415056 -656.83715549272586 -926.50038670092567 -951250.43164627068 
--5395.0753987133985 1300.5410206491988 2074.4681681018951 -7014442.3973540049 
--2029.1470511458181 -1298.6170158299249 6318.4204405300443 2641403.3086796044 
--5516.247630503749 28.089781784268556 4770.2318917944358 -150179.96031704434 
-693.80262541537525 1631.9453358947915 -1463.7820148781539 1130784.1765633046 
--1531.3432061234842 431.83730756943243 4722.2409058203575 -656568.88619128743 
--3480.2941736078983 3217.1170562961706 -2773.8136955136656 -11199287.56053767 
--5413.1671250680411 643.08676766145891 -3554.8736666403174 -3484691.022937919 
-335.00234623774725 -785.79070108704241 1557.020994771417 -261684.70752119212 
--3807.2926233798721 1595.1430823172589 -85.715190352585978 -6073262.2057322841 
--1435.6015719005247 -2081.3081963752679 -787.73478450767607 2987141.5835412731 
-2370.6172685411439 -2222.1084088310013 -95.595258720146816 -5267864.1618039757 
-1359.7787183257242 1346.2572032836431 -1865.3905352404392 1828746.5038825658 
--1435.8811930775421 -4032.9000009708584 -3956.0229403557969 5786809.2420161013 
--1147.4474911186965 -1144.482186107208 -4543.9467097986517 1308689.2663689582 
-1486.5002428701243 1789.7018868255175 -2925.5285792550389 2657466.7608519965 
-3186.5785183191538 1569.0017862733898 -344.59382963301454 4999402.7935135309 
--2033.7860719466405 -470.43738027310064 35.237310449636695 956804.22903294698 
-1410.221858325046 -5676.6333751765378 -1593.1367362586032 -8006905.6041076938 
-1538.5490807246849 4120.4631458891645 -3159.2292047648502 6336375.5560629526 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_fmax_testdata = R"(
--959869859.14591694 -701316711.08085465 -701316711.08085465 
--491945368.43913031 -674254492.13297081 -491945368.43913031 
--371421389.28526914 -675148463.63762021 -371421389.28526914 
-624867801.71256638 402861458.83905959 624867801.71256638 
-314557545.03016353 -467996803.60273612 314557545.03016353 
-734618695.32762051 -949160846.83192348 734618695.32762051 
-828671007.48848939 -902634542.95674586 828671007.48848939 
--748855921.50656939 764639976.0968864 764639976.0968864 
-825508036.25903749 -632284810.6428256 825508036.25903749 
--851231491.15629768 -695780438.9328773 -695780438.9328773 
-765929858.65832496 -154738042.21404767 765929858.65832496 
-679913440.52562928 751479773.99015331 751479773.99015331 
-320412059.23892403 621386984.4668963 621386984.4668963 
--722560326.06963372 -508267996.15191424 -508267996.15191424 
-813970691.5744741 -303145146.04681718 813970691.5744741 
--244419791.68468595 -387121608.95535028 -244419791.68468595 
-629004042.57875705 -197951314.31823075 629004042.57875705 
--124547566.52635574 519187886.42845869 519187886.42845869 
--776366738.91051459 -606714913.28434634 -606714913.28434634 
-586689841.62580085 -111159218.59084105 586689841.62580085 
--355319393.86713171 -232044761.40135324 -232044761.40135324 
-442827903.12418103 -271241014.98473275 442827903.12418103 
-235037816.03628063 -406189205.06621087 235037816.03628063 
-900536696.71525049 -688492543.47756851 900536696.71525049 
-122678331.75603199 -385956318.93881989 122678331.75603199 
--941638244.28721797 -715531309.82689297 -715531309.82689297 
-804838281.9218874 442758333.42447972 804838281.9218874 
--72441375.340168595 793523095.73726749 793523095.73726749 
-649765396.71157908 73910175.691242695 649765396.71157908 
--286851361.38092065 345632179.51366735 345632179.51366735 
--442522309.0957123 563660387.32154584 563660387.32154584 
--210998951.8259362 318797179.66151571 318797179.66151571 
--226423018.5879283 215385866.91639853 215385866.91639853 
-400094012.86350036 175306360.55469942 400094012.86350036 
-661104001.38922334 468635000.91088986 661104001.38922334 
--969817913.69926989 241872369.87368178 241872369.87368178 
--87712236.963003159 -470962898.02307123 -87712236.963003159 
--312500984.46142101 179873392.73804069 179873392.73804069 
--871121400.47792983 -516880361.74481839 -516880361.74481839 
-570728548.36662364 -536960497.68037903 570728548.36662364 
-168793180.43399596 -40168045.241822004 168793180.43399596 
-957573810.12822771 241716722.43158698 957573810.12822771 
-623550901.25079226 -664925239.48254287 623550901.25079226 
-4780609.002573967 618339964.65171909 618339964.65171909 
-587677229.98084855 993375670.3772223 993375670.3772223 
-864682073.31358814 517506478.60919881 864682073.31358814 
-818499132.69643855 575159931.7606678 818499132.69643855 
-244732209.98791289 -221127748.28098083 244732209.98791289 
-535611018.8730545 -764022150.70245445 535611018.8730545 
-871308979.82926607 -693264226.72468638 871308979.82926607 
-543945265.22973275 -259575424.24861729 543945265.22973275 
--18820983.766384244 190289096.43713236 190289096.43713236 
-822735334.65222025 875515289.71530032 875515289.71530032 
--242561445.46897018 470830033.27308559 470830033.27308559 
--304188935.82396555 28098859.750044227 28098859.750044227 
--464831506.84394348 380120474.87055349 380120474.87055349 
-980709931.7019608 443723306.5860455 980709931.7019608 
-502325619.52251077 -183273173.48375356 502325619.52251077 
-793367320.39608216 -647966282.86705256 793367320.39608216 
--924619240.80013835 -150723841.93396688 -150723841.93396688 
--33480631.498645425 64619895.640181065 64619895.640181065 
-172141369.23434091 -711050717.51919961 172141369.23434091 
--805302013.46397853 889182100.80675364 889182100.80675364 
-453117265.30140996 517318813.91462374 517318813.91462374 
--939555123.72400212 916346076.48681736 916346076.48681736 
-831169670.72609186 20863727.681333065 831169670.72609186 
-182823561.45901775 -575441613.50018644 182823561.45901775 
-76009754.660571575 -33024470.170722008 76009754.660571575 
-734996022.03897047 -221515777.53915751 734996022.03897047 
-56369042.148228526 -234743194.22809505 56369042.148228526 
-26605851.811006784 1254283.5502440929 26605851.811006784 
-30569970.389740586 64110145.656722546 64110145.656722546 
-893433160.09002519 -177989767.79672658 893433160.09002519 
--754315616.42614293 -588785931.26434994 -588785931.26434994 
-769038209.48495817 -459194831.852512 769038209.48495817 
--289306034.49386752 776298264.54128504 776298264.54128504 
--573965716.11922264 169439363.71571469 169439363.71571469 
--512129640.133403 369539667.95931578 369539667.95931578 
--374271604.17937028 243556424.06204534 243556424.06204534 
--104802271.12375689 413621064.59013152 413621064.59013152 
-765707754.47353649 934335232.79613805 934335232.79613805 
--216542351.25508773 748722835.2888124 748722835.2888124 
-548868033.11790824 -235447988.22193873 548868033.11790824 
-87443677.640891314 326924269.77815938 326924269.77815938 
-293389407.21746993 942655194.20740819 942655194.20740819 
--159997410.29373229 242307491.84223986 242307491.84223986 
-275335941.03889871 -344711413.06308877 275335941.03889871 
--335928812.59760833 863167456.5812161 863167456.5812161 
--386010478.50816405 -980179684.82073247 -386010478.50816405 
--363287404.03454077 666280526.15357351 666280526.15357351 
--310495970.43166721 416242917.83915138 416242917.83915138 
-391893481.5974369 437944153.04977179 437944153.04977179 
--254828306.33041215 -689936435.50493765 -254828306.33041215 
--467872704.30240601 97469820.48823595 97469820.48823595 
--364082132.44138694 -764536116.25383449 -364082132.44138694 
--912009596.56705582 -502323269.29479432 -502323269.29479432 
--317461346.41239798 -760829426.35610843 -317461346.41239798 
--372529091.87927735 -789138819.29469633 -372529091.87927735 
-317381790.6711762 -887850942.54718673 317381790.6711762 
--446247134.32748294 936335523.59218192 936335523.59218192 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_fmin_testdata = R"(
--506885602.8635425 431269306.46259975 -506885602.8635425 
--209194793.24689066 485435860.13684773 -209194793.24689066 
--767233162.95992172 716636370.86961532 -767233162.95992172 
-168895111.31822658 -934930904.63481295 -934930904.63481295 
-361565808.86405778 -372707577.69441593 -372707577.69441593 
--339174692.34322989 -271305033.4901396 -339174692.34322989 
--948815971.79497921 208860166.41088247 -948815971.79497921 
--818504331.19980288 -7283287.5916699171 -818504331.19980288 
--807246239.51213193 649217201.57630277 -807246239.51213193 
-206035840.1893692 127904417.60849142 127904417.60849142 
--331911575.98144591 -719463004.23637879 -719463004.23637879 
-766472845.49083877 604176363.645684 604176363.645684 
--80561191.018566728 649913933.11917806 -80561191.018566728 
-21478957.140699267 -313438366.81368673 -313438366.81368673 
-615174914.87555003 -749250189.265396 -749250189.265396 
-127927404.18730187 -959786503.24441469 -959786503.24441469 
--715568101.44334745 130788735.8594532 -715568101.44334745 
-8765475.5612323284 -393189432.97826982 -393189432.97826982 
-580115687.20410919 -548954683.6418035 -548954683.6418035 
--901073251.37747383 196762187.03815341 -901073251.37747383 
-662922562.20101142 -353597370.46090996 -353597370.46090996 
--109804551.4674226 -258750400.75262916 -258750400.75262916 
--846970278.63439727 433505240.91591382 -846970278.63439727 
--84231226.202984691 306090541.5609529 -84231226.202984691 
--322863833.56833386 583687214.40496874 -322863833.56833386 
--531353889.91932422 374481018.32332134 -531353889.91932422 
-979392580.89930129 -777823794.22689772 -777823794.22689772 
--951431303.93954968 630177797.79480052 -951431303.93954968 
--805729674.62568247 810721743.66386819 -805729674.62568247 
-234690989.08658791 -285541604.51067388 -285541604.51067388 
--223591224.64892328 980098589.50046563 -223591224.64892328 
--144849440.88143456 -496520674.26811731 -496520674.26811731 
-490155952.37930179 854800175.13312984 490155952.37930179 
--611614026.85136938 -861341782.52693903 -861341782.52693903 
-677596999.86103678 -878360825.16472661 -878360825.16472661 
-14356203.562054753 -388247219.11406922 -388247219.11406922 
-443094348.63960719 -307067849.8596257 -307067849.8596257 
--394854352.66007292 -161114201.7259078 -394854352.66007292 
-408718677.13619137 -390320117.41505551 -390320117.41505551 
-834671385.85326743 846699086.39937186 834671385.85326743 
-799958849.71376061 446013586.09079885 446013586.09079885 
-735277160.6794343 -804855523.25966573 -804855523.25966573 
-457695333.02613974 -241606287.45745468 -241606287.45745468 
--350093342.28630733 950723963.61409974 -350093342.28630733 
-287925410.04595518 958696758.00265145 287925410.04595518 
-114123055.50227785 144331201.63454914 114123055.50227785 
--42710089.64435637 -427646630.48574829 -427646630.48574829 
-868344532.49200392 803447627.06536531 803447627.06536531 
-942572998.13057899 109739033.72259688 109739033.72259688 
-243017979.26423764 937656765.31249785 243017979.26423764 
-411293237.53813219 -106709876.97376871 -106709876.97376871 
-739085328.81243539 252830650.56555748 252830650.56555748 
--473717557.66371971 689454569.70002842 -473717557.66371971 
--582886261.56034327 796917128.90295982 -582886261.56034327 
-112155781.28594875 181479060.37361407 112155781.28594875 
-40099176.030842066 39872608.822923541 39872608.822923541 
--17583514.442165852 329731673.76836348 -17583514.442165852 
--443724379.75469553 171743006.83533406 -443724379.75469553 
-167475758.40900588 10458325.102943301 10458325.102943301 
--825623365.80965996 316298031.79290462 -825623365.80965996 
-449572845.54584932 -192749463.07403255 -192749463.07403255 
--180705511.51155591 -329194344.0436393 -329194344.0436393 
-344082873.09728765 -615466210.61372924 -615466210.61372924 
-58793725.411243439 -275117180.18462491 -275117180.18462491 
--311599068.42642283 581030046.04966617 -311599068.42642283 
--264932278.82996738 -690152323.68911624 -690152323.68911624 
-537855045.45041418 104995637.46182466 104995637.46182466 
--821081543.79223847 -777701168.95183265 -821081543.79223847 
-841160255.24663496 80522250.119754314 80522250.119754314 
--854518266.31628942 -719957018.0205245 -854518266.31628942 
-815219212.74183559 -206637076.81680548 -206637076.81680548 
-194097734.83070326 -158994471.47339416 -158994471.47339416 
--589182104.98741722 -452283242.39932036 -589182104.98741722 
--4281481.9835743904 571680918.35767126 -4281481.9835743904 
-203827670.01979375 -35572139.006469607 -35572139.006469607 
--222830693.9376725 366105252.56951356 -222830693.9376725 
-738912815.68019152 149588918.39021134 149588918.39021134 
-519066056.49387407 827898247.96123457 519066056.49387407 
--80317323.939258337 590861575.12848663 -80317323.939258337 
-750574496.91641569 577641076.42912245 577641076.42912245 
-524600544.75852919 493827467.55563545 493827467.55563545 
-944641696.45872951 -923215284.16458428 -923215284.16458428 
--702713607.63863444 -192403483.28487241 -702713607.63863444 
-396980072.07748652 734878651.21391273 396980072.07748652 
-541135954.99247241 601817058.92450953 541135954.99247241 
-985911350.48491335 -394332435.82861781 -394332435.82861781 
-141873419.60005379 -794539212.80950916 -794539212.80950916 
--755369472.1510818 582248749.4108665 -755369472.1510818 
--178300638.90712023 -471579330.60003901 -471579330.60003901 
-39691162.083245635 246957876.91258883 39691162.083245635 
-724232418.62096786 146544679.28914642 146544679.28914642 
--502953981.99689549 647638511.32687664 -502953981.99689549 
--580098675.14566565 -304831747.1437757 -580098675.14566565 
-755257086.97017241 71789045.812299132 71789045.812299132 
-495004518.54067063 615982625.65177393 495004518.54067063 
-407786265.15778041 -448111007.99831593 -448111007.99831593 
--732188437.82538152 763462162.47796655 -732188437.82538152 
-29157269.827049971 638310838.83563995 29157269.827049971 
-887513322.2696166 -964253949.09043729 -964253949.09043729 
-863905493.25746608 125556757.25758266 125556757.25758266 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_fmod_testdata = R"(
-196564306.51852608 -566114106.19138956 196564306.51852608 
--864995337.18911839 -830016103.99560142 -34979233.19351697 
-853634087.63238454 30443799.679921865 1207696.5945723057 
-138143599.01967406 513975429.76231742 138143599.01967406 
-750561709.10287976 32948732.126645565 25689602.316677332 
-123688423.01746941 44066361.360090017 35555700.297289371 
--339577215.19330955 610537595.53665185 -339577215.19330955 
--813526261.08505464 -98131563.847636223 -28473750.303964853 
-856880492.00214529 211142596.00907755 12310107.965835094 
-986700899.61086893 -552535696.11589932 434165203.49496961 
-215010024.47201014 -228095887.25823581 215010024.47201014 
-648150265.17131114 -773959359.78449702 648150265.17131114 
-728058766.29993558 31659183.392212391 31556731.67126298 
-902617265.0485456 439985326.28992629 22646612.468693018 
-155064856.87683439 -339218865.71863782 155064856.87683439 
--407885638.47056568 959124406.28098869 -407885638.47056568 
-723550949.32092834 896526874.58452177 723550949.32092834 
-680747446.86994338 758466478.73107195 680747446.86994338 
-40328039.220641136 -347441701.80491626 40328039.220641136 
--661853664.91386199 90147197.213978529 -30823284.416012287 
--436157319.11595643 -955548298.07312167 -436157319.11595643 
-273534710.69433928 -572256166.59836149 273534710.69433928 
-868907035.78617072 496903752.52224064 372003283.26393008 
--497584011.33456087 886023273.60155177 -497584011.33456087 
--354094175.77421474 344715229.61829329 -9378946.1559214592 
--994829305.68269253 -876652065.66215956 -118177240.02053297 
--425643400.58081508 -390108134.38769555 -35535266.193119526 
--451792906.24656916 -42256278.188853741 -29230124.35803175 
--731334976.19348896 811308630.91081262 -731334976.19348896 
-688242011.06349492 -631460632.07860255 56781378.984892368 
--425482013.66942728 -813588133.21660471 -425482013.66942728 
--380683576.3605504 -698460404.67265058 -380683576.3605504 
--204806342.21729517 -314696514.97739971 -204806342.21729517 
--217248949.82378209 -955015841.43112743 -217248949.82378209 
--41039377.907045126 110788277.00293279 -41039377.907045126 
--526649054.33144027 -339957422.64840722 -186691631.68303305 
--861443865.498842 471730210.18566775 -389713655.31317425 
--752483375.60001934 -17056195.090050697 -2010791.6377886534 
--84900096.262568355 -152389732.60635149 -84900096.262568355 
-300155660.31757236 -426542914.20422578 300155660.31757236 
--689968018.73058045 -807059883.56107235 -689968018.73058045 
-155664843.10348892 -92654047.118950486 63010795.984538436 
--358713640.90247846 -531896940.31107813 -358713640.90247846 
-381263101.62020421 32608046.575089812 22574589.294216275 
--253229430.11169112 817109969.15656924 -253229430.11169112 
-345389481.07299757 -799329351.58890665 345389481.07299757 
--744761168.28194904 297269738.42684007 -150221691.42826891 
-592825481.4723289 72292433.434120893 14486013.999361753 
-787709590.4995594 628053952.23746228 159655638.26209712 
--145417954.36584878 -818249527.99278522 -145417954.36584878 
-612249927.92400098 474057936.62900162 138191991.29499936 
-212441542.94117093 -400271290.58853114 212441542.94117093 
-965970394.79261088 -191144627.6233108 10247256.676056862 
--80638911.600070477 177106074.46047711 -80638911.600070477 
--110089953.70115137 -705814513.04922462 -110089953.70115137 
-870144525.47222352 171350025.3284626 13394398.829910517 
-880476645.65553737 -321899866.42890894 236676912.79771948 
--150952079.63398814 -572937053.30395579 -150952079.63398814 
--159269952.87690103 -652432488.22506595 -159269952.87690103 
--596427719.08557475 -218925473.7558136 -158576771.57394755 
-117463417.03175759 -396115218.37689614 117463417.03175759 
--128241398.67292535 -894465177.85793495 -128241398.67292535 
-966672043.94574475 -486184298.20626432 480487745.73948044 
--373586906.99410939 142897914.29044938 -87791078.41321063 
-467439811.21815038 -768941298.37724352 467439811.21815038 
--747037983.24856257 -593440444.03989291 -153597539.20866966 
--88853784.272500515 -238681518.69197166 -88853784.272500515 
-986689353.72015762 -141921678.24786735 135159284.23295355 
--808413443.91978729 -211134069.26285791 -175011236.13121355 
--580056754.00875759 944448286.668751 -580056754.00875759 
-834526059.54550719 -758954769.56031442 75571289.985192776 
--197716138.06624532 -108015236.61125886 -89700901.454986453 
--961681004.61350942 765591065.77403665 -196089938.83947277 
--98723104.623932242 -547912952.04492235 -98723104.623932242 
--82680622.287123084 -881890111.15227425 -82680622.287123084 
--222755026.22856426 -895283647.0908699 -222755026.22856426 
--581829293.85284305 -815832653.30815303 -581829293.85284305 
-350239589.18725753 611464577.36465812 350239589.18725753 
--662165064.81626654 -324698810.8642081 -12767443.087850332 
--974837576.63776302 -489348326.38447934 -485489250.25328368 
--327597057.92235267 384517397.94797826 -327597057.92235267 
-877844661.28205633 948940004.52306199 877844661.28205633 
--872324434.65960383 -357467274.67561471 -157389885.3083744 
--876595983.64780211 778696988.49920797 -97898995.148594141 
--167047071.36926126 -48746915.119922638 -20806326.009493351 
--319521398.95851922 948912034.85711551 -319521398.95851922 
-272789841.93286657 -363761043.89875233 272789841.93286657 
-876882080.03005409 -916698902.53717291 876882080.03005409 
--38219860.805653214 162021099.15520072 -38219860.805653214 
--617991983.052284 -428130141.68466771 -189861841.3676163 
--485675094.70348793 -445641258.53757143 -40033836.165916502 
--717274992.06803846 5610404.3819160461 -4753635.5647006035 
--392920188.8053416 -15011284.068444967 -2626803.0257724524 
-682733326.69149613 -9919279.6108111143 8222313.1563403606 
-40439421.020259023 405678749.67318702 40439421.020259023 
--840381686.71938801 551019707.19064021 -289361979.5287478 
-146099493.50937223 -394329224.4995811 146099493.50937223 
--952055510.36709225 50997610.538019419 -34098520.682742715 
-500583807.92659879 570333939.95597744 500583807.92659879 
-503771621.54086018 -1047174.7607420683 80561.623925328255 
-)";
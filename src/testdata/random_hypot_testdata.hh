@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_hypot_testdata = R"(
--0.81853548367992746 -0.39559568627355324 0.90911841090221923 
--0.020841068868538315 0.84556943172052135 0.84582623156990622 
-1.1050961707503242 0.69514775404708384 1.3055527360331847 
-0.59072174218313256 0.10478174855834776 0.59994282354139394 
-1.4122693078659316 0.59414647495898931 1.5321601194543313 
-0.32075747107460928 -1.1844135786738561 1.2270781884611874 
--0.88420139819351296 -0.83628388420290611 1.2170385563098907 
-0.75021231502228281 -0.91678329535494552 1.1846139152706954 
--1.5346236951684469 0.89039044542611023 1.7742223736269829 
--1.26853485253442 0.82181094487191553 1.5114740822143771 
--1.0765029829109904 0.79764775378159358 1.3398136479858243 
-0.49593820814467771 -0.68153053503250582 0.84287518440125364 
-0.22546681376586619 1.1637549155632811 1.1853947813312793 
--0.91086399645548155 1.5648882262504555 1.8106762219392367 
--1.4532709526355583 0.65080515220231172 1.5923390995348123 
-0.49906489086035055 0.27512660798670141 0.56987754448804318 
-0.25646477659469946 -1.3582507222420235 1.382251498861458 
-1.0457716238687436 0.55476899929285395 1.1838103445507915 
-1.2037257267563035 -0.095543990405177359 1.207511606303449 
-0.81885475472156077 0.545080579776684 0.98368488235806162 
--0.64323519486057579 -1.3243317774370547 1.4722792441099315 
--1.1422345905838081 0.97606728436171597 1.5024670390818611 
-0.915401841121811 -1.1266458287937502 1.451651250909652 
--1.4222736154536344 0.21173862138381017 1.4379483582525032 
-0.14632046740260796 -0.82930299824446729 0.84211230965838557 
-1.1138648215134066 0.51226328212959427 1.2260132588284995 
--1.4732961073543467 0.66537592310963456 1.6165786522775405 
-1.4334224974877112 0.31467907731422229 1.467556805715962 
--0.50822821732906998 1.1146292793384087 1.2250283063047747 
--0.7588559642285283 -1.1533730574794863 1.3806273154493169 
--0.29043694493745775 -0.37438261008356677 0.47383114895243839 
--0.24807261698012195 0.52087457979682661 0.57693184274564613 
-0.33258628023406867 -1.0660519733808886 1.1167275602174513 
--0.19088890182507923 0.2268382412708414 0.29646949344381657 
-0.30163664302458626 -1.0487661781172264 1.0912814306024616 
--0.97749221660896479 1.2901640037888531 1.6186457889864574 
-0.41992097086518387 -0.93774132512527986 1.0274689360852105 
-0.32175333211706225 1.5103608066513652 1.5442522374913352 
--0.28668357926285282 0.66371969879320547 0.72298776835096168 
-0.72241894135135887 -1.5669030377720585 1.7254200232414492 
-0.99904770603300053 0.97522377785358438 1.3961223928512922 
-1.4771439924150078 1.4751433482816809 2.087582877949385 
--0.54017828928019784 0.24243147711832913 0.59208580907454289 
--0.75351835795848976 -0.90803762578215141 1.1799670527673836 
-0.29248818205059801 1.1677630249577464 1.2038354618043656 
--0.10300291743698242 -0.67476100346138201 0.68257747750181519 
-0.38354902819620307 -0.91407393622541777 0.99128251165693471 
-1.1805478050792839 1.1900699849903211 1.676293437692929 
-0.48390217963043058 1.4931592799615769 1.5696133137771406 
--0.1070680506383892 -0.82217850077554389 0.82912065141632174 
--1.2438214411166422 1.54920326935583 1.9867366577290189 
--1.5185112131608287 -0.4901742555309585 1.5956650980956189 
-1.0599297104861289 -1.0912230275982437 1.5212556284635026 
-1.1400051990355928 -0.74420657938269263 1.361416646961785 
-0.21035781125842479 0.44008219109256119 0.48777325026518686 
-1.3307191003943037 1.1884676303567652 1.7841716936887126 
-1.0471439927668156 -1.1332573161320576 1.5429785112419625 
-1.4990225456802548 -0.81109962193307394 1.7043917358276786 
--0.29964535029698647 -0.26853910326893904 0.40236871888740261 
--0.8983187245683304 -0.28067147368622902 0.94114451974777569 
--1.2865065766032671 -0.60078735633580849 1.4198748603931362 
-0.028349102685411687 1.0331530015523169 1.0335418696113041 
--1.3871350528270714 1.2779803589188603 1.8861011246918711 
--1.2977492612129513 -0.3168343904647053 1.3358657028159313 
-1.0439682187399195 -0.26971034978990716 1.0782454797135921 
-1.5657616777275414 0.48691817101470036 1.6397252625682346 
-0.90879989395454608 -1.0395232688684184 1.3807700292846294 
--0.13370513422676789 0.58602998364885117 0.6010891819472971 
-0.76177197281474962 0.46700622481917708 0.89352747724171044 
-0.98875939883746966 -0.62049831282797729 1.1673317030783499 
-0.15493965392949915 -0.18838598889460978 0.2439171522701776 
-1.3606012553902529 -1.100854383982059 1.7501760342611399 
-1.021490965846378 -1.3747284804403175 1.7126944234858448 
--0.32069653523707187 -0.84520231775350485 0.9039984655125024 
--1.0765792575098287 0.40209554193390296 1.1492187444275059 
-0.63852016779339849 -0.33315998811068148 0.7202107902252084 
-0.68160937337650163 -0.05684645838303326 0.68397577274739862 
-0.72718879757568455 0.63545988021161115 0.96571880310892011 
--1.5647798328778251 -1.0909090321269637 1.9075163018326586 
-1.2894609675862974 1.2969682454122724 1.8288893396092556 
--1.2844353823699495 0.41110788226251538 1.3486229800586258 
-0.74203249681360273 -0.8296293368505403 1.1130575290120888 
--0.84961340422897691 1.0098634738504919 1.3197223846184221 
--0.32586347339739619 0.12852206982108205 0.35029262870593014 
--0.85158207354462656 0.05455708724235242 0.85332789931592845 
-0.057275790207715227 1.3638536716850109 1.365055806153215 
--0.2430769595489739 -0.48862188459398359 0.54574513682464432 
-0.96381861954120485 1.5164627174476788 1.7968320747312789 
-0.97091138581451553 -1.3409751714855691 1.6555613337007524 
--0.46883017055389065 -0.8526004786551421 0.97300015674436946 
-0.92676434106556504 -0.67523202004675098 1.1466605534189735 
--0.94529090899494905 1.2641003135160513 1.5784563678669983 
-0.080215993105809291 1.0930855246231621 1.0960248946491338 
--0.44921587686042419 0.82995688060129025 0.94372841839212629 
-1.567370671205595 -1.3432703586055326 2.0642252971184405 
--0.57772906597016516 -0.30794036572362815 0.65467407349669904 
-0.45262630978405483 0.89999924694797073 1.0074071772702662 
--0.31908854580192103 0.77886726274633711 0.84169573661742902 
-0.57155049279941839 -1.2222898149219472 1.3493192200073287 
--0.13456403600604205 1.3759034954578726 1.3824680497571824 
-)";
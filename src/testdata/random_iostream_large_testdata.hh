@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_iostream_large_testdata = R"(
-1.0668633204682071e+307 1.0668633204682071e+307 
-1.4004199470280059e+308 1.4004199470280059e+308 
-1.7592243719337725e+308 1.7592243719337725e+308 
-1.15810542528153e+308 1.15810542528153e+308 
-1.0745758123246744e+308 1.0745758123246744e+308 
-1.4942026643936856e+308 1.4942026643936856e+308 
-7.960514627250062e+307 7.960514627250062e+307 
-6.6250727457095195e+307 6.6250727457095195e+307 
-1.522198250288528e+307 1.522198250288528e+307 
-1.9147823006917444e+306 1.9147823006917444e+306 
-5.7310243320690198e+307 5.7310243320690198e+307 
-1.1264652883939539e+308 1.1264652883939539e+308 
-9.4344509405970678e+307 9.4344509405970678e+307 
-1.3182018822503048e+308 1.3182018822503048e+308 
-1.2721820846793371e+308 1.2721820846793371e+308 
-1.4380320625780403e+307 1.4380320625780403e+307 
-1.4802034757317347e+308 1.4802034757317347e+308 
-1.1438434763582645e+308 1.1438434763582645e+308 
-1.7371654394907356e+308 1.7371654394907356e+308 
-1.3856618020466181e+308 1.3856618020466181e+308 
-1.0833805555177949e+308 1.0833805555177949e+308 
-1.6824863022573476e+308 1.6824863022573476e+308 
-3.2660687482072895e+307 3.2660687482072895e+307 
-1.3567847940937131e+308 1.3567847940937131e+308 
-1.3741780496269279e+308 1.3741780496269279e+308 
-4.8525914060837128e+307 4.8525914060837128e+307 
-1.763949890387202e+308 1.763949890387202e+308 
-1.0292464993848133e+307 1.0292464993848133e+307 
-9.2170742052412389e+307 9.2170742052412389e+307 
-1.3049964944708099e+308 1.3049964944708099e+308 
-1.3922130632846857e+308 1.3922130632846857e+308 
-1.1822456039470187e+308 1.1822456039470187e+308 
-1.266794783290819e+308 1.266794783290819e+308 
-3.3735484445592759e+307 3.3735484445592759e+307 
-1.636970291145349e+308 1.636970291145349e+308 
-2.0746883271328586e+307 2.0746883271328586e+307 
-2.0182744428515931e+307 2.0182744428515931e+307 
-2.1034488161804504e+307 2.1034488161804504e+307 
-1.7608445176654592e+308 1.7608445176654592e+308 
-1.076539209749243e+308 1.076539209749243e+308 
-3.4902897258873413e+307 3.4902897258873413e+307 
-1.6179483518742647e+308 1.6179483518742647e+308 
-1.1793319122574573e+308 1.1793319122574573e+308 
-1.4270386508077495e+308 1.4270386508077495e+308 
-1.5054323957028742e+308 1.5054323957028742e+308 
-6.2301989336497029e+307 6.2301989336497029e+307 
-1.1494782111601971e+308 1.1494782111601971e+308 
-1.189331724623795e+308 1.189331724623795e+308 
-1.1389998739636564e+307 1.1389998739636564e+307 
-1.3688448199792682e+308 1.3688448199792682e+308 
-3.1979570936485144e+307 3.1979570936485144e+307 
-7.9669765849457548e+307 7.9669765849457548e+307 
-7.4118758484471047e+306 7.4118758484471047e+306 
-1.0963945274000471e+308 1.0963945274000471e+308 
-6.7554448416225256e+307 6.7554448416225256e+307 
-1.148999602205173e+308 1.148999602205173e+308 
-6.1383414588823755e+307 6.1383414588823755e+307 
-3.8868021673954256e+307 3.8868021673954256e+307 
-1.4453156498079259e+308 1.4453156498079259e+308 
-7.3207896384945161e+306 7.3207896384945161e+306 
-1.4626184893734218e+308 1.4626184893734218e+308 
-2.8998182237350998e+306 2.8998182237350998e+306 
-1.1929820495575717e+308 1.1929820495575717e+308 
-1.2493682725876036e+308 1.2493682725876036e+308 
-3.9691651953718597e+307 3.9691651953718597e+307 
-1.2556376619594888e+308 1.2556376619594888e+308 
-1.1349310859389806e+308 1.1349310859389806e+308 
-4.1177395443150512e+307 4.1177395443150512e+307 
-1.3796678701435892e+308 1.3796678701435892e+308 
-7.3970450225866952e+307 7.3970450225866952e+307 
-1.3800928048357119e+308 1.3800928048357119e+308 
-1.0191134580526445e+308 1.0191134580526445e+308 
-4.5407608881716927e+307 4.5407608881716927e+307 
-1.3462565614957009e+308 1.3462565614957009e+308 
-1.5247767415482792e+307 1.5247767415482792e+307 
-6.7638688345892834e+307 6.7638688345892834e+307 
-7.822774798004958e+306 7.822774798004958e+306 
-3.7339453118684915e+307 3.7339453118684915e+307 
-6.5360835773814477e+307 6.5360835773814477e+307 
-1.0416148517468609e+308 1.0416148517468609e+308 
-1.3750709423398145e+308 1.3750709423398145e+308 
-1.5762150789341669e+308 1.5762150789341669e+308 
-1.1610208551910536e+307 1.1610208551910536e+307 
-5.7924402872448669e+307 5.7924402872448669e+307 
-4.0406568359723951e+307 4.0406568359723951e+307 
-1.5653848307267889e+308 1.5653848307267889e+308 
-2.2137523797342347e+306 2.2137523797342347e+306 
-1.6323013868506373e+308 1.6323013868506373e+308 
-1.0715759450762583e+308 1.0715759450762583e+308 
-1.2234555107494938e+308 1.2234555107494938e+308 
-9.1531853785656283e+307 9.1531853785656283e+307 
-1.6653997453699482e+308 1.6653997453699482e+308 
-9.9157860297013031e+307 9.9157860297013031e+307 
-1.6699125740041947e+308 1.6699125740041947e+308 
-1.2934871968644823e+308 1.2934871968644823e+308 
-1.3504742833337048e+308 1.3504742833337048e+308 
-1.2728932017990583e+308 1.2728932017990583e+308 
-1.3667064626072059e+308 1.3667064626072059e+308 
-9.1356330002268712e+307 9.1356330002268712e+307 
-6.4225953026227068e+306 6.4225953026227068e+306 
-)";
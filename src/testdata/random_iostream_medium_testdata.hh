@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_iostream_medium_testdata = R"(
-630111048.9591465 630111048.9591465 
--568915243.79152012 -568915243.79152012 
--588024681.73937845 -588024681.73937845 
--518197680.1955325 -518197680.1955325 
--270682400.9900012 -270682400.9900012 
-601435048.58515692 601435048.58515692 
-553796439.78020263 553796439.78020263 
-905635533.68016124 905635533.68016124 
-463836340.95486832 463836340.95486832 
--795745544.61709726 -795745544.61709726 
-101555235.42020774 101555235.42020774 
-547344602.8175106 547344602.8175106 
--187052554.68745708 -187052554.68745708 
--497808236.72480577 -497808236.72480577 
-298194454.492275 298194454.492275 
--616386842.03634453 -616386842.03634453 
--685472958.10495138 -685472958.10495138 
-175836465.68626976 175836465.68626976 
-565200089.68981647 565200089.68981647 
-667367058.80779481 667367058.80779481 
-696579489.21957445 696579489.21957445 
-442051399.4933815 442051399.4933815 
-831688690.56222725 831688690.56222725 
--560021419.88332129 -560021419.88332129 
--241918576.96225035 -241918576.96225035 
--894060490.38172996 -894060490.38172996 
-769055324.46969557 769055324.46969557 
-363012423.71703839 363012423.71703839 
--377331758.29080594 -377331758.29080594 
--211429700.03096116 -211429700.03096116 
--396035585.38158405 -396035585.38158405 
--752929331.23356974 -752929331.23356974 
--319208594.63801479 -319208594.63801479 
--671645197.56132746 -671645197.56132746 
-29495686.028135061 29495686.028135061 
--506336189.87643206 -506336189.87643206 
-75036065.152221441 75036065.152221441 
-341491694.45476794 341491694.45476794 
-986039859.18376136 986039859.18376136 
-316117813.37633634 316117813.37633634 
--320897309.14332056 -320897309.14332056 
--531081336.44829148 -531081336.44829148 
-14739134.621042371 14739134.621042371 
--659369414.77762842 -659369414.77762842 
--567113043.49136043 -567113043.49136043 
-428234479.60019016 428234479.60019016 
-886987172.37573385 886987172.37573385 
-952967459.65768576 952967459.65768576 
-991132513.476331 991132513.476331 
-123391376.4197948 123391376.4197948 
--918186251.22226095 -918186251.22226095 
--107379801.96940494 -107379801.96940494 
--584762314.43974686 -584762314.43974686 
-788374757.19959021 788374757.19959021 
-276256066.16367197 276256066.16367197 
--684072724.33871007 -684072724.33871007 
-614932448.6062994 614932448.6062994 
-402739928.51316166 402739928.51316166 
-959840837.94282222 959840837.94282222 
-567764253.99677968 567764253.99677968 
-278279143.26767087 278279143.26767087 
--219571018.59580719 -219571018.59580719 
-11332462.742190957 11332462.742190957 
-291912514.77922654 291912514.77922654 
-599654950.73805213 599654950.73805213 
--134120581.12635803 -134120581.12635803 
-365890111.70217776 365890111.70217776 
--82219331.480083466 -82219331.480083466 
--130605664.04172206 -130605664.04172206 
-51577469.436424375 51577469.436424375 
-260148445.28520894 260148445.28520894 
-943213261.6333704 943213261.6333704 
--938348878.58987367 -938348878.58987367 
--768604499.14663672 -768604499.14663672 
-641933454.6998384 641933454.6998384 
-696631246.41445088 696631246.41445088 
--455373325.54509878 -455373325.54509878 
--931466921.39660466 -931466921.39660466 
--675336057.5273447 -675336057.5273447 
--253449769.78109944 -253449769.78109944 
-231520463.10088944 231520463.10088944 
--111257896.94925416 -111257896.94925416 
--878694138.86474109 -878694138.86474109 
--923509532.35997415 -923509532.35997415 
--913128006.51436365 -913128006.51436365 
--421062222.35137153 -421062222.35137153 
-573054951.97061682 573054951.97061682 
--571014244.35805428 -571014244.35805428 
--141184303.90077424 -141184303.90077424 
--111646178.85413623 -111646178.85413623 
-637321879.64828086 637321879.64828086 
-873514422.03452444 873514422.03452444 
-583729833.03960657 583729833.03960657 
--25268137.007528186 -25268137.007528186 
--401918437.84604573 -401918437.84604573 
-684174488.49069071 684174488.49069071 
-828623051.66466689 828623051.66466689 
--325013133.74579024 -325013133.74579024 
-599158315.23466325 599158315.23466325 
--898085229.39121115 -898085229.39121115 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_iostream_small_testdata = R"(
-3.9830433458784053e-09 3.9830433458784053e-09 
-7.5259115310168251e-09 7.5259115310168251e-09 
-4.0425980390662586e-10 4.0425980390662586e-10 
-7.3903572003813965e-09 7.3903572003813965e-09 
-4.2516454741581714e-09 4.2516454741581714e-09 
-7.5304999399852796e-09 7.5304999399852796e-09 
-3.1857943931591367e-09 3.1857943931591367e-09 
-1.8909108775665995e-09 1.8909108775665995e-09 
-6.0894642823879052e-09 6.0894642823879052e-09 
-5.5019631325529089e-09 5.5019631325529089e-09 
-2.8506108598401966e-09 2.8506108598401966e-09 
-6.6867529000958334e-09 6.6867529000958334e-09 
-2.9293834070579808e-10 2.9293834070579808e-10 
-5.6335320198656357e-09 5.6335320198656357e-09 
-1.1965516328001078e-10 1.1965516328001078e-10 
-7.0028052010455743e-09 7.0028052010455743e-09 
-3.3972930248467653e-09 3.3972930248467653e-09 
-2.7245475559959309e-09 2.7245475559959309e-09 
-1.9972408565462382e-09 1.9972408565462382e-09 
-6.1365896266493982e-09 6.1365896266493982e-09 
-2.0467460418208011e-09 2.0467460418208011e-09 
-6.3924490719259064e-09 6.3924490719259064e-09 
-6.7191529002522955e-09 6.7191529002522955e-09 
-2.4792610542857728e-09 2.4792610542857728e-09 
-4.387846786696499e-09 4.387846786696499e-09 
-4.0241928372495324e-09 4.0241928372495324e-09 
-5.3638766167307094e-09 5.3638766167307094e-09 
-9.0169039495837286e-09 9.0169039495837286e-09 
-5.3159169763274188e-09 5.3159169763274188e-09 
-6.506694733066513e-09 6.506694733066513e-09 
-5.4118416519188703e-09 5.4118416519188703e-09 
-8.8256567339966803e-09 8.8256567339966803e-09 
-2.7897065487952574e-09 2.7897065487952574e-09 
-7.4078932362044852e-09 7.4078932362044852e-09 
-1.6818582952912937e-09 1.6818582952912937e-09 
-4.2077810288314986e-09 4.2077810288314986e-09 
-8.763030904282776e-09 8.763030904282776e-09 
-3.2390637713346632e-09 3.2390637713346632e-09 
-7.5875805027702421e-10 7.5875805027702421e-10 
-3.2463451727314698e-09 3.2463451727314698e-09 
-4.4837691855854984e-09 4.4837691855854984e-09 
-9.8215528252631629e-09 9.8215528252631629e-09 
-1.8563174953349818e-09 1.8563174953349818e-09 
-5.4874818972470655e-09 5.4874818972470655e-09 
-9.9488699794379611e-09 9.9488699794379611e-09 
-3.008023048117161e-09 3.008023048117161e-09 
-5.342474458171861e-09 5.342474458171861e-09 
-5.035330234076618e-09 5.035330234076618e-09 
-1.4309543475930598e-09 1.4309543475930598e-09 
-2.1987583429640181e-09 2.1987583429640181e-09 
-4.229781638725819e-09 4.229781638725819e-09 
-3.5895747742312935e-09 3.5895747742312935e-09 
-5.928068622480511e-10 5.928068622480511e-10 
-9.1742258942854091e-10 9.1742258942854091e-10 
-8.5992865102178727e-09 8.5992865102178727e-09 
-6.5342736805160431e-09 6.5342736805160431e-09 
-2.0981300584686057e-09 2.0981300584686057e-09 
-5.8725860873456548e-09 5.8725860873456548e-09 
-1.5079211845079482e-09 1.5079211845079482e-09 
-9.0635015450380397e-09 9.0635015450380397e-09 
-3.3878468412759104e-09 3.3878468412759104e-09 
-7.2793510778356844e-09 7.2793510778356844e-09 
-2.7232501190682507e-09 2.7232501190682507e-09 
-2.9862555446637712e-09 2.9862555446637712e-09 
-6.5342325605764848e-09 6.5342325605764848e-09 
-2.6047316226140607e-10 2.6047316226140607e-10 
-1.9875486766836035e-09 1.9875486766836035e-09 
-1.5233941722126529e-09 1.5233941722126529e-09 
-3.5941122588692861e-09 3.5941122588692861e-09 
-4.0496791548322296e-10 4.0496791548322296e-10 
-2.6792919392807757e-09 2.6792919392807757e-09 
-2.0510328287583495e-09 2.0510328287583495e-09 
-7.7099847979522625e-09 7.7099847979522625e-09 
-6.0735781350159339e-10 6.0735781350159339e-10 
-3.068524446434066e-09 3.068524446434066e-09 
-9.2055376293432778e-10 9.2055376293432778e-10 
-3.634765050352943e-09 3.634765050352943e-09 
-4.1765204985901312e-09 4.1765204985901312e-09 
-1.9270292323259667e-09 1.9270292323259667e-09 
-3.2462530872506869e-09 3.2462530872506869e-09 
-4.7681545363953503e-09 4.7681545363953503e-09 
-2.6183421994737561e-09 2.6183421994737561e-09 
-2.0830282749912665e-09 2.0830282749912665e-09 
-2.368724001342965e-09 2.368724001342965e-09 
-7.4351332849639322e-09 7.4351332849639322e-09 
-2.8992923697069885e-09 2.8992923697069885e-09 
-9.9998576533014237e-09 9.9998576533014237e-09 
-8.9435746739413116e-09 8.9435746739413116e-09 
-2.7053447499972243e-09 2.7053447499972243e-09 
-2.5263275080088242e-09 2.5263275080088242e-09 
-4.9075559766755126e-09 4.9075559766755126e-09 
-2.170797897619211e-09 2.170797897619211e-09 
-9.3286362065594829e-09 9.3286362065594829e-09 
-2.9124925522443934e-09 2.9124925522443934e-09 
-3.5365146665099791e-09 3.5365146665099791e-09 
-4.770762080539641e-09 4.770762080539641e-09 
-7.6032577169008961e-09 7.6032577169008961e-09 
-9.4975745960664536e-09 9.4975745960664536e-09 
-7.4514743961652261e-09 7.4514743961652261e-09 
-4.3562384765434807e-09 4.3562384765434807e-09 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_isgreater_testdata = R"(
-164747924.0682807 197083553.80510449 0 
-102040978.82771635 -374247187.88952219 1 
--291097355.57633471 -254361836.45894957 0 
--686003841.35043621 -451931153.01585221 0 
--343817339.38769221 813458089.32859111 0 
--48310451.149010181 840659647.16624236 0 
-555292576.86780024 57739878.189272642 1 
--967513591.2959255 -919201247.83675671 0 
-20894605.125685573 328511980.09791899 0 
--631703703.77384949 -523001526.17932737 0 
--79913527.980378389 406081954.28411007 0 
--461603180.25082648 -260671853.40731001 0 
--215165958.33682168 471828864.18188906 0 
--887919987.9150629 774027393.07251906 0 
-173122724.81991792 292222150.68327618 0 
--849263767.64030278 492260129.41509795 0 
--198555610.58169878 371936636.89330006 0 
--766361871.24969029 -382788594.31813025 0 
--315652938.18735826 453066296.57703328 0 
--165101092.27817976 682897487.56105638 0 
--565988408.86004996 -640791954.7345953 1 
-533182177.73363972 616371720.11351633 0 
--515060580.90774429 457023375.04119778 0 
-927047703.32778883 -708953213.65708947 1 
--2089298.1663703918 617850591.63404369 0 
--169949563.89875865 290935518.25179052 0 
-718533937.13004279 -616564918.23473978 1 
--358015851.52117765 -210576501.74514902 0 
-333962595.55102754 853662236.78583574 0 
--168334894.74325156 713568560.9523592 0 
-727155042.64072633 857709052.18613768 0 
-54565660.754859447 -954042354.95688045 1 
--110792155.89943445 -673112222.00988615 1 
--680736746.71143818 -323304665.48594916 0 
-691629228.63213158 -656303448.19707274 1 
-416045930.88515711 -688119773.23153687 1 
--885006156.4153266 -693315702.06558251 0 
-506307414.04323006 -754442432.05201352 1 
--704051075.17056227 -967803537.3615402 1 
-394203676.25662017 306307652.54360271 1 
-894030265.37470508 -975407332.63642704 1 
--339689754.02923679 903096516.52301168 0 
--431984481.70156229 -893428647.24168706 1 
-433848994.06499982 655550645.90532184 0 
-893456926.33041048 744889713.98253655 1 
-466173953.79445767 -930982542.96447265 1 
-398030477.10954595 -304756908.0002507 1 
-113657177.47240448 -383333800.91229212 1 
-880912676.19763517 -158731384.89176679 1 
-61091001.780096054 -949288457.99559951 1 
-568861272.66777039 -854128060.0662384 1 
-298699926.1898725 -868735718.46960282 1 
-244656755.38046455 -192708253.72951102 1 
--327271984.88196456 248829637.31491733 0 
--271018984.63339722 -523604383.76404184 1 
-658798260.3961575 -665903235.81814575 1 
--620577873.45811069 439112765.79539394 0 
--485954356.27861661 -540725794.90704036 1 
--296067584.74665177 449081160.68825984 0 
--5104584.6931163073 -466152596.01816082 1 
--832208219.61580861 864059716.12610817 0 
-854605468.84130144 93974976.475846291 1 
-867415066.99155974 743424300.07550931 1 
--838703173.20389783 373616938.06820512 0 
--642494641.62289953 89518991.44808054 0 
--494959539.44932312 75118855.261154175 0 
-645316032.05677724 -815706133.00525761 1 
--354314378.32499135 60858639.316561341 0 
-823312062.12942433 -481392908.19316369 1 
--383528021.62969315 913733743.25750828 0 
-454246439.81896186 788210060.35318494 0 
--658156620.24229527 -289590104.20679498 0 
-299266929.11297536 -950698809.07744932 1 
--965326802.34980583 -140941366.62181187 0 
-543011939.62155056 -142263355.11908722 1 
-525347943.92196012 -377304164.69369221 1 
--213587282.410043 -228465921.88425851 1 
-754764436.0925467 -827115653.05517042 1 
--92986823.718788028 -288520614.47422826 1 
-88285658.843943357 -476879091.40042228 1 
-556299050.68642569 -109547286.0817405 1 
--53735373.603619337 -631282234.98128772 1 
--904121785.41594195 913678317.26509571 0 
-820698285.29114389 -687286063.50464118 1 
--850664287.00373197 -922337010.70649314 1 
-668237160.79852557 -800164431.92476153 1 
-596746441.33460999 -788204371.07782733 1 
-902736733.89586139 735592160.69633031 1 
--104643052.83341718 836891323.90142608 0 
-152096493.63316536 -227457871.53146923 1 
-280431369.96277189 -92119675.3293432 1 
--809585871.23747766 636501944.3505342 0 
--206158520.78855395 -325764807.45674884 1 
--735745958.91792035 293013636.8882339 0 
--518460963.7355206 -139976859.21565855 0 
--436785378.84794402 558129889.01861119 0 
-169695222.06844115 139457677.86826706 1 
-881139427.15201569 -977444027.89878333 1 
-125364046.81868267 -581879309.77497983 1 
--782987226.95247686 704634366.38179493 0 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_isgreaterequal_testdata = R"(
--275847473.76678526 710816623.66637039 0 
-346547175.37722707 -726591394.8573513 1 
-677249241.05198312 632668315.30216885 1 
-949865852.1068728 107212672.25840569 1 
--604471806.5456537 29821545.990474463 0 
--883850605.75958276 -990049694.20376492 1 
--340260319.88514507 -373468928.3469758 1 
-491599794.99560547 199310158.96972823 1 
--483849454.61944681 -770402780.03737712 1 
-407061211.30410337 -281186772.75170076 1 
-831086267.11974978 906424786.52119088 0 
-890939685.11471415 -511006088.97421777 1 
-81779211.387630939 685253807.10883045 0 
--720745926.59559858 -11837095.183417439 0 
--876676179.14314985 -361033836.97462702 0 
--539997813.8288734 -961096813.85420394 1 
-392573378.99664783 -46534685.885882497 1 
-598864436.9179368 927865117.15436864 0 
-462111615.37635875 -232349086.91638148 1 
--169432408.02861559 -466779260.49380636 1 
--318292455.63825417 484488417.54508996 0 
-305882710.48052096 941583616.5497551 0 
-38363742.915075421 -498834568.33614367 1 
--437150764.53088093 -965823335.86882281 1 
-827236867.57114673 -39417553.354846358 1 
-562917983.28258562 -684752479.61389852 1 
-674312747.63527656 -513362832.81401515 1 
-503028741.59585714 -892572215.53288805 1 
-546928868.96185207 897286617.28903985 0 
-925773704.24319029 657839670.66265464 1 
--409384650.68822956 -952442793.85953355 1 
-784067796.32681489 -138261266.36870444 1 
-731017350.61405826 321109057.62866306 1 
--387657328.590958 109031966.63378024 0 
-342989432.74235463 -770240132.65584064 1 
-723259189.48488903 961229605.14488029 0 
--105207457.4050827 -19082877.402141213 0 
--287527726.56375837 335176449.54396677 0 
--274570308.89780664 466166502.24478745 0 
--920334865.22295654 -132076598.92446184 0 
-894096681.22859263 364601063.15604591 1 
-115790897.38321805 494477827.98403907 0 
-199395558.11019564 654912364.49375248 0 
-140408593.68796563 444031532.23285222 0 
-590570728.80516267 -52147042.347745299 1 
--243222523.50654459 -972389777.49071479 1 
--859818464.02085412 479479425.09328556 0 
-279110242.29888558 929388364.2930541 0 
--293182289.72588456 527561770.3402977 0 
-463823079.07094479 -231924273.64375329 1 
-168670446.3633039 919960501.15111518 0 
--634157331.11644101 -331249032.87980855 0 
-994157560.57338428 -645651312.12481952 1 
-295479473.73714566 -296960872.80997074 1 
-35927653.533907294 -589437622.62640452 1 
--660115316.70724976 -238068394.17879748 0 
-569323238.28473878 417392928.37458777 1 
--683545950.54509997 47065173.688332319 0 
-273631179.47539258 -978170747.35423648 1 
-305464663.27278423 -543436096.03908646 1 
-269637167.33736396 887423472.36630678 0 
--24087260.520529509 -601406444.61160028 1 
--616533982.73658872 -120974218.82648933 0 
-832322338.5576148 -669412751.1964258 1 
-532066890.36938548 30791001.835250139 1 
-604177664.40645909 -303349774.79190409 1 
--438106835.81906867 -846632561.68697858 1 
--323326237.41257846 340963289.93326187 0 
--370925757.36495984 -285302298.53690839 0 
-759143415.9255228 761332516.35627198 0 
--500640876.48598373 -555126008.44700027 1 
-866256977.43760967 -96975929.333207846 1 
--824812003.6037885 -304943410.92717218 0 
--373958644.93632066 828247584.9282949 0 
-605526519.38888335 181419660.15592194 1 
--684067234.48279953 590068364.79878378 0 
-306173269.1913898 389624019.68396902 0 
-31248230.08425808 732713403.03505373 0 
--729149673.45613801 -518546518.28185713 0 
-577995136.86641693 574664329.47094226 1 
--16386030.956459403 -97141568.976627827 1 
-90709003.731569767 -489472332.0217458 1 
-965902478.51439595 958171660.85691977 1 
-726581549.10618162 -828946054.90389633 1 
-299595317.81498694 900259875.63415861 0 
--810915428.85145903 -468851469.98839355 0 
--909718325.07181787 -461286745.99091041 0 
--366320045.92822134 605724566.61918616 0 
-865167831.73371911 51389058.210884929 1 
-996528350.89948535 439849825.14071417 1 
--384122962.60178757 239465476.39828396 0 
-828764516.33284926 971772981.7276268 0 
-193317038.32418013 373894242.63434935 0 
--674647945.25050139 709284873.27355027 0 
--9364483.5414382219 519686748.0976274 0 
-441068119.05760741 -897303939.12799931 1 
--980142656.74351001 744817080.79779148 0 
-783346960.65388298 230540368.36419749 1 
-304997548.06868887 -400464072.6562506 1 
--488388126.43969232 -791314859.47706223 1 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_isless_testdata = R"(
-78140831.515129328 -853161322.9915669 0 
--815646901.49886692 850502829.48454523 1 
--77573674.327875853 21938357.021046758 1 
--821173141.08372426 -695236710.27758193 1 
-235310023.9898026 -333804160.66390264 0 
--480772849.56168699 997556886.46344757 1 
-26554838.188023448 -634916258.12306547 0 
--894652249.61559927 680371814.13230801 1 
-180783760.16428614 -373962379.01100147 0 
-667287586.10827971 -897349488.98327351 0 
-276993301.20598054 -451244393.93442142 0 
--26789285.108910084 45287969.242794991 1 
-903219071.02210546 -466529157.79160541 0 
-713782814.14684463 -906042781.07765102 0 
--758713749.08624911 -382495472.33272493 1 
--395541752.35249734 826029940.48281074 1 
-284926563.54150891 350534110.7885859 1 
--819685354.9817791 550565886.12214017 1 
-339388192.6319716 -208497819.96423554 0 
-357834141.03926158 -861744740.52971125 0 
--941569882.08222079 -80190605.183838606 1 
--54297299.369842172 -448457785.22328675 0 
--900476012.58808601 -63125700.439870954 1 
--602412702.58320594 -772344265.96786845 0 
-61708860.843769431 -492578629.24596405 0 
--430140443.39053166 -833636893.61409521 0 
-943705482.77167439 718162630.2173028 0 
--104913394.65506649 -380900627.49899817 0 
--38754156.198676109 285434990.5702424 1 
-883727206.21104884 -87425487.290491581 0 
-518857117.6424005 -231244345.27703393 0 
--870629258.73375583 -759133077.5045948 1 
-771440901.19119573 -187271646.22928131 0 
-124456833.74180317 806601784.99559689 1 
--163776750.74216115 724104526.93016481 1 
--34106957.945251584 808371920.06082106 1 
-102573765.39752483 555605645.29511857 1 
-427869850.36861181 -513213623.31419641 0 
--713651953.62240696 -347526113.75706494 1 
-96861172.331126928 626888724.22002673 1 
--585208057.49781919 -664117692.08184552 0 
-264936801.84725118 746077642.36861682 1 
-72125157.650322795 -218205166.69291627 0 
--269041176.7723006 886931607.287148 1 
-777532585.30416036 -804943385.89568257 0 
--235495679.43703949 -546505250.68872654 0 
--375138676.43849647 282502566.75351381 1 
-481466981.0214057 -554962846.18497729 0 
--8799415.5754377842 -546565642.34957528 0 
-449142042.00420904 852823220.79375029 1 
--311930194.53803909 321645960.57831907 1 
-707314859.26298285 409235368.53439498 0 
--890050952.5034008 152622869.78244543 1 
--685159016.13173366 -29031732.897204995 1 
--844300064.51562202 121477933.28617978 1 
--479811408.82133454 -862535533.59158492 0 
-474090995.59436917 965422156.76816607 1 
--887457069.59846079 -870660422.94077778 1 
-65307543.64337945 906386309.02020979 1 
-673395630.47915792 -103009012.98337579 0 
--138120653.3981868 97235362.865516663 1 
--488946264.73186374 733662201.92949748 1 
-573410764.7191782 -275216235.73571754 0 
--882955016.82862437 116653910.93417311 1 
-226853933.19430947 -559550777.41762519 0 
--769832373.36694419 -868774623.79171848 0 
-475617314.54448652 -838804635.70224154 0 
-160637964.44192004 57128911.664391398 0 
--958666973.59059894 290471268.77203107 1 
--983025161.51749146 -308076742.98651755 1 
-765989857.15034366 -102121806.32583213 0 
-985943928.8094871 -566943041.99756038 0 
--914577326.96853137 -487959768.43738353 1 
-637045047.24520373 -572412708.16385579 0 
--992296707.57524788 -394735789.80050337 1 
-747402804.12910986 922121077.5301125 1 
-901841966.04807377 560482386.55420113 0 
-884419603.16876435 362883525.15180278 0 
--140786654.78240001 -222965004.35628664 0 
--599988714.59291005 908434163.42231393 1 
-687013106.86077619 -970272260.13403964 0 
--722108146.79290164 700706965.46862721 1 
--564315906.26906896 -428820204.02066338 1 
-265160332.99638438 -42628316.693721175 0 
--673130492.99540591 -815848925.45366859 0 
-962539168.23822474 878155635.59205246 0 
--965024463.51478374 164117220.85000324 1 
--886226892.96476436 -622224253.91138983 1 
-228119850.93302727 -775975319.29845333 0 
-624604007.14661169 249967884.10924196 0 
--558098798.73280048 -263314607.50396144 1 
--940026370.12952101 794991455.74871159 1 
--769088612.35765648 -781619913.11218345 0 
--15677789.072603703 -128138327.89557993 0 
--62368524.56197989 -940676305.75481403 0 
-10476278.941764116 -434556367.83076859 0 
-410284315.38115644 -469458182.66907716 0 
-108339059.92307854 -106947310.88258553 0 
--872888863.48470962 -642480849.87473989 1 
-154025305.11184287 159576426.41126657 1 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_islessequal_testdata = R"(
--516583369.71551532 -607120555.89020395 0 
-594899557.92106009 -58206896.403279066 0 
--713008951.79844081 804605269.05464339 1 
--868293348.29657221 473687430.87468767 1 
--148720139.92091119 376891913.94187307 1 
--381169787.71479225 -804365105.25850272 0 
-270799102.58939528 258527516.64665937 0 
--93272858.694864392 395876397.58970523 1 
-546482523.11837959 -345730154.66905701 0 
-78680145.028702736 127200959.1984632 1 
-568685640.42010117 -263151741.85171521 0 
-443056247.74865985 783172213.88058591 1 
-753609417.43998337 -352968715.8953954 0 
-699381097.85418892 130976006.4983871 0 
-995036832.21374154 -70883138.89157939 0 
-550723855.90668464 -590057502.11720014 0 
-699738929.44781089 287621525.17127848 0 
-976142583.29739332 -627394640.60374522 0 
-710061847.95775342 874736708.75675583 1 
--483109218.18143362 -945524029.31788385 0 
-610693215.93096852 -533179535.07927883 0 
--996209212.68522644 855250399.77575517 1 
--843378210.61251938 -437290838.91914487 1 
--737158529.13001227 -496818832.52771366 1 
--246914815.22526181 418813801.79598045 1 
-571625297.20089817 -677397706.86543941 0 
--126334018.12043583 -640263136.73177719 0 
-14208535.682223082 471291095.40708208 1 
--195255582.21928382 -318401063.07898891 0 
-455678623.33216047 -84406263.241901755 0 
--72231855.412182689 -142531021.7742306 0 
-192392806.71909642 -632205292.03082991 0 
-247608574.76790786 995638302.12943316 1 
--758630247.34213448 913036804.52967024 1 
-167085257.71380877 858076396.85523367 1 
-278269451.9090085 -114995590.30357683 0 
-62467159.44427979 -29519553.672064543 0 
--435442811.90475237 -246651092.22757113 1 
-204112664.05928183 -318797114.30111229 0 
--62628275.01598084 -948676024.34771168 0 
-575265669.59366441 115816591.33350992 0 
-375645532.97861624 -971846975.13755989 0 
--161380558.97754931 972992063.17456532 1 
-641472721.7887032 -453575566.03909779 0 
--684934568.92767835 56586665.411557674 1 
-455171432.45613217 244934696.88181925 0 
--287462508.10325098 822478458.3154099 1 
--874760786.24335945 -156105058.11564553 1 
-327458302.48604226 -360581358.87749231 0 
-316860180.43199086 -487738927.47181988 0 
--753925010.47978604 -291934852.7989825 1 
-870209540.21232748 -754261317.56395948 0 
-515191617.89394689 -542333169.58721447 0 
--511303414.86023939 -508361222.28343308 1 
--421076467.7439127 -326163272.81593955 1 
-23805679.623978257 -64928058.084914446 0 
--653214549.72055364 422131877.1910274 1 
--508012663.81352645 224245138.99149537 1 
--136689906.78102911 -240114462.63111353 0 
-979704424.41932487 490354151.1226058 0 
-10549202.716439962 565591053.5436101 1 
--19365610.167680383 563783812.26955462 1 
--915282611.40403593 -24485614.546508193 1 
--476258999.85982955 -869437636.16827321 0 
--366125053.88533068 200545040.73782229 1 
--611717162.68819511 -449397855.66712976 1 
-246268158.02270985 -462924500.66243291 0 
--326475840.79964697 -8393382.2509135008 1 
-999969688.9798193 80033104.922207117 0 
--977412930.45949793 -137722329.70093215 1 
-628830499.09542418 647943963.51386189 1 
-875806785.49181867 -876088186.29892731 0 
-589502172.97972345 -174969986.51370418 0 
-370788253.53333426 928091683.00811887 1 
--923987234.90825403 58385392.491770744 1 
-711268767.12627149 -279558624.096753 0 
--14048529.752460241 737502991.14497566 1 
-67500668.325646281 -167560293.10790133 0 
-210763998.11418414 -213138139.2871958 0 
-111292512.01856089 790422484.08027601 1 
--948050439.42065012 -833840241.42852604 1 
-395525682.85766149 455210972.24031949 1 
--690118378.1758008 -257671422.78250551 1 
--461379576.08074164 911172841.68928385 1 
--22400846.932726741 231637698.48732138 1 
--513839220.05223036 -658513712.14531302 0 
--138680209.52204704 -598006766.69048572 0 
--65217360.205816507 -233520723.1134603 0 
-876122152.16892171 286504727.53992558 0 
--660843601.17939997 856098947.14957762 1 
-648778326.36601424 133527847.21702909 0 
-119151148.47318602 215168692.6112206 1 
-279892219.73215699 322899876.18422866 1 
--284757771.48143899 -373633657.87861264 0 
--281395466.10417473 872622386.34327888 1 
-151384531.55453229 475177498.74509645 1 
-359108800.90586519 986585917.30124974 1 
--588825051.76901317 798521257.36909771 1 
--628718580.28978169 -946613599.37062347 0 
-97795458.512887001 330293203.51582694 1 
-)";
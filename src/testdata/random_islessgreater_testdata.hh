@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_islessgreater_testdata = R"(
--27643904.16184628 672862053.10408282 1 
-480650288.13863802 421218902.75587249 1 
-779641899.93942833 -792250559.69790936 1 
-825892581.83885527 -231203434.27759457 1 
--663865129.74675107 -66703649.725517035 1 
--381585357.22325861 -216569434.99543214 1 
-947331279.60768867 -915212747.40695179 1 
--122967850.83584046 -458453519.53996193 1 
-299586758.60190797 630979393.5493176 1 
--745520923.11355233 485215367.98309803 1 
--140196179.17347574 577486335.6385901 1 
--608139339.2548697 -470308960.91241026 1 
--584141781.76008642 392229978.33308411 1 
-630772279.84545541 985552555.63826203 1 
-60724670.411399007 -308427429.63817 1 
--714567145.07318759 -987895145.15218472 1 
--776151297.48305166 -962760301.64393198 1 
-472571928.97209501 -488858212.54089743 1 
-587399289.28403521 -341053501.89088023 1 
--46921239.070433497 619461981.88630962 1 
--291474048.06374776 -639314002.05774546 1 
--725402674.29897761 47634120.764848709 1 
-762017.74504852295 -106122268.90869701 1 
-470884353.13759685 514116361.9602735 1 
-828628860.07163191 -20120346.161813617 1 
--263459498.92007756 -598927955.8523736 1 
-680794927.06487465 -280679300.21795547 1 
--925300682.25831413 -966796542.61321175 1 
-608356106.69577408 -877175737.2707969 1 
-336796349.52717566 -47702831.279678226 1 
-632698325.47850943 826267684.80733538 1 
-294626849.23247313 961272609.90480518 1 
--687896206.46952772 628317436.78805351 1 
-299111123.03912926 -665882843.01063979 1 
-591934777.23473716 577696637.31898355 1 
--275689108.4165864 -469305205.61083722 1 
-922968224.09632587 -851101868.51633322 1 
-982230885.15088034 555338171.19451928 1 
-294533775.19136381 733908738.43488383 1 
-725557331.82910371 431308228.69502616 1 
-10464058.208674073 -850543500.15582705 1 
--539957326.71745896 850701161.56549406 1 
-668692226.09277654 -36649681.642279387 1 
-776384754.28952599 -267014938.39903581 1 
--887412658.01849854 11782245.73977077 1 
--552318993.10997462 -336416515.24646807 1 
--967207770.50666511 377367624.80601907 1 
-300052885.12004542 -417847183.58064437 1 
--560762267.40502238 296392736.9720571 1 
--486452417.31840569 113163029.40467358 1 
--120143618.27219129 -162168534.66120338 1 
--940740351.13739085 318090335.07087207 1 
-747051892.66056395 794162575.87962389 1 
-508890388.28392696 68208061.293883085 1 
--881074224.0869621 -198292389.10687673 1 
--903887184.84930038 101120646.83961225 1 
-419607900.38846779 832060536.82479501 1 
-849027200.65727639 -316551636.3992548 1 
-857581446.68538928 -19923789.418722391 1 
-74006971.017917395 -506615425.33852679 1 
-468848596.57529044 -794392456.39369202 1 
--339564528.32099259 196979666.77580047 1 
--32970658.011985302 -868248699.08908463 1 
--411738572.65310431 148141824.06909943 1 
--322224806.26423621 584789756.67779589 1 
--614405743.80231094 564604688.22428846 1 
--965377275.07259083 -994272382.05432165 1 
--646104188.54435635 -923389997.55301178 1 
--515172208.788822 -873267248.49714327 1 
--854969386.50631309 -719980860.48225307 1 
-590858140.03595066 -764411902.7131716 1 
-256068018.06252527 953671221.08408308 1 
-638867960.78956342 548475455.11704159 1 
-728785848.53700304 761706600.38360906 1 
--122850048.14930415 -991110289.83915806 1 
--630243675.35988629 410863268.06049776 1 
--803746894.66222167 859651546.29699159 1 
-113403841.4067843 -709616826.36200571 1 
--4015749.3808447123 124319962.19484663 1 
--183549508.47462773 -165878678.55692255 1 
-149171200.26768756 977137011.32019877 1 
--111224070.54977071 -461102377.5776614 1 
-245182752.92888188 344842194.61459756 1 
-247840129.72649789 708788710.80822539 1 
-884245895.11510921 -999959168.27945995 1 
--841672760.40997016 364603696.22406721 1 
--894717568.87341237 735137220.90998554 1 
-439591006.6429677 663648038.19757628 1 
--650778711.95930505 -478586225.58844346 1 
--608916552.78985572 -957774891.9092828 1 
-185799194.32592678 773754201.74755669 1 
--695172991.06515217 -957261413.85406089 1 
--251011544.15685046 -971619381.81104493 1 
--128666334.00953472 -64334548.97761786 1 
--559105490.95216703 631042552.02218366 1 
--531232286.27253711 -199383017.14717019 1 
-964538857.91417623 -130240961.03944385 1 
--121408316.71248984 -788346018.01864946 1 
-981471530.61850548 992533469.29359555 1 
--285201068.96813738 -774456311.48250449 1 
-)";
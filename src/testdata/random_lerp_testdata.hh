@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_lerp_testdata = R"(
-688539282.54312611 -166640985.78635943 -423399808.28758466 3.620831623505687e+17 
-499757366.48092175 821705759.74085355 67406001.354512572 21701254331919476 
-260644082.0886507 715379166.87345743 228619125.40856481 1.0396113763673616e+17 
-523813004.55367684 121075428.2554419 554405940.19535065 -2.2328010411580672e+17 
--80084118.224985123 -92606188.711832762 -797587748.54055452 9987449926586816 
-800201183.83757687 574540301.80958843 60061548.324249506 -13553541170615610 
--413405275.91129005 -364709159.7688036 693552650.50723052 33773320006624136 
--683836040.60236883 -239045308.26065385 171767323.89791775 76400513105095344 
-419574729.13814163 -914934832.99148226 -864621859.72486174 1.1538461398487009e+18 
-469231684.67279291 226790779.37525487 -554138010.24098945 1.3434572133183357e+17 
--547137095.42387915 -139586355.89169335 517618748.64405227 2.1095590325847101e+17 
--787730626.55899644 -678558999.60652792 543359860.53120947 59319479207127896 
--149657234.94194794 -422724278.9469223 -459241257.2073499 1.2540365244108194e+17 
-699949179.71418595 21347539.305839539 -94328518.67831099 64011488212340360 
-763378258.73806071 -875015781.33292353 29013236.151193619 -47535112429909392 
--897750062.6890955 693150799.0535984 866308329.37369299 1.3782106668377316e+18 
-746826002.73637462 -754962079.12845445 208638956.71601582 -3.1333149786199846e+17 
--940751972.43995154 459469152.0018096 -480579677.43137622 -6.7291781725757248e+17 
--825896151.21895087 583574107.23712325 596213267.00395608 8.4034486671311014e+17 
-326573575.89731669 -174060371.00646603 -173846345.24605644 87033382301904480 
-245031982.44974327 540661103.51177025 -643823267.691728 -1.9033290650195568e+17 
-423185735.24402881 589238583.71183896 -909011419.91540062 -1.5094393514353523e+17 
-355415048.40373683 62212034.248425841 81432616.524559021 -23876288260139244 
--857834550.95332789 616396809.46923566 -750799820.08927691 -1.1068526410330652e+18 
-861216545.32895398 356835938.80605102 472525810.90113711 -2.3833285423882554e+17 
-563167138.7005105 -149809000.70091844 51012806.300099015 -36370913132710352 
--628711230.75185537 -12983207.642799973 510783381.66260958 3.145036411993655e+17 
--701097630.91034281 -525575138.84886938 190341225.86629796 33409165604990772 
-422365028.50642347 -825369779.9430604 -3556835.5178836584 4437987905957916 
-638182455.30151129 754315198.20244837 406062352.41426349 47157135412857824 
-134039813.04346848 354605122.66848445 -435512246.87295949 -96058893442980896 
-931649274.83049941 206203582.39242387 828974105.51520348 -6.0137569305706176e+17 
--14742625.855453372 845012370.97967601 -573021502.28540421 -4.9265809989859142e+17 
-284530180.06020832 -16458319.740154505 -751343297.25212514 2.2614569215950541e+17 
--201215406.33474016 -740830753.5415374 926984376.28882146 -5.0021499626758419e+17 
-807089172.52170277 -85416219.971606612 -178054677.95977259 1.5891476104484582e+17 
--84744331.343883991 740396352.59459972 561555654.25403953 4.6336241653595654e+17 
--984591109.40798259 -910484342.97413433 152161788.79255891 11276217157615604 
-485661583.11658764 -331947240.17251873 -830665930.39443231 6.7915979438180403e+17 
-251426725.12334275 -216359018.87440145 -442767426.67584538 2.0712029035695373e+17 
-415354432.92321444 962809395.83042645 -976430960.160115 -5.3455197466055475e+17 
--944197310.18497896 -127888337.3639915 -47184082.550242782 -38516790904286672 
-895683469.80169272 -747428949.8012681 812402858.83943295 -1.33486922618434e+18 
--445237877.82702339 547207117.00087309 -271278479.23824143 -2.6922896936975402e+17 
--408301507.43601859 -165733091.18161905 104259797.70728064 25290133600557632 
--43976059.008508086 1043052.1690663099 -614787790.30548024 -27677199926353768 
-697141409.85613394 418932863.25504231 -641707834.52239132 1.785286046821497e+17 
-293275704.18087959 -135838645.14799678 -48735627.882180452 20913157541071816 
-417828011.27288461 -52146732.845148087 247145041.02755737 -1.1615192699913896e+17 
--126745231.58655703 558056401.81143618 -720300415.20728111 -4.93262900997944e+17 
--411196955.67582583 969516572.46979713 -79853835.255384922 -1.1025527102261882e+17 
--709366475.99033868 -909422030.62332511 -434002467.40301657 86824603619028608 
-270418352.6976881 -339772480.10512114 372723693.19161224 -2.2743258048351027e+17 
-834331708.5194912 -597345929.0902828 750708505.1874187 -1.0747725784059566e+18 
-998618859.6626966 21520896.557311058 -811474002.19789541 7.9288959565915763e+17 
--190079300.27814126 -726075688.81981826 922417704.21365333 -4.9441255837550234e+17 
--410750762.61606705 -88035276.369558096 -679835982.37928772 -2.1939360003215568e+17 
-917044759.42258716 66393515.861477852 623072899.09103489 -5.3001773552396966e+17 
-333372108.25571108 -126828649.79244745 268312014.76331544 -1.2347739225413437e+17 
--585867981.29412007 -336719083.58420122 -294251104.7187165 -73312338976462096 
--8620572.0943212509 -220674873.14687264 763240916.43461633 -1.6184851907787194e+17 
--886753791.07417607 272740635.42921853 736291360.54451632 8.5372572794721434e+17 
-731661860.26315737 -927201883.25371981 242787525.99901509 -4.0275142352626547e+17 
-774251920.24015379 -284388265.85128093 -120427202.50559247 1.2748907684524323e+17 
-745015949.429106 761238235.48997283 989756282.81396174 16056110295364252 
--469224771.08037096 -985919164.55182981 462949682.21253943 -2.3920350572783744e+17 
-780718655.70821857 -196341355.51721334 598099052.11930346 -5.8437866579688819e+17 
--329737978.87539816 -268654966.67302155 954244012.46870422 58288098327932696 
--672247617.80982327 -326526642.41214406 678692147.84626865 2.346381106759103e+17 
-60090318.650743365 145011442.83398747 490051311.2878716 41615708322129280 
-472028002.99454999 321355757.21731281 737825687.88606119 -1.111698529138997e+17 
-638553073.97955251 323230288.67535424 209568593.55308723 -66081751992889840 
--619154228.81610012 787081846.33634281 126949317.58575916 1.7852070948592474e+17 
--693409188.66225588 -901304369.05358839 -575651975.34292054 1.1967527056313418e+17 
--281321255.91752481 -636315353.67377973 -220407743.71970415 78243447838946992 
-496434174.44830632 -229476609.78618002 -298645713.79231465 2.1679014480368128e+17 
-290509198.37564731 968280671.93754983 -650139868.36614227 -4.4064625631335238e+17 
-797622585.73979068 -172677892.13972664 53543176.485525846 -51952968933470480 
--561126532.67558455 -477841457.17536151 156007335.66374612 12993082168217202 
-878450175.54859972 281287785.77514267 -210386813.80718374 1.2563509338837138e+17 
-662237674.81226373 -50303914.346495986 -840712653.20204163 5.9904273060069773e+17 
--385341775.69442451 346003683.97543001 -452586490.26910436 -3.3099707515156608e+17 
--31968641.733661413 896219325.77525401 -535922467.01437211 -4.9743678543240243e+17 
-922526601.25895333 539049892.1408937 -948545035.68318689 3.6374492965658752e+17 
-389173560.85157752 -769054104.60869873 154008928.53346705 -1.7837740136618253e+17 
-314623353.26501417 701184332.87383819 -484018999.12936455 -1.8710285813810634e+17 
--235666507.0004586 379122870.04117036 -693583958.34359217 -4.2640804991179066e+17 
-595732197.85966945 -409499229.80858278 181730793.13006949 -1.8268150403369139e+17 
--780215756.63585079 718134222.27269936 605643165.22456217 9.0746542306011456e+17 
--405329880.81465793 126721880.99641418 190270053.32922006 1.0123351668836829e+17 
--850821667.113832 366404900.88604331 923099950.89680028 1.123621784300144e+18 
--926701659.46224475 496658147.03393483 82217716.162545443 1.1702539164097683e+17 
-154057759.28695083 899813394.02888966 -172334624.70285511 -1.2851951727923376e+17 
--375133576.31764615 -577527219.33154416 -395703800.59043097 80087933380808784 
--782436983.40896714 -261753398.94122601 -530055978.20676005 -2.7599144748368768e+17 
-240609776.93050599 -523321876.43419474 -277875463.62690032 2.122778625985905e+17 
-762755501.96197772 945000555.65737128 -462689072.24879313 -84322794053497632 
-936055607.30159879 528322122.09394145 991967519.33880806 -4.0445837293675085e+17 
-445393486.63007498 -27242087.781799197 828377624.74519849 -3.9152073405599738e+17 
-426009721.34293699 516523599.40048385 217533568.94939089 19689807359317848 
-)";
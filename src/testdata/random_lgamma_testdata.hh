@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_lgamma_testdata = R"(
-4.1037817429499635 1.9236353309015728 
-3.7258983967941059 1.4584034324276749 
-2.3651533801225426 0.19442254655784774 
-5.3295309295570732 3.6861020973976046 
-8.5737454991047848 9.7030030169280721 
-4.6963159499533171 2.7311112137819724 
-1.8892815147808781 -0.042762417047181728 
-8.462073204737683 9.4704660067765225 
-5.9292076460978604 4.6671679635270271 
-1.2541791925459445 -0.099211968584068499 
-6.6554812403992276 5.9433189899496304 
-9.4623694598683041 11.606710056251 
-7.0136349150016581 6.6048007301664651 
-5.3843549306286231 3.7728422980126379 
-1.5855416433529945 -0.11432412321929111 
-6.8604086071081749 6.3193333927756505 
-5.3881664389672244 3.7788955828664226 
-9.8398840835434758 12.442641754875201 
-3.5593215839671259 1.2669921455833102 
-8.3701137178070226 9.2801507624518216 
-0.55455352933289503 0.47216946619375177 
-3.8562737455339651 1.614194304051535 
-7.3145981128271798 7.1759047109715466 
-2.103867319175821 0.04731922228120615 
-4.6503270019817666 2.6652975227142583 
-9.4212200323233564 11.516541149588463 
-9.2220375515765625 11.082777563635959 
-1.4747752651563906 -0.12140304506806029 
-2.6391859973190064 0.38719943558270603 
-8.2399161335761644 9.0125378373708109 
-9.5730659205679132 11.850208651626396 
-8.6856794893420091 9.937633054998928 
-9.1369692672279204 10.898901433873649 
-8.4071461174555182 9.3566630050466113 
-2.692872832769424 0.42915311707558645 
-3.1293700307757999 0.81577847951793725 
-2.2443910806759302 0.12166912367895101 
-2.3997597152970833 0.21670245515746084 
-2.616495319790102 0.36986411510378187 
-5.9817190988359004 4.7563327060348684 
-9.7679786192742277 12.282226780933602 
-6.6074171051643873 5.8561050876711036 
-6.8218877038749941 6.2481432932086971 
-6.9580979675459007 6.5009128272763874 
-9.5359181676077114 11.768343642954063 
-7.3615207439429806 7.2661552222326256 
-5.1870428836657867 3.4635817741962276 
-7.0759704192717665 6.7219688068827521 
-9.6854615507333968 12.098825273312347 
-4.5130575553587882 2.4718930108296764 
-3.0274638294854666 0.71863878478259824 
-7.640557209419887 7.8093945146359012 
-9.746256361584436 12.233875691441925 
-5.8271507400479097 4.4953279176705516 
-6.9257698803257997 6.440658845379077 
-5.6769944476611993 4.246054937592457 
-0.013057689016799247 4.3309803683906116 
-9.2618051935180805 11.169020580026535 
-3.1030751742332003 0.79033374115351052 
-6.2138485772529144 5.1564362008874225 
-0.73305051769485097 0.22205522564734859 
-7.9709858959615065 8.4667354402928456 
-5.8208970168956062 4.4848611213478904 
-9.4745123596997551 11.633354355359995 
-2.606830218433954 0.36255258232629978 
-7.4572303885807791 7.4512328805315873 
-6.085475212001473 4.9339814993183637 
-8.411853953818623 9.3664022414156793 
-0.57736444063836689 0.43405796767407956 
-8.3690257683457929 9.2779055891028879 
-3.7507224448161485 1.4876699762763883 
-4.193418695341899 2.0399311380385385 
-3.9981254930127008 1.789405366614806 
-3.8979230349968317 1.6650318609636641 
-8.6130904384406151 9.7853002193312886 
-0.5091736615461353 0.55455787624793629 
-8.6895796474380091 9.9458360404835826 
-1.5932194745658312 -0.11342666357445333 
-1.7336548401420104 -0.088343616136478245 
-5.6323140311776534 4.172714046029367 
-7.3602298667935164 7.263668067349661 
-2.7320747161670837 0.46060611474061641 
-4.1489125622763448 1.9819148965609485 
-9.7053274480894061 12.142911560037518 
-6.8102792155297713 6.2267356258365076 
-9.0411573760160042 10.692805457621487 
-7.0638766298506379 6.6991905959570994 
-9.4330165220326325 11.542370923531482 
-1.0245001414118435 -0.013653970816687205 
-7.013790353810271 6.605092160466695 
-2.1451471139090947 0.067962286745642225 
-0.015257570967647023 4.174062589526808 
-3.7915588927287667 1.5362231053892823 
-4.022785866668027 1.8204547214582054 
-2.3884284795678945 0.2093388201100638 
-9.9179072242054751 12.617330252664972 
-7.5662849725916423 7.6637173278186888 
-1.1107502706691577 -0.054345482529579048 
-3.8792047795015345 1.6421210767365384 
-5.6386650335558519 4.1831153665769296 
-)";
@@ -1,54 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_log10_testdata = R"(
-382514564.71541739 8.5826479761043064 
-418993700.96959043 8.622207493957438 
-699194667.02783298 8.8445981071417688 
-198612447.65468526 8.2980064635870328 
-924601746.54872322 8.9659547094738521 
-814295885.15958595 8.9107822401999339 
-489092527.15905762 8.6893910272899415 
-232129768.42281079 8.3657308381412392 
-98669932.933554411 7.9941848330102916 
-882356699.52517557 8.9456441875342509 
-761323809.79384685 8.8815694122186191 
-447988499.06449533 8.6512668647639028 
-485684063.54850769 8.6863538534699636 
-4580759.7036790848 6.6609375102647599 
-86773374.723437071 7.9383864880276542 
-4323703.3910677433 6.6358558934124288 
-40482716.06417942 7.6072696424709436 
-225651591.02196026 8.3534383999861088 
-561938163.66742134 8.749688527925727 
-52672600.851014733 7.7215847633424168 
-564473576.73488426 8.7516436172143699 
-90832713.387952566 7.9582422877853647 
-969858442.5734458 8.9867083506625907 
-734520873.91552591 8.866004142260401 
-54572250.074299335 7.7369718605946982 
-915049631.20294237 8.9614446503211056 
-875116630.27807045 8.9420659370345987 
-117972660.45658922 8.0717813735049795 
-556469845.74019885 8.7454416355468236 
-239375315.17010593 8.3790793631207308 
-951260962.0620153 8.9782996744941226 
-99057932.314577818 7.9958892584966179 
-15907684.716000199 7.2016069748549132 
-735605169.15737247 8.8666447723994217 
-41438388.481869221 7.6174028575711441 
-564945186.08171582 8.7520063123556042 
-25530353.730529785 7.4070568321232049 
-906714089.51831746 8.9574703643265075 
-452276893.54775453 8.6554044005669617 
-419902306.22044516 8.6231482599107743 
-769285988.94585443 8.8860878226770392 
-778753281.44221878 8.8913998896630471 
-420449080.06249166 8.6237134065859262 
-112735381.57793736 8.0520602391385854 
-92963863.873767138 7.9683141660809227 
-16323748.436215281 7.2128198932805159 
-867486909.19178271 8.9382629297929768 
-553707969.30992365 8.7432807741935612 
-135383697.16721892 8.1315663699872509 
-)";
@@ -1,50 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_log1p_testdata = R"(
-904211897.0114212 20.622574291344069 
-825376228.80368614 20.531349876471765 
-10399033.353836656 16.157223509208087 
-725213010.04799414 20.401975978007791 
-466870635.80475998 19.961562768275712 
-903816773.85957766 20.622137215136082 
-801594384.39147615 20.502113284018193 
-873190033.68194795 20.587663770163061 
-308889840.87079167 19.548495272501189 
-580738212.65760565 20.179810634372437 
-57624315.899894834 17.869455204979065 
-54364500.219616532 17.811221947712035 
-494198366.04579902 20.018447547275766 
-427102798.25903392 19.872535289897062 
-116801305.5082283 18.575984814153959 
-271371703.09568834 19.419000040886537 
-168041039.35815096 18.939718795380251 
-765888596.16073895 20.456547282612235 
-731881899.54907775 20.411129720861496 
-620184600.95593166 20.245527736776349 
-900147747.50540876 20.618069472820995 
-741352035.26001477 20.423986153116402 
-821809523.96235561 20.527019204711902 
-943207486.42157459 20.664796845473965 
-207070490.35198188 19.148569831192042 
-910662002.61133385 20.629682369488378 
-81099280.183532476 18.211184655711374 
-856474744.60974145 20.568335389724261 
-303392511.21839046 19.530537945003925 
-948803828.99140549 20.670712622868439 
-613445880.27718663 20.234602605147117 
-107292278.40148616 18.49106725162433 
-273646551.55767202 19.427347877476205 
-32374394.492103338 17.292878405751068 
-984355652.99760461 20.707497826703349 
-582790701.79081368 20.183338679499901 
-525101882.70489621 20.07910286592768 
-69001847.905425787 18.049643857933344 
-607208971.39753842 20.22438356061231 
-159324065.48120594 18.886450839936458 
-880466841.17478204 20.595962827241181 
-758118018.27499604 20.446349629738904 
-570153111.15618849 20.161415500539437 
-72707490.567166686 18.101954984886124 
-147742487.73502874 18.810981375293423 
-)";
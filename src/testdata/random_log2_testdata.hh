@@ -1,54 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_log2_testdata = R"(
-663666343.82117987 29.305882872513834 
-396985019.89883685 28.564509327864084 
-756112517.66057777 29.494025698032289 
-118372293.18033671 26.818756195056942 
-834239387.0816071 29.635886187132652 
-570080.23563921452 19.120805459350048 
-467545949.18325782 28.80053291533185 
-552652761.5638833 29.04179806141023 
-600180598.44253898 29.160821441941891 
-441185301.59548807 28.716809486409588 
-889105551.40700173 29.727779459877347 
-966352361.80998063 29.847974095100369 
-738161795.92304015 29.459361830929709 
-645355461.32583785 29.265518773952621 
-83602146.504898787 26.317036648529864 
-671207195.95603633 29.322182941972041 
-889477516.38562536 29.728382897577376 
-99750491.082339048 26.57182060810603 
-832593855.63924527 29.633037670842103 
-21344920.091177702 24.347389425800252 
-648380896.47550035 29.27226634383765 
-370561772.13404393 28.465138816941977 
-402956074.9908843 28.586047342649653 
-212453006.16260815 27.662568516707278 
-927653584.59916234 29.789010916731257 
-27974209.977789283 24.737594052706523 
-156509462.87732267 27.221674647141537 
-88026289.238131762 26.391431116249827 
-552469015.17661738 29.0413183133685 
-503253911.67326689 28.906711240015394 
-985241223.48048615 29.875901752005451 
-70817332.169515967 26.077599159757572 
-365740717.95453453 28.44624601011779 
-170438356.11039233 27.344674800902382 
-453469303.13147187 28.756429652258639 
-312754420.16006589 28.220455033251607 
-319566961.79790902 28.251543023077904 
-309352258.51292014 28.204675325888644 
-173492303.82762361 27.370296424922671 
-355473568.43734741 28.405167050020882 
-629905572.30520248 29.230560332826553 
-948732515.4604795 29.821426151915912 
-737758125.6102016 29.45857266457385 
-983130915.93800616 29.872808300994034 
-821235979.23073697 29.613221593950055 
-175125921.8858192 27.383817404310875 
-860356859.4064703 29.680359945086362 
-291579265.29998827 28.119312889900687 
-322308940.26983881 28.263868965814925 
-)";
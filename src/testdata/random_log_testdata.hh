@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_log_testdata = R"(
-139798792.47202238 18.755714750187497 
-846056701.52667391 20.556096938405727 
-657783987.3462199 20.304387148683841 
-436090167.88097531 19.89335958699813 
-965107016.52820194 20.687749551111221 
-129583783.32959549 18.679838205423543 
-423801714.85729098 19.864776250173701 
-757126068.65085506 20.445040334723338 
-507260459.10107654 20.044535155681039 
-859934004.14011705 20.572366204895253 
-713727724.6968658 20.386012109616477 
-719429028.68645322 20.393968439657819 
-182980365.27249888 19.024889411456424 
-91640247.501847669 18.333381116351767 
-45381860.619125247 17.630623037337628 
-539273748.69909489 20.105733882503195 
-70258437.829361185 18.067690970415306 
-712799670.71525979 20.384710972161255 
-916962318.68859375 20.636576937433794 
-512789833.94886702 20.055376638781532 
-673532191.39847362 20.328046349849092 
-433336652.31642497 19.88702547190821 
-598554455.61786878 20.210028065653443 
-121359010.15938491 18.61426373673682 
-95305604.389690414 18.372599174761952 
-497744037.72798777 20.025596522389801 
-55902975.230733559 17.839128160872363 
-674757788.4801811 20.329864352560026 
-440051547.49702972 19.902402431416998 
-212212508.22648963 19.173098727866364 
-509283057.84870553 20.048514525738408 
-950119457.18473828 20.672098279058684 
-338292479.36754948 19.639421402843322 
-364386199.74173087 19.713724851452184 
-66811790.395658337 18.01739012586108 
-497889166.07911634 20.025888052145142 
-162307239.52561176 18.905001637316328 
-145356215.83977938 18.794697948690342 
-947111245.52774596 20.668927115769325 
-793526492.18257892 20.491997483866903 
-405761774.40949029 19.8212767828153 
-399818448.74389613 19.806521123898136 
-525248044.45829844 20.079381174614007 
-111918869.8288898 18.533284790244153 
-598779199.43013275 20.210403472815774 
-273316054.98040485 19.426139394070084 
-960112919.64920282 20.682561460143507 
-330513719.16187364 19.616158726717856 
-58003979.631085776 17.876022180485904 
-852811638.98661411 20.56404925925014 
-949859762.02775371 20.671824912743961 
-550605804.08412778 20.126529691997767 
-8021253.264351151 15.897605235009678 
-27106625.932596941 17.115288755322652 
-659325680.90671253 20.306728175102133 
-528765486.43714625 20.086055576665871 
-714907821.29093099 20.387664171075794 
-587863358.7668041 20.192005095808124 
-190746680.01445207 19.066456823072798 
-446429094.78094107 19.916791143388082 
-622889167.02190733 20.249879158873767 
-968809448.55861676 20.691578503003054 
-431566436.97077864 19.882932024123299 
-939289338.46262789 20.660634124386782 
-143027135.78939876 18.778544930986911 
-644054839.6122458 20.283294435120574 
-93732117.522656724 18.355951458195385 
-434347973.85908788 19.889356553893784 
-177100948.70047802 18.992230459601945 
-786789139.74703145 20.4834708413171 
-582793011.90005958 20.183342641650739 
-672679546.03456604 20.32677961675769 
-895709197.79776382 20.613126362230215 
-794596273.09524357 20.493344711043367 
-605823808.44040108 20.222099756611172 
-514623993.1558848 20.058947081590706 
-761317958.65066528 20.450561645451341 
-610145678.68485498 20.229208304135422 
-527828629.11257875 20.084282222912908 
-378195984.99790734 19.750923098050595 
-321923597.09706599 19.589824799258189 
-186729492.78000441 19.04517156486321 
-812556574.15793622 20.515696099476973 
-791046679.50136507 20.488867537266774 
-296196427.21559191 19.506533397657677 
-384993209.42257726 19.768736254233072 
-302593633.22268951 19.527901318854912 
-644594509.80932355 20.284132010103821 
-261403411.45429236 19.381575409774257 
-105891688.12211281 18.477927319503689 
-560280024.40759456 20.143947260298329 
-748029827.92727208 20.432953412051805 
-423724722.97422993 19.864594564081479 
-970674532.0390842 20.693501781642155 
-578416398.85533226 20.175804580508114 
-127790758.75480522 18.665904787080407 
-515390437.86587799 20.060435303169683 
-710521913.57712412 20.381510347498892 
-74168244.891925082 18.121846650117742 
-444951917.97226357 19.913476784792216 
-)";
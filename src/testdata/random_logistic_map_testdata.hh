@@ -1,98 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_logistic_map_testdata = R"(
-3.8128080929226633 3.8091806128445485 0.94205767577438349 
-3.788473596789661 3.4625481544506083 0.46194500667365895 
-3.7627435956871191 3.2096249137226018 0.59543529046174826 
-3.4448107156447154 3.5469545042941855 0.84923446468745012 
-3.4302143135279337 3.6150470509799844 0.84699849975125185 
-3.4033754360959088 3.4287246234466324 0.84271073511146621 
-3.6125351076700891 3.2976163864631487 0.83988088980900444 
-3.107348861948354 3.9495025623347049 0.55406256679459198 
-2.9114982550150779 3.5558580809725604 0.65653422656960414 
-3.7479953969275455 3.6024236150821887 0.65031467856637237 
-3.1087484239246446 3.7691067472313922 0.55332597868057953 
-3.4182031830266668 3.5740468803972028 0.84510876111603295 
-3.5585519376797818 3.72944219420557 0.54965684324649466 
-3.3681710109125342 3.2093756237375728 0.83670523696721388 
-3.2961678624203476 3.539416679263649 0.8227992858961608 
-3.3672057598886997 3.2853907125703712 0.83653396452289153 
-3.1657673123741343 3.2333046055974557 0.78918616377785777 
-2.8154211787605647 3.4613756577814514 0.64481335597531053 
-3.683236008678445 3.0448486515453181 0.75690467999217415 
-3.6649874539318139 3.8686904425900162 0.30998854295400879 
-3.3849073000492247 3.4942356309568279 0.83961741911422871 
-3.1151602376303251 3.5047125653258382 0.77099825987754045 
-3.8766852672170935 3.0062599058581014 0.44725331890579678 
-3.1619536870277982 3.0918780634293457 0.78795514607336459 
-2.9243581848557398 3.6111858399250152 0.6580446249099503 
-3.7620820039669765 3.8858536210587604 0.87658916879072479 
-3.0576786896462411 3.4408775474707216 0.7426315191655658 
-3.6724683711846815 3.7327079903315767 0.30934998152548976 
-3.5678949337770534 3.3193731126831825 0.83997679077963272 
-3.5310177671204785 3.5488877352332744 0.88166585515076701 
-3.4474682448088756 3.3575142594952396 0.84960518071583679 
-3.2704006916797135 3.5550576214805774 0.81717499743327693 
-3.5447738859702058 3.0393486821702247 0.88508418594328808 
-3.3899717150897826 3.3355035302547842 0.84047787430753262 
-3.0238792231764728 3.7299787052935915 0.61409529615508551 
-3.5612852159831978 3.7089200381133773 0.49330947968617284 
-3.4856073426857472 3.8128188474970228 0.39127146501302362 
-3.1072528373561852 3.2912792283420682 0.76771440341281705 
-3.6763457659460292 3.2627959867414655 0.87567650344355208 
-3.4787205102147589 3.4822458310765305 0.86901246742891913 
-3.8203323833791578 3.3933597339469168 0.95082174060766689 
-3.5931242370775989 3.4535951424673761 0.88787861970291193 
-3.5781520711587831 3.1063803340032417 0.89024205002637069 
-3.8046131477191576 3.4061682488917233 0.88957775047260645 
-3.5738385331444329 3.8223643509357239 0.34977977824688761 
-3.4153254816621708 3.4141677553461309 0.84464909569925894 
-3.525035238665283 3.1687207387369858 0.88050414647281938 
-3.6825114984266629 3.4239134340186186 0.3137725584071317 
-3.0673284912255565 3.6118997685964023 0.57770540191241748 
-3.639592483827744 3.2448083326850257 0.81812686892683262 
-3.7400911441523959 3.2190931098760807 0.84264447015947874 
-3.8212378892468668 3.5969360291221388 0.16559260002809334 
-3.5761712097565894 3.5161332093503219 0.89186005341093366 
-3.4861692794453942 3.9653163195255985 0.87130637393427579 
-3.1287196036526916 3.7077702603672855 0.54330777691294541 
-3.7085640978797421 3.6344587476670589 0.30907527596127943 
-3.3248241726228951 3.8361032001096751 0.47214202654285065 
-3.4982537638860998 3.5221856177805129 0.87456331338374738 
-2.9865743011011756 3.6526656246338263 0.66516816823811897 
-3.537395767616399 3.5230285322952564 0.8828535502501953 
-3.7869804875316455 3.5148403467723659 0.86422387427163083 
-3.6297405121453248 3.553780013256806 0.90732730570570663 
-3.6061446313999763 3.4022765976156353 0.90139770254235574 
-3.4364649960788713 3.4394907411626607 0.84796398853319566 
-3.4448765892905246 3.7835967167442162 0.44104151373242828 
-3.2192427565470694 3.6093395964458499 0.505934753964289 
-3.4659889768769707 3.5242563635423148 0.86424981904213849 
-3.3042497830235047 3.2927211954303486 0.8244856336251154 
-3.3607720237662755 3.043544402697743 0.83538282872686342 
-3.4682558080457344 3.3730286986286186 0.83541961436292078 
-3.8240294295655946 3.3230969234314887 0.16189818906536266 
-3.5034548846958926 3.6352595196339719 0.8758330623900491 
-3.6689450039294389 3.5432195749710886 0.74325802963024357 
-3.7277420080481334 3.211150511894961 0.69507690996311156 
-3.5313801542266918 3.1540736409971215 0.8817346907482716 
-3.3954426346892306 3.3792437243732238 0.84139693695689066 
-3.2681740858323263 3.6502381814925289 0.48931112647179104 
-3.660630763712549 3.8591598365433093 0.39544563596626475 
-3.7302174115275299 3.2927454879980966 0.91765122345217864 
-3.52810708416634 3.3906037331651939 0.82203081261912969 
-3.8302519392167245 3.3247876608258236 0.15585262071867315 
-3.432225701614124 3.6199738327006634 0.8473104995006312 
-3.3804180972754749 3.3549736715370684 0.83884675636773276 
-3.3539703394262497 3.770194935767214 0.46400665208780328 
-3.1017528493197712 3.2124048753023144 0.7653399602117108 
-3.8093354215025341 3.3002157590166004 0.54489221141798805 
-3.1025496464899436 3.3264243552456882 0.76568881563390268 
-3.3435728787313175 3.7793012343758368 0.46686012645429181 
-3.5375885303539576 3.4308162313099988 0.82066117764645119 
-3.6385676595470362 3.5753441689742296 0.90891106807147637 
-3.5550818902615391 3.9894399995251404 0.37241648665556204 
-3.503263668292059 3.3160040863863989 0.82628789643288081 
-3.7796326213529072 3.509089164283083 0.20454262311275009 
-)";
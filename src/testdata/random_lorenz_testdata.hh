@@ -1,96 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_lorenz_testdata = R"(
--1.1167337153934134 19.270926437926633 -34.545292053935299 3.9771119829843409 -1.0947168611011846 28.866224193140965 
-8.6746356670528968 37.673334768124541 -8.2844956238297893 0.17575461796029432 -0.090137075552674861 16.817580820127642 
--8.9522265501549789 1.1917361856679312 -33.913684778297693 5.79242303333129 6.9816061183167308 21.734201379198257 
--27.213339362581269 -39.842288159125481 34.293485643943754 3.5060537135381806 6.4110236317376401 10.397599341946702 
--2.8717395520948843 -9.3837202908084336 -41.394945076721811 -5.6695176927287072 -9.1540180548013836 15.780010501777225 
--4.9254192203868818 28.522586094946476 12.724032629650083 -8.5898417340356268 -12.489080481119601 21.052863577056456 
--0.25757273553068921 10.529820590391775 1.9966726736309524 -4.1274005136720664 -6.8916471833049577 14.332971894622943 
-3.4308651751443615 13.906500121305044 17.014900467066216 -11.041241067757127 -9.9667994422609585 31.474570555692345 
-4.7375631026581733 31.762429447684923 -2.8260617038359332 -11.232096497415444 -10.32845130691982 31.54019421337733 
-7.0975036681094172 -0.53687951003798018 23.032123291631926 -9.8414225517545528 -8.1739484976092598 30.632324867959316 
-16.180737103174682 -9.7090916667202052 -12.193274877092204 -14.335432869281384 -8.7315441806157832 39.969415465486662 
--6.7819863172077541 13.433714841901089 -8.036148317389145 4.0019998433834081 6.9761844816446272 12.410807724485647 
--44.682318465394715 1.5183740129377652 2.2008583838135114 -10.532076307763646 -11.344249600030869 28.619446785235343 
--9.4794387139615335 -21.050838507900377 2.1964738663200483 -8.4019036741375075 -14.283187629290779 15.93214729624505 
--59.457987834458294 15.553938411530456 12.601736385797457 7.0573092981631564 8.0194478228347883 23.812503028004059 
-1.8888678196458639 -5.2468211001020961 4.1137964783585881 7.9023742359032703 8.1118801213424163 26.00339620639987 
-9.5874244502783679 15.928077486021115 -14.217728786650598 0.3200915147763681 0.64046887177973844 5.409303533176308 
-28.652959841265407 6.0578537437749267 -4.5879612981511144 4.5699439558800918 5.5464695582248602 20.477800155087085 
-13.503495382262196 -8.4991699981881546 -32.539437920844549 -5.5140349055111644 -10.398477215328541 9.72942126800179 
-3.6176328135138784 -20.422232610649765 -41.752662085691071 -3.249912751222384 -5.9042057163523776 10.532610040770713 
--5.1714379792088039 -25.54726711203238 8.4008524088743197 -7.0948196355064654 -12.050413117055315 15.065986403819862 
--4.7021370287724169 26.379690790088159 -8.6462085470437593 8.241045425234125 9.0237737484806022 25.61340950162273 
-24.782312855202239 -8.4762914169896781 -14.97232631164184 7.3220036774119359 7.7367986519863354 24.997674268815391 
-13.976617516561836 23.699083730316953 1.1344240512541821 -10.440580984422187 -6.1108963543659431 33.943261379724937 
--0.09256800082385741 -13.606772854861909 -15.530394514790089 -8.1330237617799543 -9.6992945410660703 24.284815499559915 
--0.57290923884956146 -0.31576293294130464 17.238012102309515 4.503106321044525 2.0069892356596939 26.245786632143993 
-1.8587242548257912 -17.139548106875012 -8.2724415304205738 18.900099347498223 14.148194865054178 46.413062734761212 
--34.549427480277558 -10.386277827709344 19.973741071618033 -2.6294543450002621 -5.1352203135315175 23.268728340868684 
-6.3994205149058985 -14.561127227298527 20.45184492695773 -9.3021657302749627 -7.981048691701365 29.607102183380523 
-3.0040794050341968 0.94440400366656108 16.012893642213783 3.4782388766176746 6.566701551828495 8.9071606957204459 
--6.1428071502115174 -3.1176087878389751 25.371577038952182 13.295467285776994 19.521134872285153 25.643861488113565 
-14.623802399651485 -16.90127056368345 -27.192766700167212 -0.03658377976431576 -2.3040309785899833 23.170166490852399 
--6.0760026026116822 -18.162659058299631 -5.0768087723219812 -8.9940179077829967 -10.242693596161407 26.251146335911411 
--7.8671907948222959 -19.953357137899058 18.489853413936125 -10.614422244950868 -14.553178218293223 24.327636397470219 
--28.298666849564725 11.804779859511365 7.2790814336314025 -9.8472014027664212 -16.481221789674567 17.684462333111657 
-40.194071396125757 8.7272181398282296 23.350897364737708 -0.27628461314795255 -2.5918727013225964 23.177529284736128 
-29.041679884929991 8.7269848407278801 10.732015786623762 -11.546709454829882 -6.071500582749124 36.237390321142556 
--39.191868228012098 25.516229040356517 -2.2683510933698812 -2.0220312882392131 -2.1429371124845797 19.009042056596922 
-2.8496024301847229 -39.044738586465776 -2.7468307572725825 -4.8179309750182586 -7.714036602333783 16.094568422375357 
-18.882045432462771 -41.53109939068387 -4.257943450321779 -3.7410693850395029 3.8690489278658227 31.109777505064294 
--37.937354036449527 -22.117224291866968 -5.0298809902497785 -7.7304896623320838 -11.554698655022593 19.411823200288723 
-16.708476563059101 -4.0849997571803218 42.244531177602205 -15.090230166810773 -20.173549402621223 30.559777341946059 
--15.410439911991167 16.661441243964632 -20.094740883524512 -1.8496621038232643 -1.9216843733394491 18.895397810860619 
--15.344288017658732 10.349007952832608 -34.070689012304257 8.7041377515342209 10.053005216159487 25.401346181301118 
--42.801907303485827 2.5017632937162979 11.486464753462775 -10.413294131020242 -8.2407259640239587 31.838156183066783 
--8.5998998800639672 9.2238146323995327 22.486299671732667 6.5523362617925525 2.4111340284501974 29.819732898024068 
--11.455016069165556 -11.203467038290807 -5.7842832656783276 11.386072132986225 8.5521866798015829 33.700894759250694 
-12.019593824199513 -13.363219611905102 -1.0116752412782535 -10.965310999655399 -16.958683201417678 21.443480957026715 
--2.1080101621604435 25.112181438135366 -5.522302739029378 10.30347806271226 6.8252606306275831 32.996052119461837 
-10.815198343196453 27.969192143651046 -2.567031208220476 9.8017769107607613 9.5633017477824911 28.940094118178425 
--4.2987447375709493 12.751337306132097 1.9562832662519514 7.885014871501757 8.8732605936961431 26.868773452357662 
--28.397492426101195 -20.917747056083552 0.25900664900853437 4.5131959613986803 1.9787708953484575 26.304635924995836 
--13.595494568325684 -1.654538854358599 32.360219727572989 2.0438186012522577 3.0805105912784141 15.253956678239792 
--18.885544885436879 1.4269482149665267 25.798821898885738 7.6661681075450572 12.555916537575623 16.679649353016838 
-28.966823024656097 -20.306069228562595 -21.256098286406822 0.23312198127323333 0.22825659502999474 14.725344369320853 
--11.901898083587703 -6.7480427481416108 -20.478329582026625 5.5763316123494313 3.0609767489768576 27.15795180109231 
--21.659722699744282 2.4338457315920712 -5.5017390198250515 2.6625727328670932 4.9158395707843772 9.6820483693294666 
-25.064195658746911 10.739291255929553 3.4720364231758727 7.7668236560214075 12.86781369519472 16.421827816999443 
-21.364834845737324 -10.515539868066309 1.0625629577309716 3.7736984199473924 6.2061573323256676 14.864122080399763 
--3.761656517978218 -14.149777517764299 12.739131206525062 -3.8073118101750634 6.4660430709019039 33.223545068258197 
--19.814537871370437 3.49540554603358 19.525394578334605 -10.314051715129615 -11.906994908901837 27.397933740522987 
--31.370858622841226 -5.2339471674583518 -17.397638746661666 8.0449822080304969 8.6710835506200912 25.58858495280997 
--19.288236898948739 13.639392818348188 16.946203444209782 6.9000063683356272 10.358706730178854 19.035055759264345 
--6.5178054926057341 -22.017115162362337 -20.682033250766956 -5.1495452681673086 -7.6107981217028629 19.131547733569459 
--9.9708852339226013 3.5821718106645073 -5.3043571624846599 -9.62616638058247 -12.010136642287311 25.173051388271624 
--2.8461363723659256 -4.4479116176554765 3.2706808887531951 -6.6318706088568824 -9.86077169643975 18.655537490237815 
--2.0149047769798392 0.173050115724382 2.5426264189260879 -2.4608234339459707 -2.6502239760863997 19.458518634258976 
--18.860976051745372 29.025892693488711 -29.649065292517975 -12.108414770751331 -12.856290436151374 30.911296252987874 
--32.777739702219193 -3.4552260834212967 38.327340662146071 -6.0215331824855278 -8.0775438138663223 20.286875460144302 
--7.7894933051574222 4.4673414143255643 24.993974252343666 -12.299993149921979 -2.8952994300962964 40.111666753309827 
-30.174495933794987 32.608664801528334 20.665948629957782 9.686715366576836 6.6307295921255296 31.87632356448632 
--5.3231619441722451 -34.171926969810599 -28.482063899735994 -8.8284062862404653 -16.064198979344177 13.421306740574755 
--24.975556521332663 -26.62650455474223 -13.100976914509037 -1.1485500772066461 -2.1403756124874636 17.852125837948527 
--8.5106349507234089 15.619345319812691 13.709974922475034 9.8287485834399426 14.930008030641471 20.856219241735761 
-40.58539420764837 -8.4894844610172555 11.242982509218233 6.3167276813771176 11.739805767030349 10.824414164688003 
--7.8345549367036158 -13.116455205331231 31.297985114790514 -1.7179654739091339 -2.8993656936241212 17.284092695334341 
--12.163095493348683 10.264951320522123 -16.997704091005744 1.4818512321087582 2.5044485870352933 14.797661890581143 
--11.222105288324419 30.046753585726638 8.5737712499633343 10.102085967544113 14.246875233923561 23.18383853780195 
--13.683447439187592 13.780615793325868 -4.4960242272933275 -2.7683005767021962 -0.032152511972589136 25.352413335115198 
-0.13805413801383903 11.112717569691412 6.6165783206781299 -7.9444433798242713 -7.7695443526343997 26.579898440263623 
--22.718987296015957 24.157328959607035 -7.5249629624317329 13.407139370235861 8.678540948078501 37.993866606719443 
-4.5048574919973285 0.8848219395759378 -4.0912795796478205 13.264910643439899 18.768694745692379 26.65385782734873 
--1.1088865798770815 -21.392855265849398 -4.7114144224637524 3.5663915865220379 6.0141621791545088 23.324466710327879 
--18.445666713864398 3.531026897623875 -8.6168993635565307 -9.8481802659267235 -11.450302278727827 26.628192321057661 
--14.862277115967352 1.6413790799912396 -29.669492814409484 9.7628023190999045 7.0262939389408858 31.642986571894486 
-12.234763268957053 21.948895221429744 22.278526440010641 1.586813777865911 2.6792665352792873 16.567128392346302 
--18.926480413281585 6.6086456116474954 -10.149759125582911 -5.9054354317166178 -8.2443045445235601 21.175100881760127 
-25.170062249952494 -4.0115243182539508 20.393192276741516 6.8327525992785949 4.7475212619356046 27.803853515340652 
-14.52222686567543 5.1560606347932616 40.412223029740261 1.8383913311611715 3.3268176479190958 19.77858675729918 
--7.7428577013674138 -1.1513648961444503 17.041620170197344 -8.4437598008362169 -9.46147021572102 25.537154357843161 
-3.0770157178266659 2.8396814196523987 12.730297474385646 -6.6303167723543472 -4.7740626286635663 27.323187179284979 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_mandelbrot_testdata = R"(
--48.545941702515492 4.2570543565014924 -48.545941702515492 4.2570543565014924 
--10.628233890200994 -0.050208980193165241 -10.628233890200994 -0.050208980193165241 
--15.420123490243247 -0.80717467556420974 -15.420123490243247 -0.80717467556420974 
--10.834779432751782 18.874285663247747 -10.834779432751782 18.874285663247747 
-15.792453727571377 10.324003726838759 15.792453727571377 10.324003726838759 
-7.1486294631500673 -7.6010541924215413 7.1486294631500673 -7.6010541924215413 
-5.8901642806936181 -30.522460583215157 5.8901642806936181 -30.522460583215157 
--25.764930191106316 -16.858040601831124 -25.764930191106316 -16.858040601831124 
-3.1398059495962705 3.5760729823888959 3.1398059495962705 3.5760729823888959 
-10.424760617019919 10.410894707672465 10.424760617019919 10.410894707672465 
-13.003241433409126 -23.38893751940876 13.003241433409126 -23.38893751940876 
--11.822782334623945 18.299548437768671 -11.822782334623945 18.299548437768671 
--5.9285973540866612 -9.0356263754299917 -5.9285973540866612 -9.0356263754299917 
--2.459894035572558 -8.5320706231045982 -2.459894035572558 -8.5320706231045982 
-8.4799881188532691 -24.432761486988817 8.4799881188532691 -24.432761486988817 
-2.0260870706706853 -6.6004195774885064 2.0260870706706853 -6.6004195774885064 
-4.4467832037586117 -11.600408752762103 4.4467832037586117 -11.600408752762103 
-24.255679120356707 -32.498021775931832 24.255679120356707 -32.498021775931832 
--27.766764824454448 8.7640517846328621 -27.766764824454448 8.7640517846328621 
-41.061562515829792 -16.318535669519537 41.061562515829792 -16.318535669519537 
-8.4141275830634559 -21.35522063538879 8.4141275830634559 -21.35522063538879 
--22.727159373107149 20.724198479644016 -22.727159373107149 20.724198479644016 
-30.974201845200085 0.50770813669222337 30.974201845200085 0.50770813669222337 
--23.105357993688553 -14.410009423301059 -23.105357993688553 -14.410009423301059 
-35.83041658519749 -39.012952565664364 35.83041658519749 -39.012952565664364 
--45.687641449963451 -11.125611919834812 -45.687641449963451 -11.125611919834812 
-20.373438102995991 34.960654797618368 20.373438102995991 34.960654797618368 
-11.422005754372393 -11.40607771277285 11.422005754372393 -11.40607771277285 
-27.115048310076769 -5.8992670493174977 27.115048310076769 -5.8992670493174977 
-23.772869908060898 11.669578492382817 23.772869908060898 11.669578492382817 
-18.792373489725463 40.918700743042166 18.792373489725463 40.918700743042166 
-14.953308325232879 35.209276378010273 14.953308325232879 35.209276378010273 
-31.165398708311677 -6.6404025401790081 31.165398708311677 -6.6404025401790081 
-43.483021622752645 -3.0160843345308819 43.483021622752645 -3.0160843345308819 
-47.715446036159634 3.0568868790737129 47.715446036159634 3.0568868790737129 
--10.983076182146352 -4.2770342922492102 -10.983076182146352 -4.2770342922492102 
-11.788561660515533 -17.462594149370581 11.788561660515533 -17.462594149370581 
-19.624004514880113 -0.1209158656999165 19.624004514880113 -0.1209158656999165 
-0.68918306736137991 -35.184753586385511 0.68918306736137991 -35.184753586385511 
-13.456496236744842 13.510810922970812 13.456496236744842 13.510810922970812 
--24.020622176783256 18.659706731339615 -24.020622176783256 18.659706731339615 
-4.0615059317130644 -5.9422817070868543 4.0615059317130644 -5.9422817070868543 
--33.347004671426326 -16.879574192561897 -33.347004671426326 -16.879574192561897 
--6.3824831589406159 12.168231580430252 -6.3824831589406159 12.168231580430252 
--4.2303410562742858 -16.86482638000091 -4.2303410562742858 -16.86482638000091 
--11.095260554026435 -9.3904283742090175 -11.095260554026435 -9.3904283742090175 
-24.422888577190001 -8.2753311833132877 24.422888577190001 -8.2753311833132877 
-0.93595657875603311 20.857228205100302 0.93595657875603311 20.857228205100302 
--32.486679957522149 -6.0168624694537627 -32.486679957522149 -6.0168624694537627 
-8.0692956873529749 36.697871579782692 8.0692956873529749 36.697871579782692 
-3.2713129801616962 -8.9050134379121371 3.2713129801616962 -8.9050134379121371 
--21.143163133105041 -9.6871729436756944 -21.143163133105041 -9.6871729436756944 
-14.050671248175487 -45.263998558115617 14.050671248175487 -45.263998558115617 
--2.0499871552373099 -16.188587498430888 -2.0499871552373099 -16.188587498430888 
--7.7651427137921116 -2.7168474751411771 -7.7651427137921116 -2.7168474751411771 
-4.9033632005537866 5.3198153467415032 4.9033632005537866 5.3198153467415032 
--30.421738011848866 25.415532620952284 -30.421738011848866 25.415532620952284 
--8.7627208375427461 9.8949162285847017 -8.7627208375427461 9.8949162285847017 
-5.6415954327877937 2.2600484994521493 5.6415954327877937 2.2600484994521493 
-28.572773130280314 25.106622475923352 28.572773130280314 25.106622475923352 
-5.5887706356276521 -10.298046712923753 5.5887706356276521 -10.298046712923753 
-15.603486151766315 -12.48938568299485 15.603486151766315 -12.48938568299485 
-7.894096004738528 21.634010771747004 7.894096004738528 21.634010771747004 
--0.84592157893070408 -5.6743716218141085 -0.84592157893070408 -5.6743716218141085 
-20.268858159303143 24.588982899906643 20.268858159303143 24.588982899906643 
-4.5662400984010025 22.309939227991812 4.5662400984010025 22.309939227991812 
--16.357162667685795 -6.2446442687163151 -16.357162667685795 -6.2446442687163151 
-19.047490816953417 17.600303330577983 19.047490816953417 17.600303330577983 
-1.3009919371643845 -0.55692886424710553 2.6834021978995515 -2.0060487881663103 
-6.7842704259483178 -17.141143822363766 6.7842704259483178 -17.141143822363766 
-15.745717224064354 -10.420566920545673 15.745717224064354 -10.420566920545673 
-28.927602248430922 15.008856722235151 28.927602248430922 15.008856722235151 
-5.7614935889860348 17.900005634005691 5.7614935889860348 17.900005634005691 
-13.983124001861931 -12.783821213654189 13.983124001861931 -12.783821213654189 
--21.330998106164934 2.8118079487728957 -21.330998106164934 2.8118079487728957 
--4.67310494502245 7.1250308919383336 -4.67310494502245 7.1250308919383336 
-1.2340683054209665 51.424933296407218 1.2340683054209665 51.424933296407218 
-19.875744097835273 15.349024146540529 19.875744097835273 15.349024146540529 
-11.828616497200377 -46.289545428228998 11.828616497200377 -46.289545428228998 
--7.6588973120860082 7.0347589745571444 -7.6588973120860082 7.0347589745571444 
--26.074253750673826 -11.108572305981294 -26.074253750673826 -11.108572305981294 
-21.088619599870086 -16.304631353366251 21.088619599870086 -16.304631353366251 
--9.1421523189071827 -8.2146237830611675 -9.1421523189071827 -8.2146237830611675 
--20.115142492571913 3.5851863444480654 -20.115142492571913 3.5851863444480654 
--4.82447701631631 9.3800335305643898 -4.82447701631631 9.3800335305643898 
--7.1426682403682973 -17.9889086417591 -7.1426682403682973 -17.9889086417591 
-20.329639020912246 -20.201412171386089 20.329639020912246 -20.201412171386089 
-35.225379120108123 -0.15802672606188062 35.225379120108123 -0.15802672606188062 
--11.305033331242457 20.244467247277115 -11.305033331242457 20.244467247277115 
-2.2577171825844951 -16.507328114393381 2.2577171825844951 -16.507328114393381 
-2.8316365981211709 -33.632599965593478 2.8316365981211709 -33.632599965593478 
--6.8138879286844407 18.632227730169227 -6.8138879286844407 18.632227730169227 
-32.096895060289079 -6.5036988437369523 32.096895060289079 -6.5036988437369523 
-11.380553752805429 4.9833589430542657 11.380553752805429 4.9833589430542657 
-18.408179414544822 24.848951712859577 18.408179414544822 24.848951712859577 
--13.140256938656375 -7.3182761494033386 -13.140256938656375 -7.3182761494033386 
--22.762295284624571 -18.309910276025086 -22.762295284624571 -18.309910276025086 
-22.617413365859093 20.246342120019353 22.617413365859093 20.246342120019353 
-12.877336651367735 4.8166910492314514 12.877336651367735 4.8166910492314514 
-6.5840460708329793 2.3831462799350343 6.5840460708329793 2.3831462799350343 
-)";
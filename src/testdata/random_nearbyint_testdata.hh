@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_nearbyint_testdata = R"(
-825887113.73999262 825887114 
-381572974.91756988 381572975 
--307750893.65607285 -307750894 
--978014643.57417309 -978014644 
-759983127.41757178 759983127 
-586166597.47529697 586166597 
-207960833.89163923 207960834 
-682631947.80029249 682631948 
-312256567.18751693 312256567 
--259602639.54100049 -259602640 
--571398403.46703982 -571398403 
-524300875.57653093 524300876 
--276194880.55622196 -276194881 
-451880652.0091815 451880652 
--931117325.68078327 -931117326 
--523924018.25307459 -523924018 
--491101733.24895614 -491101733 
-300553884.50529003 300553885 
--257460224.21582019 -257460224 
--126501704.33007872 -126501704 
-879645336.73644304 879645337 
-78000231.048252106 78000231 
--604490829.1509335 -604490829 
--908407756.2510736 -908407756 
-782192770.19927049 782192770 
--450895570.05992675 -450895570 
--970265699.58273506 -970265700 
-961836972.55434966 961836973 
--786442559.02087891 -786442559 
-465434203.71109867 465434204 
--409090077.03580976 -409090077 
--648167845.32320905 -648167845 
--747339293.4694593 -747339293 
-259193114.09704518 259193114 
-922622594.70230293 922622595 
-490789799.09708786 490789799 
-433593316.05283642 433593316 
-668630087.21728325 668630087 
--288114045.06260169 -288114045 
--3882342.0759356022 -3882342 
-857359657.56600022 857359658 
-24421905.956956148 24421906 
-305252915.84474349 305252916 
-390648085.15012527 390648085 
--470466012.7602284 -470466013 
-355309731.81494856 355309732 
-555716426.51330638 555716427 
--900570175.67099512 -900570176 
--844987732.69534945 -844987733 
-349636664.30643153 349636664 
--565689533.85329413 -565689534 
--179621769.92194557 -179621770 
--834754007.02048492 -834754007 
--52191046.899394035 -52191047 
-602219419.77601981 602219420 
-891082691.00392199 891082691 
-217606953.56080604 217606954 
--122197855.91081369 -122197856 
-806458310.38778853 806458310 
--643577706.14626288 -643577706 
-35587100.442209482 35587100 
-386272371.16228342 386272371 
-849692422.75229383 849692423 
--135991439.37069643 -135991439 
--788987593.0856905 -788987593 
-152317695.19350171 152317695 
--448040978.47247565 -448040978 
-422551055.59855461 422551056 
-311531509.09795785 311531509 
--277065997.45883 -277065997 
--334920293.41398382 -334920293 
--837689557.32331347 -837689557 
--806574348.43874061 -806574348 
-545867429.71982694 545867430 
--10831296.918611288 -10831297 
-309071401.11094522 309071401 
-288246640.67121339 288246641 
--911966016.55710125 -911966017 
--580076226.25910258 -580076226 
--488174761.58700633 -488174762 
-320896636.58530855 320896637 
--789207614.54542971 -789207615 
--716235645.07047307 -716235645 
-624166588.03009582 624166588 
-321322772.71527958 321322773 
--875493563.21246064 -875493563 
-519787080.81209683 519787081 
--548175162.27548707 -548175162 
--76005791.11848712 -76005791 
--953741727.96545589 -953741728 
-563304945.35907316 563304945 
--746211825.60757184 -746211826 
--594085925.78553367 -594085926 
-174947377.79289389 174947378 
-220381910.85413718 220381911 
-905433902.28152204 905433902 
-760418519.48005581 760418519 
-89854155.819321394 89854156 
-700667385.98066258 700667386 
-615047632.3900702 615047632 
-)";
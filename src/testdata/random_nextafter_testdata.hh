@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_nextafter_testdata = R"(
-6.0200865992196496e-07 7.538579227412846e-08 6.0200865992196485e-07 
-6.519104329410715e-07 1.3073650920381591e-07 6.5191043294107139e-07 
-6.7264791670595367e-07 7.1797989209891977e-08 6.7264791670595356e-07 
-1.1052818762604315e-07 3.5668580267718793e-07 1.1052818762604316e-07 
-8.1262937808918856e-07 6.0919909430827047e-07 8.1262937808918845e-07 
-1.8899137754444609e-07 9.483830540959513e-07 1.8899137754444612e-07 
-2.7116984773871134e-07 3.4323055237680195e-07 2.711698477387114e-07 
-7.7742094794411047e-07 6.9084971203628132e-07 7.7742094794411036e-07 
-9.8809908110101912e-07 9.8154469557384012e-07 9.8809908110101891e-07 
-8.8708717967478363e-07 4.0993051254159273e-07 8.8708717967478353e-07 
-8.0518108503829842e-07 7.5957601153144053e-08 8.0518108503829831e-07 
-3.3469981723030082e-07 9.8135958655033867e-07 3.3469981723030087e-07 
-5.2768958888836347e-07 9.8524523218684284e-07 5.2768958888836357e-07 
-9.3167648134088537e-07 1.9540151713061085e-07 9.3167648134088527e-07 
-8.7018525976908097e-07 2.8048214336183413e-07 8.7018525976908087e-07 
-2.6423389856243399e-07 6.3443237982933361e-07 2.6423389856243404e-07 
-5.308142959546769e-07 2.5519854367861211e-07 5.308142959546768e-07 
-9.6811260477982574e-09 9.4105466241575537e-07 9.6811260477982591e-09 
-6.0430989296677934e-07 4.5234239006546074e-07 6.0430989296677923e-07 
-8.3669961026603053e-07 5.6500801039415538e-07 8.3669961026603043e-07 
-1.1011814658817283e-07 8.5971907221072136e-08 1.1011814658817282e-07 
-6.8992302596227013e-07 8.4417091465778382e-07 6.8992302596227023e-07 
-6.1241121803619476e-07 9.3808190498916515e-07 6.1241121803619487e-07 
-5.6716732677122841e-08 8.8384893756852309e-07 5.6716732677122848e-08 
-9.2681437097563764e-07 5.1524914758104442e-07 9.2681437097563753e-07 
-1.143768410708905e-07 2.9418462605860335e-07 1.1437684107089051e-07 
-3.5242114387852848e-07 5.8865125745723948e-07 3.5242114387852854e-07 
-9.8751221332005552e-08 1.8722970878284949e-07 9.8751221332005565e-08 
-6.2483796857297948e-07 1.130629074180285e-07 6.2483796857297937e-07 
-8.0668608341522811e-07 6.8793136191992887e-07 8.06686083415228e-07 
-6.7208084291191118e-07 6.3886316125837824e-08 6.7208084291191107e-07 
-8.6736312825623607e-07 9.1176007133532647e-07 8.6736312825623617e-07 
-2.615552909744699e-08 1.2610054149358084e-07 2.6155529097446993e-08 
-4.1188848636219926e-07 9.5007994137196318e-07 4.1188848636219931e-07 
-3.8147345500777955e-07 6.6634746987541227e-07 3.814734550077796e-07 
-5.8811085206737121e-07 6.6524299595457893e-07 5.8811085206737132e-07 
-8.0201383712650523e-07 5.6778499297864892e-07 8.0201383712650513e-07 
-1.1834154190979947e-07 2.340915438850505e-07 1.1834154190979948e-07 
-3.5467414296695669e-07 5.6057617734792583e-07 3.5467414296695675e-07 
-6.4120788513687397e-07 2.1370331904724883e-07 6.4120788513687387e-07 
-4.0600313473116609e-07 1.1965428953740938e-07 4.0600313473116604e-07 
-8.6862289544389098e-07 2.1876427286104774e-07 8.6862289544389087e-07 
-3.4235886710950037e-07 6.5270411894993837e-07 3.4235886710950042e-07 
-8.5738167161734339e-07 6.7809673777805994e-07 8.5738167161734328e-07 
-7.6335924338598194e-07 2.9924954335775577e-07 7.6335924338598183e-07 
-9.8418537299078261e-07 3.8038866960135048e-07 9.841853729907824e-07 
-9.783053024817775e-07 3.2779951642925205e-07 9.7830530248177729e-07 
-4.2537873302537808e-07 3.3033057172477732e-07 4.2537873302537803e-07 
-5.3340151853169777e-07 8.9645677539235331e-07 5.3340151853169788e-07 
-2.5491604139170747e-07 3.3780682641927004e-09 2.5491604139170742e-07 
-7.4391895866022802e-07 9.0953496969502679e-07 7.4391895866022813e-07 
-1.0458451521898371e-07 9.41366048541711e-07 1.0458451521898373e-07 
-7.5105534744611871e-07 1.3066757953264285e-07 7.5105534744611861e-07 
-3.5147251008699343e-09 7.0848493730538001e-07 3.5147251008699347e-09 
-2.3936965649905104e-07 8.9721591111037663e-07 2.3936965649905109e-07 
-1.4159991770555183e-07 4.7016627497765933e-08 1.415999177055518e-07 
-4.4867376272687178e-08 2.1816868846207509e-07 4.4867376272687184e-08 
-7.0933105352933145e-07 3.7857568765464611e-09 7.0933105352933134e-07 
-9.1086594077631538e-07 1.0304908117089512e-07 9.1086594077631527e-07 
-9.5400745789220791e-07 9.3923374627082879e-07 9.5400745789220769e-07 
-5.6576898676138552e-07 7.471383942554869e-07 5.6576898676138563e-07 
-7.787288857080807e-07 8.6659745922986747e-08 7.787288857080806e-07 
-3.4004160121423062e-07 5.5122216090897237e-07 3.4004160121423068e-07 
-8.057166813226066e-07 1.6624769852841397e-07 8.057166813226065e-07 
-7.4806168412345178e-07 2.4451783468683165e-07 7.4806168412345167e-07 
-8.8526616892774556e-07 5.2843347168280635e-07 8.8526616892774545e-07 
-5.8111979553969959e-07 2.705760334456209e-07 5.8111979553969949e-07 
-2.616965697802289e-07 1.6878142703366445e-07 2.6169656978022885e-07 
-7.3558803634531628e-07 3.0478654229272513e-07 7.3558803634531618e-07 
-6.2371708563046694e-07 9.4391663753384672e-07 6.2371708563046705e-07 
-9.6489512931738121e-07 5.7026149242646133e-07 9.64895129317381e-07 
-8.3858881284799007e-07 8.5136593310627648e-07 8.3858881284799017e-07 
-2.8443970973332828e-07 2.6435812305961072e-07 2.8443970973332822e-07 
-6.8347956308845902e-07 6.5374031314460335e-07 6.8347956308845891e-07 
-9.0125412460627916e-07 1.1865888059342042e-07 9.0125412460627906e-07 
-3.7591051709621284e-07 2.6356692657874711e-07 3.7591051709621278e-07 
-3.8585807151993628e-07 8.022558635178065e-07 3.8585807151993633e-07 
-1.9185201230975998e-07 7.400126661178117e-07 1.9185201230976001e-07 
-2.7983303634090989e-07 2.9918378457336907e-07 2.7983303634090994e-07 
-3.710240121433645e-07 8.638075631695688e-07 3.7102401214336455e-07 
-1.3850112196624706e-07 6.7419176477548738e-07 1.3850112196624708e-07 
-2.6542996422485325e-07 1.6150891314450405e-07 2.654299642248532e-07 
-1.0851684888641893e-07 2.7632695628661208e-07 1.0851684888641894e-07 
-2.0959778178786189e-07 6.8753006260301922e-08 2.0959778178786187e-07 
-5.8526669504895896e-07 7.1070397319739493e-07 5.8526669504895906e-07 
-2.5531902853236434e-07 5.7183637985223044e-09 2.5531902853236429e-07 
-4.9619450530118891e-07 4.1975398957500562e-07 4.961945053011888e-07 
-7.5591816116727001e-07 4.945067420195116e-07 7.559181611672699e-07 
-8.9347909952903475e-07 1.293428716636175e-07 8.9347909952903464e-07 
-7.47675123415895e-07 5.5215006640541327e-07 7.476751234158949e-07 
-2.4668790026630822e-07 5.2445418127535468e-07 2.4668790026630827e-07 
-9.6159729924989767e-07 4.2028167468120225e-07 9.6159729924989746e-07 
-6.0814810040233646e-07 3.4337074305532547e-07 6.0814810040233635e-07 
-6.2410336732543008e-07 8.0670725291574065e-07 6.2410336732543019e-07 
-2.2952139078725767e-07 2.7533008493433971e-07 2.2952139078725769e-07 
-3.5763366020516149e-07 8.63963991496283e-07 3.5763366020516154e-07 
-4.7981607174885548e-07 1.7773936058729901e-07 4.7981607174885538e-07 
-1.9208741827918992e-07 9.0410613797181454e-07 1.9208741827918995e-07 
-1.813551676279228e-07 7.3686039525350129e-07 1.8135516762792283e-07 
-4.782381011894806e-07 7.660370225155161e-07 4.7823810118948071e-07 
-)";
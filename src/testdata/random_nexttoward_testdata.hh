@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_nexttoward_testdata = R"(
-7.6663261434865447e-07 9.6631324798648046e-07 7.6663261434865457e-07 
-6.2915141772572576e-07 7.6789351397602989e-07 6.2915141772572586e-07 
-5.8840325203262018e-07 3.2716350957665224e-07 5.8840325203262008e-07 
-7.7659915539794138e-07 8.7384326682338594e-07 7.7659915539794149e-07 
-4.6022580567970552e-07 7.4166379758601222e-07 4.6022580567970557e-07 
-6.316052245116833e-07 5.6031200956584744e-07 6.316052245116832e-07 
-8.8966132233235425e-07 5.4374252555125759e-07 8.8966132233235415e-07 
-6.524875970112216e-07 2.2084264906849369e-07 6.524875970112215e-07 
-6.9621095097134183e-07 6.6683964715685001e-07 6.9621095097134172e-07 
-4.9037393751989856e-07 4.0038806542999646e-08 4.9037393751989845e-07 
-2.2318451884298426e-07 5.4917964760312964e-08 2.2318451884298423e-07 
-4.3601739580884752e-07 3.5627839819174446e-07 4.3601739580884747e-07 
-2.4626453775574416e-07 7.9981232793359239e-07 2.4626453775574421e-07 
-9.9827350272088248e-07 8.0838940089230511e-07 9.9827350272088227e-07 
-7.2492640960988206e-07 1.5512052896919528e-07 7.2492640960988195e-07 
-2.5670312372172121e-07 8.8349706109089259e-07 2.5670312372172127e-07 
-4.4220405912575695e-07 3.2100348257733285e-07 4.422040591257569e-07 
-7.7701070849819103e-07 4.4264021469535782e-08 7.7701070849819092e-07 
-5.3530685254370712e-07 4.9147127663274088e-07 5.3530685254370702e-07 
-7.9129437905788516e-07 1.9891039020786123e-07 7.9129437905788506e-07 
-9.9645269570470149e-07 1.924371184457558e-07 9.9645269570470128e-07 
-7.3736233035527716e-08 8.9698017091224062e-07 7.3736233035527729e-08 
-4.2907712915675074e-07 3.5637740824455147e-07 4.2907712915675069e-07 
-7.8224972215942733e-07 4.6014691879944795e-07 7.8224972215942722e-07 
-5.8352288082721734e-07 2.982922741688575e-07 5.8352288082721724e-07 
-6.1308126409863255e-07 2.6179675685210695e-07 6.1308126409863245e-07 
-2.2492440873806945e-07 5.1055529373848458e-07 2.2492440873806947e-07 
-8.6099574517270601e-07 5.353892931457891e-07 8.6099574517270591e-07 
-1.4608796129519527e-07 6.6663555915751862e-07 1.4608796129519529e-07 
-8.9108688492202828e-07 3.4454808310032801e-07 8.9108688492202818e-07 
-4.6445506904642357e-07 5.0431366936893951e-07 4.6445506904642362e-07 
-7.1477004460616885e-07 7.7086935586476263e-07 7.1477004460616895e-07 
-1.0910844125830577e-07 1.6452944126299313e-07 1.0910844125830578e-07 
-7.8834506696772777e-07 2.5432235542371159e-07 7.8834506696772766e-07 
-8.2124954006953812e-07 3.7487116449646587e-07 8.2124954006953801e-07 
-4.9835206800445576e-07 2.3398008979819016e-07 4.9835206800445565e-07 
-3.1424043241468194e-07 3.6493360608250951e-07 3.1424043241468199e-07 
-8.1943711498518974e-07 9.8694654248657004e-08 8.1943711498518963e-07 
-1.0738764521250592e-07 4.4420954880903598e-07 1.0738764521250593e-07 
-2.3824308826477419e-07 5.0780509820959481e-07 2.3824308826477421e-07 
-3.804289584720098e-07 4.6828167530759218e-07 3.8042895847200986e-07 
-7.9804305305457161e-07 7.0988069039210216e-07 7.980430530545715e-07 
-2.8759132688126381e-07 1.5562480026257914e-07 2.8759132688126376e-07 
-1.1922564158366113e-07 2.6266313488515402e-07 1.1922564158366116e-07 
-7.9211229343287346e-07 1.9592197306954075e-07 7.9211229343287335e-07 
-6.0572634446689868e-07 1.7602522238222989e-07 6.0572634446689857e-07 
-3.3208105313817484e-07 2.9085462791500352e-07 3.3208105313817479e-07 
-9.2739922729330798e-07 7.5267226762278552e-07 9.2739922729330788e-07 
-6.7674685309507176e-07 4.5697909479897299e-07 6.7674685309507165e-07 
-2.4162031865660909e-07 1.4645841098673351e-07 2.4162031865660904e-07 
-2.4399923015971106e-08 1.4611832758190622e-07 2.4399923015971109e-08 
-4.9234898159534435e-07 3.352943274568305e-07 4.9234898159534425e-07 
-1.0670223748009846e-07 9.2864179493878841e-07 1.0670223748009847e-07 
-4.6954977811661167e-07 7.8582619754414351e-07 4.6954977811661172e-07 
-6.0960680714236631e-07 8.9983615300198567e-07 6.0960680714236641e-07 
-8.0874037438141767e-07 3.3218283570198889e-07 8.0874037438141757e-07 
-1.9980147521338341e-08 2.9765274367213252e-07 1.9980147521338345e-08 
-4.7732418959299828e-07 3.4874746700609823e-07 4.7732418959299817e-07 
-7.7526168969885899e-07 7.9276191476515733e-07 7.752616896988591e-07 
-2.8567238862746652e-07 2.1188932917112292e-07 2.8567238862746647e-07 
-4.3925677135857972e-07 5.5047149764940101e-07 4.3925677135857977e-07 
-3.0106976458355056e-07 8.7091377822554719e-07 3.0106976458355062e-07 
-9.9315486729813796e-07 7.2797533154712721e-07 9.9315486729813775e-07 
-1.183982383589817e-07 8.4696380094200861e-07 1.1839823835898171e-07 
-9.1844366909670944e-07 7.2107979485417602e-07 9.1844366909670933e-07 
-1.2044898945129673e-07 6.5448763268351956e-07 1.2044898945129675e-07 
-2.778027763057353e-07 7.8916632045976102e-07 2.7780277630573535e-07 
-1.8307037643529312e-07 9.7444523278238772e-07 1.8307037643529314e-07 
-6.9565335890438234e-07 3.2649781624687695e-07 6.9565335890438223e-07 
-5.2899565149665452e-07 7.5963844657447195e-09 5.2899565149665442e-07 
-2.2330446707150697e-07 2.7461435197207873e-07 2.23304467071507e-07 
-3.4439387922667387e-07 8.82534578764753e-07 3.4439387922667392e-07 
-3.5162729827191272e-08 2.9155514839890178e-07 3.5162729827191278e-08 
-1.1401864602863523e-07 7.9857663200153303e-07 1.1401864602863524e-07 
-3.2037639159875467e-07 3.7214978815239381e-07 3.2037639159875472e-07 
-7.1226755259235817e-07 3.3234730535652538e-08 7.1226755259235806e-07 
-7.5095326661616308e-07 8.8565090243614895e-07 7.5095326661616319e-07 
-3.7849944511148553e-07 1.3911843003937873e-07 3.7849944511148548e-07 
-8.6238860280894489e-07 6.1320739678133522e-07 8.6238860280894478e-07 
-8.4984179509173355e-07 5.7817449064656865e-07 8.4984179509173345e-07 
-1.3846130582317638e-07 9.8726554495071127e-07 1.384613058231764e-07 
-2.1214905030545011e-07 1.1453206003471231e-07 2.1214905030545009e-07 
-2.5810504119567412e-07 2.7606152674109891e-07 2.5810504119567418e-07 
-9.8898856429126646e-07 5.5360961544939145e-07 9.8898856429126625e-07 
-5.2009952186614271e-07 8.0486547756901337e-07 5.2009952186614282e-07 
-3.4068069616502588e-07 8.8654646429348081e-07 3.4068069616502593e-07 
-8.0289239099350644e-08 4.3131697190089948e-07 8.0289239099350657e-08 
-5.5888212948474555e-07 6.5313759407907322e-07 5.5888212948474566e-07 
-4.8716512101958348e-07 2.406732546734401e-07 4.8716512101958337e-07 
-5.4498365514159688e-07 9.533512833793086e-07 5.4498365514159699e-07 
-2.552238745207954e-07 5.2506815909667523e-07 2.5522387452079546e-07 
-1.8233851933493076e-07 5.1447615783668805e-07 1.8233851933493078e-07 
-3.1406722067512627e-07 9.5276444938311386e-07 3.1406722067512632e-07 
-9.6991887645674186e-07 1.8736566191296771e-07 9.6991887645674165e-07 
-6.7473361227907727e-07 3.8419036332513809e-07 6.7473361227907717e-07 
-5.7634760873501704e-08 1.9800766133288477e-07 5.763476087350171e-08 
-2.075097975659338e-07 3.2843543934236751e-07 2.0750979756593383e-07 
-2.987417171760572e-07 6.1613804799680507e-07 2.9874171717605725e-07 
-5.7992359800053109e-07 4.7942052667738203e-07 5.7992359800053098e-07 
-3.3908495199096592e-07 2.7570165250164486e-07 3.3908495199096587e-07 
-)";
@@ -1,57 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_pow_testdata = R"(
-5.265038938779167 6.7246952073539532 70991.409299909545 
-4.31586383194748 6.4262875091610709 12053.907275603469 
-7.6680714599840485 -7.6309094030118034 1.7743534199429417e-07 
-8.0850076206319379 4.7735530552474081 21520.913750004798 
-9.2211007385724528 3.9113787592973797 5937.8718528111885 
-4.0430050364504293 -9.8814853537509553 1.0112546228717893e-06 
-0.16307414828048294 5.5652709745649354 4.1372309338273458e-05 
-9.7766581070872043 5.8285180053682346 590667.04162352451 
-6.3838146868749455 1.8345631868613275 29.989596926698077 
-4.7983215204176037 2.0996514850361887 26.918462787367833 
-5.1035446745355841 -1.5521858303348228 0.079662005363441479 
-5.9756049012045018 -3.4426455392985558 0.0021241853139743654 
-6.5417372195027994 8.7246765940046664 13081527.254382474 
-0.53091950663314691 -7.9234829993534444 150.91435862115455 
-0.18154466931624569 2.3958591249712669 0.016773699553801338 
-9.1671848772322022 5.6529305154978182 275076.31062054844 
-1.2246611637849281 -7.986253882951023 0.19819026168558052 
-8.2420215106648094 -0.22339495251869046 0.6242559426381431 
-1.6071523139439332 7.3244103395162483 32.303255990698482 
-3.7059888592712742 -2.2141907425163705 0.054996846449065537 
-7.9707603412612613 -1.2238007926644094 0.078839505166823295 
-2.8822207082562006 -2.0899147677570369 0.10944836145100281 
-3.9009431346573269 1.0484902420188558 4.1671158785912459 
-9.3186777267276604 3.3410902430986749 1732.607415729402 
-5.1289276939091781 0.23312090995619528 1.4639358343682987 
-6.0560204486378275 4.3345237083747978 2457.0247937478825 
-3.8696690967049356 6.4315441902015955 6020.7445597902661 
-8.3485009804954267 8.285077961186893 43211395.60130471 
-5.3790357992973519 7.5483741567264246 327816.24464743154 
-8.7360528721694166 0.83036141232705418 6.0482796564889707 
-8.6870186249783998 0.53101576565796904 3.1517747475068068 
-4.5873216934136138 -4.2949182694750974 0.0014409778970573446 
-1.6725440708622923 5.8162170675809008 19.91647317061522 
-6.725715249420638 -7.2470743409858143 1.0030387857196959e-06 
-9.2530821687376807 6.0355542225323653 679319.49028315116 
-0.551597564637202 3.2088784488116886 0.14821682140490233 
-8.790833954806633 -4.9812205441757316 1.9841659212830487e-05 
-5.2839224463801635 4.3238925558992278 1336.5522653956841 
-3.4992398145092611 6.2380360937748804 2473.589445883239 
-9.2147251479151677 -2.75179544829078 0.0022178989775135855 
-9.5580674986293559 4.0373532149557398 9080.3031416150625 
-1.8641017063159246 1.2057028044203904 2.1188780402981644 
-6.9976211790811824 8.1125269426249922 7156210.5848364187 
-0.77666541927162314 -0.41357689050076374 1.1101884221207121 
-2.2412153523616745 -6.8645888730150135 0.003927120764376491 
-4.1468609402589749 -4.9904539492023936 0.00082660765147498586 
-7.766641155474435 4.3950483215028804 8177.4539326192926 
-4.5793823931458597 4.7136344832893506 1302.5734982163799 
-9.9429697827053793 8.9846920323985948 917012238.19094276 
-5.9983140447148777 5.9261086039622803 40802.383608902768 
-3.0103053069179548 6.7159223868234648 1637.9900848529012 
-1.6707557702485936 3.6407322200175578 6.4798720590224805 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_remainder_testdata = R"(
-571821029.5071094 442096033.04929972 129724996.45780969 
--93764141.969292641 -20497006.467124701 8720890.366330862 
--375087386.51160908 92137539.697744131 -6537227.7206325531 
-560719173.02138066 -173987002.74758422 38758164.778627992 
--836569732.81845057 150533622.2937119 66632000.943820834 
-807301619.92799354 322745217.19189763 -160934031.64769936 
--896902352.26017678 915731697.59116888 18829345.330992103 
--279137761.67346251 -586492944.49400866 -279137761.67346251 
--999672711.27736342 402078173.2461853 -195516364.78499281 
-739986627.35892582 449771478.99973536 -159556330.64054489 
-240347469.14571381 583025919.76191163 240347469.14571381 
--700413626.11768317 426869081.21252275 153324536.30736232 
--103040534.40593815 -605164126.24016666 -103040534.40593815 
-711013484.78051209 -969002485.95416164 -257989001.17364955 
--129221461.9544208 -925306354.61384034 -129221461.9544208 
--878576533.20866871 901229833.24860191 22653300.039933205 
--385122955.69833755 -376841909.40544498 -8281046.2928925753 
-980741992.99792123 177059647.59416914 -81615892.567093611 
-390539943.08949828 446480577.99480414 -55940634.905305862 
--263157782.07938802 -334609437.02140105 71451654.942013025 
-470961729.93284655 585789505.81683445 -114827775.8839879 
--423816528.47465479 -776383662.17666578 352567133.70201099 
-237517615.47715759 -490714757.85399085 237517615.47715759 
-108883622.93444777 -39700352.019610763 -10217433.124384522 
-266923.49167728424 -483128292.69424307 266923.49167728424 
-853951943.48870635 88443159.139193296 -30479647.903226614 
-3744946.231690526 -130058258.53269231 3744946.231690526 
--555958347.90122545 -271700796.4981904 -12556754.904844642 
--289369717.28304017 817785276.07898808 -289369717.28304017 
--14223771.64129591 -502684026.91425896 -14223771.64129591 
--525656118.16419435 -736196698.27798486 210540580.11379051 
-286179218.07093954 -1695010.3263899088 -277527.08895504475 
--615332468.96209955 199347241.20754051 -17290745.339478016 
--302487840.79042065 923790172.64405465 -302487840.79042065 
--359318722.75830293 699126864.68495131 339808141.92664838 
-737025226.99833369 -710303434.25882196 26721792.739511728 
--652014327.68251014 -110514670.4072963 11073694.761267662 
-911125880.80822992 184042277.31313872 -9085505.7574636936 
--816578272.21720886 -432015098.54719698 47451924.877185106 
--523830996.71201915 927100263.48396063 403269266.77194148 
-667490088.05678034 -650416159.19969368 17073928.857086658 
--86718644.570876002 984342649.91290331 -86718644.570876002 
--109949817.53441441 259064179.59211111 -109949817.53441441 
--615884071.79653418 220985102.13479829 47071234.607860684 
--913345761.5828259 427977964.40938306 -57389832.764059782 
--843453147.93575478 327018959.9304266 137603731.85552502 
-597680684.30696797 -755588144.7769742 -157907460.47000623 
--819636382.49871349 -388776592.15707755 -42083198.184558392 
-431862249.58432317 827884918.2675209 -396022668.68319774 
--741641405.75673139 466857837.79472923 192074269.83272707 
-836661703.86763239 498675607.04134917 -160689510.21506596 
--681035518.29758358 -111705698.88979316 -10801324.958824635 
-216043288.7101419 -496075485.69945413 216043288.7101419 
--582610748.163257 -711035485.72687137 128424737.56361437 
--802355319.06998956 -938388427.4108187 136033108.34082913 
-251088453.81066799 881241375.30842519 251088453.81066799 
--398217244.76724946 -410977266.84415567 12760022.076906204 
-739457897.50794697 887915890.7655108 -148457993.25756383 
--846927080.96539199 -856838984.01389146 9911903.048499465 
--660161204.02109694 -798837386.22250104 138676182.20140409 
--751240453.25331473 151487449.91285396 6196796.3109550476 
-128483475.81465888 236017552.41438508 -107534076.5997262 
-971746033.44887733 748115852.1084702 223630181.34040713 
-957647296.20592475 -916965554.01147592 40681742.194448829 
--595645502.61030674 919454142.054075 323808639.44376826 
--667358750.50823498 41656290.418979049 -858103.80457019806 
--814201364.21484947 -868454457.46016347 54253093.245314002 
-579863506.3692553 -114508137.65560544 7322818.0912281275 
--885106467.76226032 -670003769.71944499 -215102698.04281533 
-490827416.79127765 914342780.40848398 -423515363.61720634 
--591289130.93102837 314003794.58595014 36718458.240871906 
--46628698.200805187 402895852.27670527 -46628698.200805187 
--273649148.99769759 -906902782.56263781 -273649148.99769759 
--226044535.00381935 828767591.0395503 -226044535.00381935 
--611334579.11371124 605835708.82396054 -5498870.2897506952 
-374988560.91713023 674710311.51310062 -299721750.59597039 
--462383830.68306267 -426397661.01627541 -35986169.666787267 
-165660768.05434275 -825119290.64246488 165660768.05434275 
-138940036.95589614 555027613.73763275 138940036.95589614 
-685964141.94029498 336878386.02136207 12207369.897570848 
--274558389.31856871 619800679.84478211 -274558389.31856871 
-124539278.10093188 -366716762.98722136 124539278.10093188 
--771784374.02241051 564838298.22573352 -206946075.79667699 
-904865056.5113306 309409617.91165757 -23363797.223642111 
--784846872.38978827 -10260662.691032887 -5036507.8712888956 
-804721771.6335187 -146846276.11678171 70490391.049610138 
-702030443.20947433 -895100.14253592491 271931.46130919456 
--51768394.435125709 257467056.42062783 -51768394.435125709 
--502191523.3666032 -94321019.955202579 -30586423.590590298 
-773077425.58126831 -350002285.87374651 73072853.833775282 
--644492339.28160977 -624522474.95261383 -19969864.328995943 
-26943320.599895 920704645.30578709 26943320.599895 
--548636006.29824734 617817453.45269704 69181447.154449701 
-338602179.83347631 -856167902.46202958 338602179.83347631 
-373533229.04188919 282973094.75680661 90560134.285082579 
--397906330.32158887 709658879.13013411 311752548.80854523 
-93848885.707967758 -871024899.49883676 93848885.707967758 
-790874342.98489046 45078191.063820958 -20533096.163886786 
--199581192.27327263 -71595338.176366329 15204822.255826354 
--238568526.51845956 -253857846.03195441 15289319.513494849 
-)";
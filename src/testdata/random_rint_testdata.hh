@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_rint_testdata = R"(
-630747672.30606961 630747672 
-223587785.41282868 223587785 
--666549885.63358307 -666549886 
--188881770.84455383 -188881771 
--561740082.27677751 -561740082 
-469132588.0325048 469132588 
-562578941.53119707 562578942 
--8231052.794025898 -8231053 
-699094594.49120665 699094594 
-698373922.59657931 698373923 
-125760995.33709145 125760995 
-133967068.24981451 133967068 
--699172962.86410022 -699172963 
--137234784.15629029 -137234784 
-49984155.975780725 49984156 
-975321789.75093651 975321790 
-266136348.78569508 266136349 
--438880760.70721471 -438880761 
--949403018.76175642 -949403019 
-17683191.711538076 17683192 
--78185885.677706838 -78185886 
-431341826.56837821 431341827 
--818085436.19871187 -818085436 
-730677336.38014054 730677336 
--149778731.6754297 -149778732 
--949339589.2678982 -949339589 
--256914449.32831538 -256914449 
--281954834.25147128 -281954834 
-91234246.536304474 91234247 
-956581809.84005904 956581810 
--111231725.65039885 -111231726 
--243550297.84067905 -243550298 
-154096960.16228437 154096960 
--769205054.38321495 -769205054 
-674423271.20694256 674423271 
-608432715.33453536 608432715 
--639900250.51309586 -639900251 
--102199645.16719162 -102199645 
-215100895.54536438 215100896 
--497327617.58079356 -497327618 
--838611514.92091668 -838611515 
--639087470.28084731 -639087470 
-467085128.39513826 467085128 
-704967597.0396409 704967597 
-447968059.58844876 447968060 
-706582673.41377497 706582673 
-928008584.71087956 928008585 
--331025186.63826501 -331025187 
--514585601.42403316 -514585601 
-134550907.18960714 134550907 
-92560569.60908556 92560570 
--969317051.46220148 -969317051 
-160640739.2953403 160640739 
-626994551.46244335 626994551 
-483193264.93100715 483193265 
--861354362.61326599 -861354363 
-148183635.74640775 148183636 
-741468573.50437689 741468574 
--223663064.16446877 -223663064 
--977529329.26190877 -977529329 
-782043108.86130857 782043109 
-143502740.3233943 143502740 
--262952972.65010142 -262952973 
-254777374.23462701 254777374 
-105215042.31036782 105215042 
-383361574.80788946 383361575 
-855347339.56934834 855347340 
-262063617.14611077 262063617 
-817767289.06728816 817767289 
-206908560.53252006 206908561 
--987549508.74554491 -987549509 
-119172844.54511356 119172845 
--447771266.48948801 -447771266 
--465013337.61803019 -465013338 
-995124338.94676638 995124339 
--193404367.71375608 -193404368 
--530717451.00281852 -530717451 
-68304735.749838948 68304736 
-513002157.14957428 513002157 
-678512912.82941055 678512913 
--860008853.39968729 -860008853 
-390941787.25207949 390941787 
-79050594.648362637 79050595 
--288207023.84236813 -288207024 
--846614752.28523207 -846614752 
--565307049.05100179 -565307049 
--266592396.84560919 -266592397 
--252750265.77893984 -252750266 
-808245662.22137022 808245662 
--457185386.34019887 -457185386 
--682575227.68890452 -682575228 
--802219555.19868517 -802219555 
--124400466.48989224 -124400466 
-56044143.070364475 56044143 
-335384592.39622688 335384592 
-188414711.342206 188414711 
--289419176.97775018 -289419177 
--854106537.38244772 -854106537 
-618648586.96196699 618648587 
--183439722.09797645 -183439722 
-)";
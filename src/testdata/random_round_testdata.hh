@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_round_testdata = R"(
-77521318.920106888 77521319 
--195906930.71310675 -195906931 
--216706837.1731801 -216706837 
-495825193.46696591 495825193 
--792710647.05689538 -792710647 
--255755495.85722554 -255755496 
-125869829.71595001 125869830 
-734486910.03668809 734486910 
--781300066.01017964 -781300066 
--851040043.98344183 -851040044 
-743534681.96192575 743534682 
-304190950.57563424 304190951 
-887491494.14091277 887491494 
-261125425.14335155 261125425 
-627145284.22233701 627145284 
-607690295.89879012 607690296 
-57174397.687791824 57174398 
-182908144.0020299 182908144 
-888363774.78393126 888363775 
-55018661.040334225 55018661 
-416758674.51512384 416758675 
-197424375.85250878 197424376 
--671341730.06116986 -671341730 
-852592136.82703996 852592137 
-209046320.05691743 209046320 
-315841791.15977693 315841791 
-345842906.63587546 345842907 
-956005706.93053627 956005707 
--826362026.37192559 -826362026 
-942123972.0623126 942123972 
--852784546.44019914 -852784546 
-661837696.43531895 661837696 
-347204418.01415324 347204418 
--155598694.81863582 -155598695 
-972103651.92612648 972103652 
--798555977.96072316 -798555978 
-449606873.52771306 449606874 
--640699857.58112311 -640699858 
--651995502.89735055 -651995503 
--36640752.951292276 -36640753 
--15971359.134365797 -15971359 
-636192507.98424268 636192508 
-44966496.660123348 44966497 
-220424231.56389093 220424232 
-763525010.08605194 763525010 
-655117147.16825175 655117147 
--652424251.50980592 -652424252 
-271076020.4150207 271076020 
--278385870.37947416 -278385870 
--259817077.07036769 -259817077 
-920279018.20145106 920279018 
--12375724.895637989 -12375725 
--756167558.41458547 -756167558 
-301744583.18367124 301744583 
--59080915.837212086 -59080916 
--171971968.93003905 -171971969 
--8342555.6675393581 -8342556 
--170954169.48596132 -170954169 
-261951153.75921631 261951154 
-104880796.62477326 104880797 
--564160853.15783441 -564160853 
--836312164.41232693 -836312164 
--959465503.84131157 -959465504 
--849008023.38295507 -849008023 
--80809035.626885772 -80809036 
-792715158.30406237 792715158 
--605031594.87917876 -605031595 
-690398737.00660634 690398737 
-230806074.60436296 230806075 
-23249570.230309725 23249570 
-232233363.8628149 232233364 
--941728626.59700167 -941728627 
-724777536.95340824 724777537 
-220000404.97188067 220000405 
--703177585.56452703 -703177586 
--456591388.50915527 -456591389 
-807844976.00214338 807844976 
--33446718.859980941 -33446719 
--830198599.66943789 -830198600 
--259189762.84117222 -259189763 
-989741173.48663235 989741173 
-419931606.77868438 419931607 
-205421810.32545137 205421810 
--426451308.45277429 -426451308 
--398320059.01534855 -398320059 
--458040726.37022483 -458040726 
--774512636.09294271 -774512636 
--804705858.20278382 -804705858 
--383707720.23991299 -383707720 
--279417302.66701663 -279417303 
--120638757.62574625 -120638758 
--865816172.74576628 -865816173 
--568387971.76635551 -568387972 
-824096026.84119487 824096027 
--846905120.32882178 -846905120 
--226443190.65975511 -226443191 
-214272879.18141127 214272879 
--325822830.68868446 -325822831 
--331861381.17272377 -331861381 
-417187990.5947113 417187991 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_sin_testdata = R"(
-1.8231324422553301 0.96833181413486402 
-0.23960848179602845 0.2373223117191848 
-1.7699983724514596 0.9802247948603986 
-2.6421141525839325 0.47896781500907615 
-2.7401613262658215 0.39073628272606115 
-1.8551637023722773 0.9598393276809829 
-0.10294049008072356 0.10275878070519123 
-2.0799191488422748 0.87317239014602188 
-2.5974069726894182 0.51772157221043247 
-2.6303482332869916 0.4892629295958984 
-1.8391037719896335 0.96422097324817979 
-0.81334203195490196 0.72658745103408107 
-3.0765419645913834 0.065004820706911701 
-1.2101674743529525 0.93567511012798921 
-3.1338384649805211 0.0077541109029194179 
-0.28533381023212984 0.28147778050379962 
-1.7397877460848403 0.98575489964874086 
-2.9663526945499585 0.17434442661350075 
-1.3981870359253132 0.98513996632657941 
-0.60044953237496346 0.56501343141035909 
-0.93917348016613078 0.80707035312454878 
-2.9682736922507553 0.17245252898561753 
-1.3365837256012751 0.97269738012465079 
-2.1411251957389488 0.84172346141561594 
-1.9887567509437858 0.91391869894398026 
-2.4077684849414784 0.66971442441147622 
-0.27075663652349846 0.26746058452801252 
-1.2333855807936016 0.943614987127111 
-0.66026697300223158 0.61332773671888674 
-1.8268214584677667 0.96740420251995007 
-1.7274867992266323 0.98774914387819912 
-2.2052966379466321 0.80536800014134358 
-0.28752157245308368 0.28357641127342048 
-0.71060447060400911 0.65229205936981483 
-1.0990815496693591 0.89079037872289801 
-1.3307935328979021 0.97133731073158502 
-2.1613068612079958 0.83065652937377343 
-0.87435348671377044 0.76712892887097051 
-1.7976260887154278 0.97438424395222012 
-1.9159640554942436 0.94101871408038218 
-2.9620194646812421 0.1786096417315361 
-1.4623373223168743 0.99412408560250654 
-0.98128093154320672 0.83121019671330421 
-1.0902116879955113 0.88672479718334596 
-3.134485808070318 0.0071067856950852966 
-0.066133073115677801 0.066084877238301823 
-1.0937312722969217 0.8883463973054343 
-1.4182936642036172 0.98839398860935601 
-0.068810770218141887 0.068756480799796349 
-0.85947498409224865 0.75749991841490916 
-0.0051986338968063638 0.0051986104806362029 
-0.83404876159084074 0.74065772644994954 
-2.2599806785198182 0.77176494884616786 
-0.13934777508910254 0.13889724146949403 
-2.9390406910995428 0.20116977430702351 
-1.6143072438496062 0.99905354938101631 
-0.39378407424166639 0.38368560932263518 
-1.8164046586542506 0.96998959073346458 
-0.42770223674714414 0.41478111569012988 
-3.0780354695248637 0.063514402666739661 
-1.2216080676057404 0.93965074747387778 
-2.794386010259565 0.3402724700473142 
-0.11408359280169725 0.11383628620772679 
-0.02276000243055009 0.022758037467386201 
-2.4318949242792303 0.65160451067969549 
-0.62930528007190467 0.58858326300378694 
-2.6540809630944255 0.46842891621580257 
-1.696295741742329 0.99213527907186583 
-1.2379789987988623 0.9451256547143001 
-1.6333712143108214 0.99804283047834885 
-0.14922614873270634 0.14867292605304852 
-2.5516919665300013 0.55627849700722842 
-1.3688535312087242 0.97967875457720832 
-1.5625285700285998 0.99996582229371433 
-1.9484553694239002 0.92953039921262681 
-0.22226053255511682 0.22043511157945631 
-0.18192660178653614 0.18092471500903484 
-1.9235751235630347 0.93841624397428713 
-1.7164084743387054 0.98941726979586841 
-2.8193284432917989 0.31671502105282451 
-1.3263836381654204 0.97027961373500393 
-3.0372745591015784 0.10412899455406056 
-3.1147143591272508 0.026875058241447508 
-1.2477909629168251 0.94828574568251212 
-1.240745250028265 0.94602579122421948 
-1.1788055414281557 0.92415035401243928 
-2.3889735896659623 0.68355275990463471 
-0.21009122166310926 0.20854911658525099 
-2.0791090815179851 0.87356693974627997 
-3.0552794119839275 0.08620610959510952 
-2.7595995689614647 0.37277063867814469 
-1.0931194201502719 0.88806528449923627 
-1.8398314081213119 0.96402782180193669 
-1.5040285474708046 0.99777185974888438 
-1.8782565868997658 0.95310526723529376 
-3.0292069792674399 0.11214924173004039 
-3.1080374322026714 0.033548924808575138 
-1.1614427746982774 0.91737831133295467 
-0.11565429763055683 0.11539663963903478 
-3.0684201247301117 0.073107249381027806 
-)";
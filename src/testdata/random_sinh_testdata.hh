@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_sinh_testdata = R"(
-5.5411071891256434 127.47810507333038 
--3.6891637304170013 -19.993189887216804 
-5.8585715924933588 175.11033466492887 
--5.3069113316518219 -100.86062131644429 
--3.523516136633579 -16.936966337621701 
--5.9971026523992368 -201.12956289178985 
--0.5378292723011322 -0.56413565224177986 
--5.5500048887256064 -128.6174630172182 
-1.9120642686690896 3.3096341810175427 
--6.2219799000417932 -251.84876740484478 
-0.39314534612956908 0.40335154075344842 
-4.4876445933955935 44.450264279272851 
--3.4172603255719491 -15.226488608350801 
-4.1538008895186849 31.829930051293317 
--0.22508048688710325 -0.22698578227220034 
-3.1502406570786778 11.649419715225202 
-3.3250509580894896 13.882222288457363 
--4.3956849634427977 -40.543915978446613 
-4.8046882902782073 61.036619933414549 
-6.0960069825760197 222.03937504518942 
-4.4798509697163773 44.105094457426723 
-3.9427355423502277 25.770028269561244 
-1.187219070130566 1.4864421521087832 
--2.4922481564776406 -6.0028492390360881 
-5.1445007273601462 85.74000685921196 
-5.637112670271808 140.32382588113961 
-0.099076857721422051 0.099239030731030672 
-5.2098007478915154 91.526058594415062 
--4.7559887509165923 -58.134983423453832 
-4.1481265379312546 31.649738189619683 
--0.086048788127080833 -0.086155017301786707 
--3.1224858766445576 -11.329349122274817 
-2.6416545531791638 6.9825825468139158 
--1.297050205330299 -1.6925760256335318 
--5.3363964876938352 -103.87893558158913 
--5.8756843940855621 -178.13279918474188 
-1.3898310804063723 1.8825272707732128 
--0.022931588942391556 -0.022933598787611535 
-1.4005271888791349 1.9054356958846315 
--4.5411119171072034 -46.892186458471848 
--2.1364623500484701 -4.175675457218377 
--2.2810757607083012 -4.8425146023688717 
--1.1325198676050388 -1.3906233505507026 
--2.8208175715135639 -8.365507662689657 
-1.7029469478599433 2.6539783320929975 
--3.3071860605884686 -13.635777317432048 
--4.27220619645421 -35.832824807164315 
--2.735816816056055 -7.6787472407548369 
-5.1103515434119693 82.861285736196621 
--1.3886191402392853 -1.8799452268915047 
-1.201008217687539 1.5112876578764587 
--1.1459747673312437 -1.4137960623911949 
--5.0846352391882199 -80.757410405332834 
-5.5325195694669027 126.38802506015396 
-4.2741742050414242 35.903441006580699 
-0.66933984095214782 0.72045057028450499 
--2.7153832165599963 -7.5221099654043995 
--0.72402834805007465 -0.78896524087355924 
--1.165870994756987 -1.4485326721619169 
-3.6676903155277305 19.567907789576179 
--1.6752022543589691 -2.5763023767253221 
-4.7254831126641506 56.388053316862752 
--3.23896153835206 -12.73400756660625 
--2.1956757913178837 -4.4373941914037447 
--1.5700684569688548 -2.2994731564510196 
-0.29022114779212682 0.29431247982867614 
--4.6825253979736763 -54.016661616305477 
-4.5814076245989437 48.820757024440695 
--0.344161350947366 -0.3509958505732001 
-2.1057591277086267 4.0457912006645538 
-0.95107169099174715 1.1010777239364249 
-1.4227641024215254 1.9537624333329484 
--5.4490405360847394 -116.2653247593133 
--1.8878075173415736 -3.2267341667219775 
-3.9187748128529378 25.159433597208071 
-2.5134432521198509 6.1331915854720931 
-4.622988979033325 50.89401304951334 
-6.019912184015741 205.7700121255709 
--0.30298728956958776 -0.30764438568675367 
-2.8557853947564151 8.6652888623885165 
--4.4278964423582092 -41.87155416209756 
-1.7546502521713414 2.8042288102753639 
--0.70321317793743976 -0.76262070614293087 
--4.6179867179494973 -50.640014459535124 
--1.5023276341048097 -2.134760776981504 
--1.4021845878313677 -1.9090048758719005 
-4.3772754383133776 39.804123143113856 
-0.59949600414056636 0.63605619342022179 
-5.1704923212857512 87.997891827402228 
--4.4958999617682958 -44.818829279224559 
-1.4358944742544537 1.9827503462410943 
--4.4810777628337073 -44.15924939270613 
-5.1755164665932512 88.441147054154769 
--2.5512837075769261 -6.3727867097536608 
--1.5503217944894621 -2.2504034335563921 
-5.2355346266927807 93.912087095881745 
-1.5163766688965374 2.168091348252426 
--1.5900143320977032 -2.3499482603828241 
--5.2675237743851886 -96.964991927004135 
-3.7359308324604132 20.95159174503317 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_sqrt_testdata = R"(
-908459098.03925419 30140.655235731923 
-974348689.58807015 31214.558936305188 
-94139670.81675984 9702.5600135613604 
-494620722.88245404 22240.070208577446 
-584298408.20084012 24172.265268295399 
-687516480.08111632 26220.535465186753 
-240741790.98001355 15515.856114955874 
-35851472.914468333 5987.6099500943055 
-312971127.82685786 17690.990018279303 
-826896668.24215388 28755.811034331025 
-806161228.19001174 28392.978501559355 
-211951240.70334718 14558.545281151793 
-570796026.61376274 23891.337899200262 
-777654944.40332127 27886.465254731036 
-630274578.03155112 25105.269925486784 
-611652184.47092581 24731.602949888344 
-718563670.08103871 26806.037940752056 
-942133304.42349446 30694.190076030583 
-982065975.62531519 31337.931897706894 
-95528860.15697059 9773.8866453919236 
-149298729.87564903 12218.78594115017 
-392516931.69458121 19812.040068972736 
-379193556.31435609 19472.892859417578 
-413311837.18416148 20330.072237553941 
-412865693.20149201 20319.096761457975 
-683021123.62553203 26134.672824153204 
-661932982.69810402 25728.058276871656 
-826997225.35333765 28757.559447097345 
-662115976.93660748 25731.614347658164 
-770371781.52866411 27755.572080731177 
-176783309.800042 13295.988485255319 
-450723530.49260479 21230.250363399035 
-160093517.60789418 12652.806708706736 
-585492520.96412885 24196.952720624322 
-358778121.16288054 18941.439257957158 
-803380140.9462713 28343.961278308849 
-777854173.72736859 27890.037176873189 
-717309785.59755254 26782.639630879414 
-19868152.028911281 4457.3705285640417 
-675372545.48362267 25987.930765715508 
-660137004.05690289 25693.131456809675 
-257079026.37163433 16033.684117246239 
-964320081.7833122 31053.503534759362 
-987185802.01953089 31419.513077378058 
-535549476.33807403 23141.94193100644 
-294717752.12345511 17167.345517681384 
-803279303.95644259 28342.182413435323 
-888311656.52832794 29804.557646915815 
-467175588.7433576 21614.245042178958 
-790358890.33002055 28113.322292643046 
-636702576.93451011 25232.966074849584 
-763146572.82950687 27625.107652812992 
-471922466.6502741 21723.77652827137 
-882380258.73603344 29704.886108787447 
-631712280.6529429 25133.887097958861 
-741456131.61768258 27229.69209553576 
-468471259.30571395 21644.196896759971 
-465834919.72966212 21583.209208309643 
-38139849.832899258 6175.7469048609219 
-845355084.19522107 29074.990699830345 
-92347093.624262497 9609.7395190641091 
-620477473.33386791 24909.385246004524 
-308808082.72991699 17572.936087345137 
-905754165.20833504 30095.749952581926 
-222410606.76119614 14913.437120972352 
-705046920.54112697 26552.719644908822 
-884999693.0468148 29748.944402227364 
-456720830.10711187 21371.02782055912 
-884713148.70609939 29744.127970174202 
-918195967.27149594 30301.748584388592 
-155126621.35737127 12454.983795949767 
-59635235.00896275 7722.385318602197 
-749973813.05153787 27385.649765005357 
-266080062.91998044 16311.960731928593 
-730662927.17314208 27030.777406007805 
-5677874.9054569127 2382.8291809227353 
-244900868.66769335 15649.308887861258 
-545631362.66003418 23358.753448333544 
-938032904.57638609 30627.322843767884 
-774044426.64185715 27821.653916362651 
-155246763.08668521 12459.805900843126 
-853454288.33305931 29213.939965931662 
-177541687.27480486 13324.476998171631 
-640373536.27488208 25305.602863296539 
-9781519.3238452431 3127.5420578859116 
-792516327.09058881 28151.66650645373 
-73990051.314006537 8601.7469919782307 
-21530599.473697636 4640.107700657134 
-916752892.07828712 30277.927473297888 
-884476266.03949571 29740.145696339412 
-199459961.27738336 14123.029465287656 
-571594243.96969855 23908.037225370437 
-32803800.446982626 5727.460209113864 
-393144092.09348911 19827.861510851068 
-12295945.617379537 3506.5575166221838 
-242241492.01092082 15564.109097886741 
-760998344.19861865 27586.198436874529 
-219556950.05704963 14817.454236711839 
-692273794.50409687 26311.096413948562 
-754830687.42600965 27474.182197583417 
-)";
@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_tan_testdata = R"(
--1.2604426791294665 -3.1180089890570768 
--0.78142293466328538 -0.9920809807312887 
-1.366407587837644 4.8243173794629337 
--1.4259773893415004 -6.8568336570889787 
-1.3417748819954096 4.2897945699428428 
-0.94638146718690264 1.3877419065303149 
--0.56661917000210726 -0.63620903496963765 
-0.3672215114272297 0.38467011612881918 
-1.4098576326072738 6.1598070331117674 
--0.57409851661623745 -0.64676616861813863 
-0.95479365477216582 1.4126458316383661 
--0.3823873846390069 -0.40218361426419874 
--1.0933647918881872 -1.9329252297501704 
-0.97967762917096834 1.4899197780054145 
-0.37704646628237026 0.3959920343256344 
--0.34331867308286412 -0.35747521825133155 
--0.92667762306412804 -1.3316192031398915 
-1.1073818030925158 2.0011659700541977 
--1.4650553748040487 -9.4218006407022123 
-0.60663944555861304 0.69392842127919829 
-1.2718702717685595 3.2450682309642755 
-1.1617808391356927 2.3070114877273551 
--0.96665535390291613 -1.4487856280203306 
-0.14687717830541813 0.14794256178046017 
-0.80676328169215461 1.0436698938807509 
-1.3138064644590641 3.8051612326263391 
--0.0055803053053271601 -0.0055803632292592848 
--1.2147901929723317 -2.6892567226045934 
-1.2834481867067531 3.3837849478819515 
--0.30444746101430264 -0.31421602892786826 
-1.2080388280915124 2.6346690725169162 
-1.0067250647278061 1.5806887491407902 
-0.052029017124557875 0.052076015855219572 
--1.1591791884299461 -2.2906611646274708 
--0.14902566685409546 -0.1501387757536348 
-1.2722540075481001 3.2494984009042356 
--0.66250020349966843 -0.78011888316140243 
--1.43097434220399 -7.105282938049637 
-0.68052907937846374 0.80953681173621783 
-1.5053479122896158 15.257386569060756 
-1.0930669897844072 1.9315155908306341 
--0.78587013756899793 -1.0009443941428666 
--0.024371035643165229 -0.024375861827343984 
--0.45605411898001114 -0.49054385828171237 
--1.2466873514656844 -2.9765814397234087 
-1.1589483496108071 2.2892198469501195 
-1.1382795115272306 2.1660458928261526 
--0.85780596303819412 -1.156414693655283 
-0.19230607404955102 0.1947122714756524 
--0.48777779395049481 -0.53053709114732828 
-0.54308132741788961 0.60362588437033105 
--1.4472512096631074 -8.0529853365769259 
-1.1971020481959456 2.5502441618636906 
-1.3064208907165833 3.6939611429387784 
-0.86163155349238174 1.165396003732301 
-0.98456223950424215 1.5057629717068821 
-0.54452879074568061 0.60560247991156202 
-0.99318504952717301 1.5343078005914521 
--0.80156927339313644 -1.0328767392158527 
-0.59936638993878733 0.68320704432321766 
--1.1927181297479315 -2.5177118592430521 
-0.96742363448307067 1.4511691675403626 
-0.92532158183716628 1.3278653925223078 
-0.49442486861676738 0.53908538692651853 
--0.76839103102998318 -0.96655137546600833 
-0.79591451514442424 1.021257033572885 
-1.2962060657114267 3.5497962502295417 
-0.66398036196809551 0.78250259878598516 
--1.2852719624607176 -3.4066319774684923 
-1.2834887064543219 3.3842894879402419 
-0.96429444742358861 1.4414941530997372 
--1.075728912100141 -1.8521435550365148 
-0.44731141092359161 0.47974340825089834 
--1.0815511529874089 -1.8782201137066523 
-1.3936003860862844 5.5842808166598834 
-1.5074681557157903 15.76964574130562 
--1.0138269685768311 -1.6058178250074799 
--1.0388095250142046 -1.6989784189741797 
--1.2469046622770068 -2.9787255192954896 
-0.73679061626129849 0.90722155771079016 
--1.5601097759228073 -93.571999443273654 
--0.87031747181793495 -1.1860886658945755 
-0.12330380446868583 0.1239325249486654 
-0.51119891379060212 0.56093380523310021 
-0.98214662437540134 1.4978989677363865 
--0.73109559620704423 -0.89689250086441719 
-0.10133513872146671 0.10168343319282852 
-0.5793772922378726 0.65427880921126436 
-1.4587502712032223 8.8875214323774223 
--0.41973771132704596 -0.44625798699561131 
-0.1955692217123326 0.19810129975963642 
-0.64112969058809721 0.7463012306176835 
-0.40142405670644399 0.42447284383441058 
--1.1632452675645808 -2.3163014388247851 
-1.2435655801435166 2.9460839486872397 
-1.3329759460446136 4.1252801016093033 
-1.3168623445455099 3.8530206342570432 
--0.26250845393695643 -0.26870931177242025 
-0.7786336022442768 0.98656157774463726 
-1.4638647196777246 9.316100842858468 
-)";
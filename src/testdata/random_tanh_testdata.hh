@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_tanh_testdata = R"(
--0.53654886981900973 -0.4903711475098062 
--1.0913434834877549 -0.79736797112569491 
--1.4759511243404038 -0.90070663411350815 
-1.0447808348015601 0.77976896188330003 
--0.88664587973725562 -0.70973311205503042 
-1.1785707455397234 0.82700039970284522 
--0.77801729214748538 -0.65156721013348462 
-0.21217201926818752 0.20904454284414084 
--0.89909122160571209 -0.71585508210772819 
-0.7913812535846545 0.65919080125710905 
--0.53972378745428751 -0.49277885556622297 
--0.29645224097466816 -0.28806258174212407 
-0.2970116290838547 0.28857546909794052 
-0.076246913980655862 0.076099500624646294 
--0.051155283413853558 -0.05111070794925876 
-1.2328751948363701 0.84341128711760305 
-0.5849954401828632 0.52628673461227193 
--1.1441432838701702 -0.81580456055696449 
-1.5106582625563574 0.90705579755420385 
--1.5565513977550218 -0.91485999706685406 
-0.97660781886312087 0.75159370251787472 
--1.5108258015001028 -0.90708548928269905 
-1.3823450303501486 0.88147529512183764 
-0.70213971328965386 0.60572418171643505 
-1.1721028834415925 0.82494513554406379 
--1.4269703034402392 -0.89104404135114668 
-1.0425411678780585 0.77888956689101652 
-0.61612062920844135 0.54842121231691776 
-1.1903185906281908 0.83067764969324864 
-1.3891884491618018 0.88299221225483848 
-1.4934989293682022 0.90396652989572823 
--1.349473903595106 -0.87392905578944668 
--0.32484955695880591 -0.31388531095924121 
--0.5593599689152009 -0.50750240174263994 
-0.2545902859969793 0.24922872355708545 
--0.87681918933885417 -0.70482224090446777 
--1.177006760828271 -0.82650543072786553 
--1.2093018482716968 -0.83646994392793395 
-0.37750558542388801 0.36053925278980259 
-1.2073508179718702 0.83588305730463819 
--1.2820894223964634 -0.85704061252052222 
--1.102209785885365 -0.8012913768475306 
-0.32055195325262531 0.3100059150650194 
-0.40795173835840237 0.38673214133299516 
--1.3954348452308414 -0.88436088120615997 
-1.0453885946525072 0.78000706678681675 
--0.3554053831327928 -0.3411605695177532 
-0.8623092137229964 0.69744552596074028 
-0.64227563840681512 0.56644701690938315 
-0.93024752696758473 0.73070928035881733 
-1.1861984761384172 0.82939613997902928 
-0.15089937038366186 0.14976434990562987 
-1.3419457498602334 0.8721388000828334 
--0.62048655024207533 -0.55146670214351845 
--1.0508450837504018 -0.78213469126585 
-0.31899326686371676 0.30859634418842469 
--0.24151166397033386 -0.23692307007372754 
--1.0681633357736935 -0.78876825189794186 
--1.0426067246335771 -0.77891535108139764 
--0.80750077913596396 -0.66820925905213768 
-1.278980520456646 0.85621305459200292 
-0.54910565370293574 0.49984961695347974 
-1.5108377300831193 0.90708760295601232 
-0.07973528117023565 0.079566731726938872 
--0.26394216581645069 -0.25797906176117374 
-0.42041423808913048 0.39727934793247149 
-1.2326444824964065 0.84334467733311613 
-1.4499621922818364 0.89568539770822675 
--1.1064323568185044 -0.80279766515963269 
--1.1735876025018634 -0.82541887151018423 
-0.70295493598411962 0.60624004290310285 
--0.021112154958087936 -0.021109018792271155 
--0.7452269621034453 -0.63229278868801875 
--0.38464996702944743 -0.36673887192444682 
-0.25420327223517347 0.2488657141423859 
-1.2314741801070777 0.84300639567979596 
-0.78710435666169198 0.65676553234808033 
--0.046369987398824364 -0.046336781417487143 
--1.22536403091477 -0.8412293525398058 
-0.82397804327673363 0.6772292366109619 
-0.79822225631782562 0.66304173990306559 
--0.55503014636782066 -0.50428070339667919 
--0.33096850545208922 -0.31939075351386137 
--1.4002109348453629 -0.88539723377393131 
--0.75819146413309291 -0.6400104614440798 
--0.42312192155900052 -0.39955721944825773 
--0.1376322438548514 -0.13676973940930684 
-0.74805927403878858 0.63398971534284165 
--0.36952646515845844 -0.35357744693794768 
-0.081027000988322717 0.080850141221530669 
-0.15146071835109054 0.15031306100939959 
-1.5395478192974537 0.91204435502945536 
-0.49273919238437403 0.45638778825103415 
-0.17585114948223413 0.17406064204735011 
-1.5387253813590451 0.91190593765583039 
-1.4450669848331876 0.89471312662888436 
-0.44317843719443406 0.4162755751725587 
--1.207513682218248 -0.8359321215431863 
--0.061776334076415695 -0.061697867862203319 
--1.2874064486015611 -0.85844576761686164 
-)";
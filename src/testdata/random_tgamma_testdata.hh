@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_tgamma_testdata = R"(
-7.1984704991054196 1047.2652951621271 
-5.227338514995413 33.990410920709969 
-7.7046933803467121 2795.6271857030301 
-4.8949639933035147 20.513591322100151 
-7.6278979675924106 2403.088330280274 
-6.9218186246880906 622.22732584459118 
-2.8014888851024282 1.6785909890813144 
-9.2795645075798774 73687.8357532628 
-1.5662495538705263 0.89016144162375466 
-9.7876156180777443 225478.5059546713 
-4.7127820515561742 15.717861047936211 
-8.2436219940181825 8267.8099321422633 
-5.9682534234557867 113.68368464725121 
-2.334182916048408 1.1912648436726476 
-1.5270895234289932 0.88740530870509426 
-0.87577871433799781 1.0889710019686576 
-6.0682789889700652 134.88258630638063 
-8.6702008122525278 20032.193290815285 
-0.4691868470442544 1.887579755076447 
-1.8909809006725093 0.95870803403973448 
-4.8029610920666261 17.91520861422638 
-4.8911797184901671 20.398854032828357 
-0.5296641336885215 1.6756817927677188 
-0.27100387711122509 3.3295427737577041 
-0.82908434940594855 1.1330893885233253 
-8.2312347301550854 8060.8245835423968 
-0.43230785564510626 2.0494077577605609 
-8.1945820553459932 7479.1018831248111 
-4.4517107727841791 10.880369736925472 
-3.1036461807722668 2.2053440047857635 
-1.7270542727915548 0.91404336490762694 
-9.6743140437390522 175273.9721024257 
-8.4409784055047492 12415.673628401304 
-4.112074263807413 6.9192123561173746 
-8.8631044495040463 30111.597192823829 
-2.259867617825547 1.1394531674373944 
-7.2248980600602035 1101.3324111058387 
-0.59554782183678445 1.4994961548030519 
-8.5210026519699777 14661.527873336639 
-4.2050607685569998 7.8083639344335474 
-5.7885133403149025 83.996766058148225 
-5.4012589479110051 44.688273394180925 
-4.9592059976991667 22.573981332910055 
-7.4421898474354444 1672.476695991681 
-2.7851996246924244 1.655841588838175 
-0.54410912614759199 1.6328557922242204 
-8.5376801147225159 15179.996213490245 
-5.7960097308394083 85.053477874509611 
-1.6265766594592419 0.89678345121084424 
-6.3097841999838291 205.31849497090778 
-5.5583167787059118 57.518428663249395 
-6.4487172134931035 262.65354687878505 
-2.05020114017915 1.0222729492571787 
-0.45088113461731522 1.9642713285408964 
-5.0286379105338996 25.060087968861339 
-8.2630298490177516 8603.1869855136883 
-3.041875586718414 2.0795129677939657 
-7.3633470645493677 1436.0828446571763 
-5.1546572968182991 30.374493788091332 
-9.675131830225709 175592.03004975631 
-4.5664356205244863 12.76303352396495 
-1.5971911725050929 0.89320208711976756 
-6.6573471318608366 382.49373701450372 
-5.7629788673711211 80.501308499129152 
-7.9754179124895552 4796.5536800931841 
-2.0415417260522384 1.0182799793916102 
-9.028914357841062 42896.5740755144 
-3.2376604244146758 2.5175346960893292 
-3.6021627600838553 3.7261674896954404 
-9.9785099404090278 345746.62398485397 
-3.7208641591141771 4.2737486310351365 
-6.5689807327569518 325.9136652733614 
-3.4487153680510581 3.1419245061337771 
-9.050273150617393 44907.850487754229 
-9.5991533598267296 148418.3352932338 
-2.4138980926405247 1.2535544048075928 
-6.0869131547280499 139.27593358153777 
-9.2767647884958713 73240.934995931864 
-4.9416083546826632 21.987807180900088 
-8.2505973082928001 8386.7676220237645 
-6.6434808097108524 372.9739713316124 
-2.4015113417939942 1.2433963998835091 
-0.80248484329981118 1.1614495894225676 
-3.3272851084655302 2.7606467767261211 
-9.6154996832411364 153876.9706971987 
-6.6429082128624595 372.58624648051597 
-4.6219584684614823 13.803919285932551 
-3.3929330745545574 2.9587830113701616 
-1.2750011796211007 0.90159698896506835 
-4.8988762673308592 20.632958380100089 
-4.4335004093567019 10.611414064277595 
-6.5230536797925174 300.0470798375992 
-4.1102782767811679 6.903235190195983 
-1.9243274234758907 0.97033224535750962 
-3.2353062432042008 2.511543296426717 
-5.1745182505941312 31.319058618352319 
-5.3529938437546098 41.394524552206882 
-4.3933277306768117 10.044350074847117 
-6.2130504412374687 173.30346274499377 
-7.0461025442453433 785.05527367482705 
-)";
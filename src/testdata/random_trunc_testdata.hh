@@ -1,105 +0,0 @@
-#pragma once
-#include <string>
-
-static const std::string random_trunc_testdata = R"(
--671989071.14428139 -671989071 
--283750761.91278946 -283750761 
-19378806.93333137 19378806 
--114493014.78725386 -114493014 
--515369157.72218406 -515369157 
-169428132.37160158 169428132 
-245001068.96822572 245001068 
-441717254.57806706 441717254 
-837335603.91565084 837335603 
-869779581.71490932 869779581 
-778655334.32173586 778655334 
-544588.35030078888 544588 
--207007243.01157081 -207007243 
-170429024.84626484 170429024 
--622193025.14314282 -622193025 
-951991044.15933967 951991044 
--706453958.01252913 -706453958 
--223624545.40538454 -223624545 
--287018640.27004659 -287018640 
--192536007.03235209 -192536007 
-93984453.027158022 93984453 
-761678415.50300908 761678415 
--607704665.31570899 -607704665 
-984391019.79423356 984391019 
-411764273.99490118 411764273 
-914347106.98264098 914347106 
-749692605.91529965 749692605 
--662047566.17794514 -662047566 
-932657347.134233 932657347 
--694547734.62414265 -694547734 
-454813518.4876194 454813518 
-638865674.00568533 638865674 
-850283700.27899027 850283700 
--322744222.52730644 -322744222 
--629842677.78724885 -629842677 
--554762748.22893214 -554762748 
-846854871.78256106 846854871 
-7136212.9275949001 7136212 
--766591782.12795317 -766591782 
--346253616.34724462 -346253616 
-414473786.82474065 414473786 
-679771785.61672401 679771785 
--826842448.67546165 -826842448 
--151186005.75811458 -151186005 
-82577943.829411745 82577943 
--109354046.41672659 -109354046 
--103666931.28769183 -103666931 
--409997248.08856225 -409997248 
--248235827.10691011 -248235827 
--323534888.02303851 -323534888 
--984882998.33704185 -984882998 
-73651026.781629682 73651026 
--224588.78175079823 -224588 
--869200488.32274032 -869200488 
--611872047.89440405 -611872047 
-401515668.20683098 401515668 
--606639603.38122082 -606639603 
--680772996.82098866 -680772996 
-803806618.33134627 803806618 
-736218832.35755992 736218832 
--360417619.35684252 -360417619 
--805114482.33893287 -805114482 
-762431942.32869148 762431942 
--917894028.81479096 -917894028 
--932246959.70383489 -932246959 
--876956886.9229207 -876956886 
--944612095.92122257 -944612095 
-905113216.70155358 905113216 
-308983600.73395181 308983600 
-9502010.5334422588 9502010 
-893696311.44414163 893696311 
--67559333.145494699 -67559333 
--227989810.18667603 -227989810 
--248187018.84631503 -248187018 
--769902174.84313512 -769902174 
--172821758.66797829 -172821758 
--401480426.25674152 -401480426 
--896033726.94149947 -896033726 
-891427707.77310467 891427707 
-637723324.60883355 637723324 
-192191090.77343297 192191090 
--599451906.93110824 -599451906 
--620780855.38544822 -620780855 
--334341952.09803903 -334341952 
-96391090.309847116 96391090 
--88383923.342257261 -88383923 
--525644698.05923569 -525644698 
--32427808.085933566 -32427808 
--580433542.80746937 -580433542 
-424914958.58778715 424914958 
-839349701.80315733 839349701 
-37968016.829815269 37968016 
--462194832.10902584 -462194832 
--72844571.714643598 -72844571 
-765487372.70746374 765487372 
-711945072.388129 711945072 
-590674374.86001849 590674374 
--515546093.86758357 -515546093 
-132480135.72832656 132480135 
-394048315.27361655 394048315 
-)";